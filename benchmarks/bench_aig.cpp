@@ -0,0 +1,130 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <functional>
+
+#include "bitblast/aig/aig_cnf.h"
+#include "bitblast/aig_bitblaster.h"
+
+namespace bzla::benchmark {
+
+using namespace bitblast;
+
+namespace {
+
+using Bits    = AigBitblaster::Bits;
+using Circuit = std::function<Bits(AigBitblaster&, const Bits&, const Bits&)>;
+
+/** SAT interface that only counts the added literals. */
+class CountingSatSolver : public SatInterface
+{
+ public:
+  void add(int64_t lit) override { d_num_literals += lit != 0; }
+  void add_clause(const std::initializer_list<int64_t>& literals) override
+  {
+    d_num_literals += literals.size();
+  }
+  bool value(int64_t lit) override
+  {
+    (void) lit;
+    return false;
+  }
+  int32_t fixed(int64_t lit) override
+  {
+    (void) lit;
+    return 0;
+  }
+
+  uint64_t d_num_literals = 0;
+};
+
+/** Bit-blast given circuit over two fresh operands of width state.range(0). */
+void
+bench_bitblast(::benchmark::State& state, const Circuit& circuit)
+{
+  size_t size       = static_cast<size_t>(state.range(0));
+  uint64_t num_ands = 0;
+  for (auto _ : state)
+  {
+    AigBitblaster bb;
+    Bits a = bb.bv_constant(size);
+    Bits b = bb.bv_constant(size);
+    Bits res = circuit(bb, a, b);
+    ::benchmark::DoNotOptimize(res);
+    num_ands = bb.num_aig_ands();
+  }
+  state.counters["ands"] = static_cast<double>(num_ands);
+}
+
+/** Encode given bit-blasted circuit to CNF. */
+void
+bench_encode(::benchmark::State& state, const Circuit& circuit)
+{
+  size_t size = static_cast<size_t>(state.range(0));
+  AigBitblaster bb;
+  Bits a               = bb.bv_constant(size);
+  Bits b               = bb.bv_constant(size);
+  Bits res             = circuit(bb, a, b);
+  uint64_t num_clauses = 0;
+  for (auto _ : state)
+  {
+    CountingSatSolver sat;
+    AigCnfEncoder cnf(sat);
+    for (const auto& bit : res)
+    {
+      cnf.encode(bit);
+    }
+    num_clauses = cnf.statistics().num_clauses;
+  }
+  state.counters["clauses"] = static_cast<double>(num_clauses);
+}
+
+Bits
+mul(AigBitblaster& bb, const Bits& a, const Bits& b)
+{
+  return bb.bv_mul(a, b);
+}
+
+Bits
+udiv(AigBitblaster& bb, const Bits& a, const Bits& b)
+{
+  return bb.bv_udiv(a, b);
+}
+
+Bits
+shl(AigBitblaster& bb, const Bits& a, const Bits& b)
+{
+  return bb.bv_shl(a, b);
+}
+
+Bits
+add(AigBitblaster& bb, const Bits& a, const Bits& b)
+{
+  return bb.bv_add(a, b);
+}
+
+}  // namespace
+
+BENCHMARK_CAPTURE(bench_bitblast, mul, mul)->RangeMultiplier(2)->Range(8, 128);
+BENCHMARK_CAPTURE(bench_bitblast, udiv, udiv)
+    ->RangeMultiplier(2)
+    ->Range(8, 128);
+BENCHMARK_CAPTURE(bench_bitblast, shl, shl)->RangeMultiplier(2)->Range(8, 128);
+BENCHMARK_CAPTURE(bench_bitblast, add, add)->RangeMultiplier(2)->Range(8, 128);
+
+BENCHMARK_CAPTURE(bench_encode, mul, mul)->RangeMultiplier(2)->Range(8, 64);
+BENCHMARK_CAPTURE(bench_encode, udiv, udiv)->RangeMultiplier(2)->Range(8, 64);
+BENCHMARK_CAPTURE(bench_encode, shl, shl)->RangeMultiplier(2)->Range(8, 64);
+
+}  // namespace bzla::benchmark
+
+BENCHMARK_MAIN();
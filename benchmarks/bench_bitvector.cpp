@@ -0,0 +1,132 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "bv/bitvector.h"
+#include "rng/rng.h"
+
+namespace bzla::benchmark {
+
+namespace {
+
+/** Number of random operand pairs, cycled through by each benchmark. */
+constexpr size_t s_num_operands = 64;
+
+/** Generate random operands of given size, divisors are non-zero. */
+std::vector<BitVector>
+mk_operands(uint64_t size, uint32_t seed)
+{
+  RNG rng(seed);
+  std::vector<BitVector> res;
+  for (size_t i = 0; i < s_num_operands; ++i)
+  {
+    BitVector bv(size, rng);
+    if (bv.is_zero())
+    {
+      bv = BitVector::mk_one(size);
+    }
+    res.push_back(bv);
+  }
+  return res;
+}
+
+template <typename F>
+void
+bench_binary(::benchmark::State& state, F op)
+{
+  uint64_t size = static_cast<uint64_t>(state.range(0));
+  auto a        = mk_operands(size, 1);
+  auto b        = mk_operands(size, 2);
+  size_t i      = 0;
+  for (auto _ : state)
+  {
+    ::benchmark::DoNotOptimize(op(a[i], b[i]));
+    i = (i + 1) % s_num_operands;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+#define BZLA_BENCH_BV_BINARY(name, expr)                                \
+  void bv_##name(::benchmark::State& state)                             \
+  {                                                                     \
+    bench_binary(state, [](const BitVector& a, const BitVector& b) {    \
+      return expr;                                                      \
+    });                                                                 \
+  }                                                                     \
+  BENCHMARK(bv_##name)->Arg(64)->Arg(65)->Arg(128)->Arg(256)->Arg(1024)
+
+BZLA_BENCH_BV_BINARY(add, a.bvadd(b));
+BZLA_BENCH_BV_BINARY(and, a.bvand(b));
+BZLA_BENCH_BV_BINARY(xor, a.bvxor(b));
+BZLA_BENCH_BV_BINARY(mul, a.bvmul(b));
+BZLA_BENCH_BV_BINARY(udiv, a.bvudiv(b));
+BZLA_BENCH_BV_BINARY(urem, a.bvurem(b));
+BZLA_BENCH_BV_BINARY(sdiv, a.bvsdiv(b));
+BZLA_BENCH_BV_BINARY(shl, a.bvshl(b));
+BZLA_BENCH_BV_BINARY(ashr, a.bvashr(b));
+BZLA_BENCH_BV_BINARY(ult, a.bvult(b));
+BZLA_BENCH_BV_BINARY(slt, a.bvslt(b));
+BZLA_BENCH_BV_BINARY(eq, a.bveq(b));
+BZLA_BENCH_BV_BINARY(concat, a.bvconcat(b));
+
+void
+bv_iadd(::benchmark::State& state)
+{
+  uint64_t size = static_cast<uint64_t>(state.range(0));
+  auto a        = mk_operands(size, 1);
+  BitVector res = BitVector::mk_zero(size);
+  size_t i      = 0;
+  for (auto _ : state)
+  {
+    res.ibvadd(a[i]);
+    ::benchmark::DoNotOptimize(res);
+    i = (i + 1) % s_num_operands;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(bv_iadd)->Arg(64)->Arg(65)->Arg(128)->Arg(256)->Arg(1024);
+
+void
+bv_extract(::benchmark::State& state)
+{
+  uint64_t size = static_cast<uint64_t>(state.range(0));
+  auto a        = mk_operands(size, 1);
+  size_t i      = 0;
+  for (auto _ : state)
+  {
+    ::benchmark::DoNotOptimize(a[i].bvextract(size - 2, 1));
+    i = (i + 1) % s_num_operands;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(bv_extract)->Arg(64)->Arg(65)->Arg(128)->Arg(256)->Arg(1024);
+
+void
+bv_copy(::benchmark::State& state)
+{
+  uint64_t size = static_cast<uint64_t>(state.range(0));
+  auto a        = mk_operands(size, 1);
+  size_t i      = 0;
+  for (auto _ : state)
+  {
+    BitVector copy(a[i]);
+    ::benchmark::DoNotOptimize(copy);
+    i = (i + 1) % s_num_operands;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(bv_copy)->Arg(64)->Arg(65)->Arg(128)->Arg(256)->Arg(1024);
+
+}  // namespace bzla::benchmark
+
+BENCHMARK_MAIN();
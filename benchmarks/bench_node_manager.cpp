@@ -0,0 +1,136 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "bv/bitvector.h"
+#include "node/node.h"
+#include "node/node_manager.h"
+
+namespace bzla::benchmark {
+
+using namespace node;
+
+namespace {
+
+/** Create given number of bit-vector constants of size 32. */
+std::vector<Node>
+mk_consts(NodeManager& nm, size_t num)
+{
+  Type bv32 = nm.mk_bv_type(32);
+  std::vector<Node> res;
+  for (size_t i = 0; i < num; ++i)
+  {
+    res.push_back(nm.mk_const(bv32));
+  }
+  return res;
+}
+
+}  // namespace
+
+/** Create nodes that are not in the unique table yet (and release them). */
+void
+node_mk_node_new(::benchmark::State& state)
+{
+  NodeManager nm;
+  auto consts = mk_consts(nm, 1024);
+  size_t i = 0, j = 1;
+  for (auto _ : state)
+  {
+    ::benchmark::DoNotOptimize(
+        nm.mk_node(Kind::BV_ADD, {consts[i], consts[j]}));
+    if (++j == consts.size())
+    {
+      i = (i + 1) % consts.size();
+      j = 0;
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(node_mk_node_new);
+
+/** Create nodes that already exist, i.e., unique table hits. */
+void
+node_mk_node_lookup(::benchmark::State& state)
+{
+  NodeManager nm;
+  size_t num  = static_cast<size_t>(state.range(0));
+  auto consts = mk_consts(nm, num);
+  std::vector<Node> nodes;
+  for (size_t i = 0; i < num; ++i)
+  {
+    nodes.push_back(
+        nm.mk_node(Kind::BV_ADD, {consts[i], consts[(i + 1) % num]}));
+  }
+  size_t i = 0;
+  for (auto _ : state)
+  {
+    ::benchmark::DoNotOptimize(
+        nm.mk_node(Kind::BV_ADD, {consts[i], consts[(i + 1) % num]}));
+    i = (i + 1) % num;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(node_mk_node_lookup)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+/** Create indexed nodes that already exist. */
+void
+node_mk_node_indexed_lookup(::benchmark::State& state)
+{
+  NodeManager nm;
+  auto consts = mk_consts(nm, 1024);
+  std::vector<Node> nodes;
+  for (const Node& c : consts)
+  {
+    nodes.push_back(nm.mk_node(Kind::BV_EXTRACT, {c}, {15, 8}));
+  }
+  size_t i = 0;
+  for (auto _ : state)
+  {
+    ::benchmark::DoNotOptimize(
+        nm.mk_node(Kind::BV_EXTRACT, {consts[i]}, {15, 8}));
+    i = (i + 1) % consts.size();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(node_mk_node_indexed_lookup);
+
+/** Create bit-vector values, most of them not in the unique table yet. */
+void
+node_mk_value(::benchmark::State& state)
+{
+  NodeManager nm;
+  uint64_t size = static_cast<uint64_t>(state.range(0));
+  uint64_t i    = 0;
+  for (auto _ : state)
+  {
+    ::benchmark::DoNotOptimize(nm.mk_value(BitVector::from_ui(size, i++)));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(node_mk_value)->Arg(32)->Arg(64)->Arg(128);
+
+/** Create constants. */
+void
+node_mk_const(::benchmark::State& state)
+{
+  NodeManager nm;
+  Type bv32 = nm.mk_bv_type(32);
+  for (auto _ : state)
+  {
+    ::benchmark::DoNotOptimize(nm.mk_const(bv32));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(node_mk_const);
+
+}  // namespace bzla::benchmark
+
+BENCHMARK_MAIN();
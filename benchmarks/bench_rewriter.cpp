@@ -0,0 +1,139 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "bv/bitvector.h"
+#include "env.h"
+#include "node/node_manager.h"
+#include "rewrite/rewriter.h"
+#include "rng/rng.h"
+
+namespace bzla::benchmark {
+
+using namespace node;
+
+namespace {
+
+/**
+ * Generate a random bit-vector DAG over 16 constants with given number of
+ * operator nodes. Operands are picked from all previously created nodes,
+ * which results in a high degree of sharing.
+ * @return The Boolean roots of the DAG.
+ */
+std::vector<Node>
+mk_dag(NodeManager& nm, size_t num_nodes, uint32_t seed)
+{
+  static const std::vector<Kind> s_binary = {Kind::BV_ADD,
+                                             Kind::BV_AND,
+                                             Kind::BV_MUL,
+                                             Kind::BV_OR,
+                                             Kind::BV_SHL,
+                                             Kind::BV_SHR,
+                                             Kind::BV_SUB,
+                                             Kind::BV_UDIV,
+                                             Kind::BV_UREM,
+                                             Kind::BV_XOR};
+  RNG rng(seed);
+  Type bv32 = nm.mk_bv_type(32);
+  std::vector<Node> nodes;
+  for (size_t i = 0; i < 16; ++i)
+  {
+    nodes.push_back(nm.mk_const(bv32));
+  }
+  nodes.push_back(nm.mk_value(BitVector::mk_zero(32)));
+  nodes.push_back(nm.mk_value(BitVector::mk_one(32)));
+  nodes.push_back(nm.mk_value(BitVector::mk_ones(32)));
+
+  auto pick = [&]() { return nodes[rng.pick<size_t>(0, nodes.size() - 1)]; };
+
+  std::vector<Node> roots;
+  for (size_t i = 0; i < num_nodes; ++i)
+  {
+    uint32_t c = rng.pick<uint32_t>(0, 15);
+    if (c < 10)
+    {
+      nodes.push_back(nm.mk_node(s_binary[c], {pick(), pick()}));
+    }
+    else if (c == 10)
+    {
+      nodes.push_back(nm.mk_node(Kind::BV_NOT, {pick()}));
+    }
+    else if (c == 11)
+    {
+      nodes.push_back(nm.mk_node(Kind::BV_NEG, {pick()}));
+    }
+    else if (c == 12)
+    {
+      Node cond = nm.mk_node(Kind::BV_ULT, {pick(), pick()});
+      nodes.push_back(nm.mk_node(Kind::ITE, {cond, pick(), pick()}));
+    }
+    else if (c == 13)
+    {
+      Node lo = nm.mk_node(Kind::BV_EXTRACT, {pick()}, {15, 0});
+      Node hi = nm.mk_node(Kind::BV_EXTRACT, {pick()}, {31, 16});
+      nodes.push_back(nm.mk_node(Kind::BV_CONCAT, {hi, lo}));
+    }
+    else
+    {
+      roots.push_back(nm.mk_node(c == 14 ? Kind::EQUAL : Kind::BV_SLT,
+                                 {pick(), pick()}));
+    }
+  }
+  return roots;
+}
+
+}  // namespace
+
+/** Rewrite a random DAG from scratch, i.e., with an empty rewrite cache. */
+void
+rewriter_rewrite_dag(::benchmark::State& state)
+{
+  NodeManager nm;
+  Env env(nm);
+  auto roots = mk_dag(nm, static_cast<size_t>(state.range(0)), 42);
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    env.rewriter().clear_cache();
+    state.ResumeTiming();
+    for (const Node& root : roots)
+    {
+      ::benchmark::DoNotOptimize(env.rewriter().rewrite(root));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(rewriter_rewrite_dag)->Arg(1 << 8)->Arg(1 << 12)->Arg(1 << 16);
+
+/** Rewrite an already rewritten DAG, i.e., rewrite cache hits only. */
+void
+rewriter_rewrite_cached(::benchmark::State& state)
+{
+  NodeManager nm;
+  Env env(nm);
+  auto roots = mk_dag(nm, 1 << 12, 42);
+  for (const Node& root : roots)
+  {
+    env.rewriter().rewrite(root);
+  }
+  size_t i = 0;
+  for (auto _ : state)
+  {
+    ::benchmark::DoNotOptimize(env.rewriter().rewrite(roots[i]));
+    i = (i + 1) % roots.size();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(rewriter_rewrite_cached);
+
+}  // namespace bzla::benchmark
+
+BENCHMARK_MAIN();
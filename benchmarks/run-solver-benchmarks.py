@@ -0,0 +1,365 @@
+#!/usr/bin/env python3
+###
+# Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+#
+# Copyright (C) 2023 by the authors listed in the AUTHORS file at
+# https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+#
+# This file is part of Bitwuzla under the MIT license. See COPYING for more
+# information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+##
+
+"""
+End-to-end solver benchmark runner.
+
+Subcommand 'run' solves a set of SMT2/BTOR2 instances with the bitwuzla
+binary under a number of option configurations and records wall time, peak
+resident set size, the result and the solver statistics of each run in a
+results file (JSON).
+
+Subcommand 'compare' compares two results files and reports significant
+regressions and improvements. It exits with a non-zero exit code if any
+regression (or result mismatch) was found.
+
+Examples:
+  run-solver-benchmarks.py run -b build/src/main/bitwuzla -o base.json
+  run-solver-benchmarks.py run -b build/src/main/bitwuzla -c prop \\
+      -c 'my-opts=--bv-solver=bitblast --rewrite-level=1' -r 3 -o new.json
+  run-solver-benchmarks.py compare base.json new.json
+"""
+
+import argparse
+import datetime
+import json
+import os
+import statistics
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_INSTANCES = os.path.join(SCRIPT_DIR, 'solver', 'instances.txt')
+
+# Option configurations available by name.
+CONFIGS = {
+    'bitblast-cadical': ['--bv-solver=bitblast', '--sat-solver=cadical'],
+    'bitblast-cms': ['--bv-solver=bitblast', '--sat-solver=cms'],
+    'bitblast-kissat': ['--bv-solver=bitblast', '--sat-solver=kissat'],
+    'prop': ['--bv-solver=prop'],
+    'preprop': ['--bv-solver=preprop', '--sat-solver=cadical'],
+}
+DEFAULT_CONFIGS = ['bitblast-cadical', 'prop', 'preprop']
+
+# Statistics compared by default.
+KEY_STATS = [
+    'solver::bv::bitblast::aig::num_ands',
+    'solver::bv::bitblast::cnf::num_clauses',
+    'solver::engine::lemmas',
+    'solver::quant::mbqi_checks',
+]
+
+SOLVED = ('sat', 'unsat')
+
+
+def error(msg):
+    print('error: {}'.format(msg), file=sys.stderr)
+    sys.exit(1)
+
+
+def read_instances(paths):
+    """Collect instances from given files, directories and instance lists
+    (files with suffix .txt)."""
+    instances = []
+    for path in paths:
+        if os.path.isdir(path):
+            for root, _, files in sorted(os.walk(path)):
+                for f in sorted(files):
+                    if f.endswith(('.smt2', '.btor2')):
+                        instances.append(os.path.join(root, f))
+        elif path.endswith('.txt'):
+            base = os.path.dirname(os.path.abspath(path))
+            with open(path, 'r') as infile:
+                for line in infile:
+                    line = line.strip()
+                    if line and not line.startswith('#'):
+                        instances.append(
+                            os.path.normpath(os.path.join(base, line)))
+        else:
+            instances.append(path)
+    for instance in instances:
+        if not os.path.isfile(instance):
+            error('instance \'{}\' does not exist'.format(instance))
+    return instances
+
+
+def parse_configs(configs):
+    """Parse configurations given as NAME (predefined) or NAME=OPTIONS."""
+    result = {}
+    for config in configs or DEFAULT_CONFIGS:
+        if '=' in config:
+            name, opts = config.split('=', 1)
+            result[name] = opts.split()
+        elif config in CONFIGS:
+            result[config] = CONFIGS[config]
+        else:
+            error('unknown configuration \'{}\', expected one of {} or '
+                  'NAME=OPTIONS'.format(config, ', '.join(CONFIGS)))
+    return result
+
+
+def run_once(binary, instance, opts, time_limit):
+    """Run binary on given instance once, return (status, result, wall time
+    in seconds, peak RSS in KiB, statistics)."""
+    cmd = [binary] + opts + ['--stats-format', 'json', instance]
+    with tempfile.TemporaryFile() as out, tempfile.TemporaryFile() as err:
+        start = time.monotonic()
+        proc = subprocess.Popen(cmd, stdout=out, stderr=err)
+        timed_out = threading.Event()
+
+        def kill():
+            timed_out.set()
+            proc.kill()
+
+        timer = threading.Timer(time_limit, kill)
+        timer.start()
+        # Reap the child ourselves to get its resource usage.
+        _, exit_status, rusage = os.wait4(proc.pid, 0)
+        timer.cancel()
+        wall = time.monotonic() - start
+        proc.returncode = os.waitstatus_to_exitcode(exit_status)
+        out.seek(0)
+        err.seek(0)
+        stdout = out.read().decode(errors='replace')
+        stderr = err.read().decode(errors='replace')
+
+    # ru_maxrss is in bytes on macOS and in KiB everywhere else.
+    rss = rusage.ru_maxrss
+    if sys.platform == 'darwin':
+        rss //= 1024
+
+    results = []
+    stats = {}
+    for line in stdout.splitlines():
+        line = line.strip()
+        if line in ('sat', 'unsat', 'unknown'):
+            results.append(line)
+        elif line.startswith('{"counters"'):
+            snapshot = json.loads(line)
+            stats.update(snapshot.get('counters', {}))
+            for name, val in snapshot.get('timers_ms', {}).items():
+                stats['{}_ms'.format(name)] = val
+
+    if timed_out.is_set():
+        status = 'timeout'
+    elif proc.returncode != 0 or stderr.strip():
+        status = 'error'
+    else:
+        status = 'ok'
+    result = ' '.join(results) if results else None
+    if status == 'error':
+        msg = stderr.strip().splitlines()
+        result = msg[-1] if msg else 'exit code {}'.format(proc.returncode)
+    return status, result, wall, rss, stats
+
+
+def cmd_run(args):
+    binary = os.path.abspath(args.binary)
+    if not os.access(binary, os.X_OK):
+        error('\'{}\' is not executable'.format(args.binary))
+    instances = read_instances(args.instances or [DEFAULT_INSTANCES])
+    configs = parse_configs(args.config)
+
+    version = subprocess.run([binary, '--version'],
+                             stdout=subprocess.PIPE,
+                             stderr=subprocess.DEVNULL).stdout.decode().strip()
+    data = {
+        'binary': binary,
+        'version': version,
+        'date': datetime.datetime.now().isoformat(timespec='seconds'),
+        'time_limit': args.time_limit,
+        'repeat': args.repeat,
+        'configs': configs,
+        'runs': [],
+    }
+
+    ntotal = len(instances) * len(configs)
+    n = 0
+    for name, opts in configs.items():
+        for instance in instances:
+            n += 1
+            times = []
+            rss = 0
+            for _ in range(args.repeat):
+                status, result, wall, mem, stats = run_once(
+                    binary, instance, opts, args.time_limit)
+                times.append(wall)
+                rss = max(rss, mem)
+                # Repeating timeouts and errors is pointless.
+                if status != 'ok':
+                    break
+            run = {
+                'instance': os.path.relpath(instance),
+                'config': name,
+                'status': status,
+                'result': result,
+                'wall_time': statistics.median(times),
+                'wall_times': times,
+                'peak_rss_kb': rss,
+                'stats': stats,
+            }
+            data['runs'].append(run)
+            print('[{}/{}] {:<20} {:<60} {:>8} {:>9.3f}s {:>8} KiB'.format(
+                n, ntotal, name, run['instance'], result or status,
+                run['wall_time'], rss))
+
+    with open(args.output, 'w') as outfile:
+        json.dump(data, outfile, indent=1)
+        outfile.write('\n')
+    print('results written to {}'.format(args.output))
+
+
+def is_significant(old, new, rel, absolute):
+    """True if the change from old to new exceeds both the relative and the
+    absolute threshold."""
+    return abs(new - old) > max(rel * abs(old), absolute)
+
+
+def times_overlap(old, new):
+    """True if the ranges of repeated measurements overlap, i.e., if the
+    difference between the medians may be noise."""
+    if len(old) < 2 or len(new) < 2:
+        return False
+    return min(new) <= max(old) and min(old) <= max(new)
+
+
+def cmd_compare(args):
+    with open(args.base, 'r') as infile:
+        base = json.load(infile)
+    with open(args.new, 'r') as infile:
+        new = json.load(infile)
+    key_stats = args.stat or KEY_STATS
+
+    base_runs = {(r['config'], r['instance']): r for r in base['runs']}
+    new_runs = {(r['config'], r['instance']): r for r in new['runs']}
+
+    regressions = []
+    improvements = []
+    mismatches = []
+    ratios = []
+    for key in sorted(base_runs.keys() & new_runs.keys()):
+        b = base_runs[key]
+        n = new_runs[key]
+        label = '{} {}'.format(*key)
+        b_solved = b['status'] == 'ok' and b['result'] in SOLVED
+        n_solved = n['status'] == 'ok' and n['result'] in SOLVED
+
+        if b_solved and n_solved and b['result'] != n['result']:
+            mismatches.append('{}: {} -> {}'.format(label, b['result'],
+                                                    n['result']))
+            continue
+        if b_solved != n_solved:
+            msg = '{}: {} -> {}'.format(label, b['result'] or b['status'],
+                                        n['result'] or n['status'])
+            (improvements if n_solved else regressions).append(msg)
+            continue
+        if not b_solved:
+            continue
+
+        bt, nt = b['wall_time'], n['wall_time']
+        ratios.append(max(nt, 1e-3) / max(bt, 1e-3))
+        if (is_significant(bt, nt, args.time_threshold, args.min_time)
+                and not times_overlap(b['wall_times'], n['wall_times'])):
+            msg = '{}: time {:.3f}s -> {:.3f}s ({:+.1f}%)'.format(
+                label, bt, nt, 100 * (nt - bt) / max(bt, 1e-9))
+            (regressions if nt > bt else improvements).append(msg)
+
+        bm, nm = b['peak_rss_kb'], n['peak_rss_kb']
+        if is_significant(bm, nm, args.memory_threshold, args.min_memory):
+            msg = '{}: peak RSS {} KiB -> {} KiB ({:+.1f}%)'.format(
+                label, bm, nm, 100 * (nm - bm) / max(bm, 1))
+            (regressions if nm > bm else improvements).append(msg)
+
+        for stat in key_stats:
+            if stat not in b['stats'] or stat not in n['stats']:
+                continue
+            bs, ns = b['stats'][stat], n['stats'][stat]
+            if is_significant(bs, ns, args.stat_threshold, 0):
+                msg = '{}: {} {} -> {}'.format(label, stat, bs, ns)
+                (regressions if ns > bs else improvements).append(msg)
+
+    print('base: {} ({})'.format(args.base, base.get('version', '?')))
+    print('new:  {} ({})'.format(args.new, new.get('version', '?')))
+    only = len(base_runs.keys() ^ new_runs.keys())
+    if only:
+        print('{} runs only present in one of the results files'.format(only))
+    for title, msgs in (('Result mismatches', mismatches),
+                        ('Regressions', regressions),
+                        ('Improvements', improvements)):
+        print('\n{} ({}):'.format(title, len(msgs)))
+        for msg in msgs:
+            print('  {}'.format(msg))
+    if ratios:
+        print('\nGeometric mean of wall time ratio new/base over {} '
+              'instances solved by both: {:.3f}'.format(
+                  len(ratios), statistics.geometric_mean(ratios)))
+
+    if mismatches or regressions:
+        sys.exit(1)
+
+
+def main():
+    ap = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = ap.add_subparsers(dest='command', required=True)
+
+    ap_run = sub.add_parser('run', help='run benchmarks')
+    ap_run.add_argument('-b', '--binary', required=True,
+                        help='bitwuzla binary')
+    ap_run.add_argument('instances', nargs='*',
+                        help='instances, directories or instance lists '
+                             '(*.txt), default: {}'.format(
+                                 os.path.relpath(DEFAULT_INSTANCES)))
+    ap_run.add_argument('-c', '--config', action='append',
+                        help='configuration NAME=OPTIONS or one of {}, '
+                             'default: {}'.format(', '.join(CONFIGS),
+                                                  ', '.join(DEFAULT_CONFIGS)))
+    ap_run.add_argument('-t', '--time-limit', type=float, default=60,
+                        help='time limit per run in seconds (default: 60)')
+    ap_run.add_argument('-r', '--repeat', type=int, default=1,
+                        help='number of runs per instance (default: 1)')
+    ap_run.add_argument('-o', '--output', default='results.json',
+                        help='results file (default: results.json)')
+
+    ap_cmp = sub.add_parser('compare', help='compare two results files')
+    ap_cmp.add_argument('base', help='baseline results file')
+    ap_cmp.add_argument('new', help='new results file')
+    ap_cmp.add_argument('--time-threshold', type=float, default=0.1,
+                        help='relative wall time threshold (default: 0.1)')
+    ap_cmp.add_argument('--min-time', type=float, default=0.1,
+                        help='absolute wall time threshold in seconds '
+                             '(default: 0.1)')
+    ap_cmp.add_argument('--memory-threshold', type=float, default=0.1,
+                        help='relative peak RSS threshold (default: 0.1)')
+    ap_cmp.add_argument('--min-memory', type=int, default=10240,
+                        help='absolute peak RSS threshold in KiB '
+                             '(default: 10240)')
+    ap_cmp.add_argument('--stat-threshold', type=float, default=0.05,
+                        help='relative statistics threshold (default: 0.05)')
+    ap_cmp.add_argument('--stat', action='append',
+                        help='statistic to compare, default: {}'.format(
+                            ', '.join(KEY_STATS)))
+
+    args = ap.parse_args()
+    if args.command == 'run':
+        if args.repeat < 1:
+            error('number of runs must be at least 1')
+        cmd_run(args)
+    else:
+        cmd_compare(args)
+
+
+if __name__ == '__main__':
+    main()
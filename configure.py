@@ -89,9 +89,11 @@ def main():
     bool_opt(ap, 'testing', 'regression and unit testing')
     bool_opt(ap, 'unit-testing', 'unit testing')
     bool_opt(ap, 'docs', 'documentation')
+    bool_opt(ap, 'benchmarks', 'microbenchmarks')
     ap.add_argument('--wipe', action='store_true',
                     help='delete build directory if it already exists')
     bool_opt(ap, 'kissat', 'Kissat support')
+    bool_opt(ap, 'trace', 'trace span recording')
     args = ap.parse_args()
 
     build_opts = []
@@ -127,12 +129,16 @@ def main():
         build_opts.append(f'-Dpython={_bool(args.python)}')
     if args.docs is not None:
         build_opts.append(f'-Ddocs={_bool(args.docs)}')
+    if args.benchmarks is not None:
+        build_opts.append(f'-Dbenchmarks={_bool(args.benchmarks)}')
     if sanitize:
         build_opts.append(f'-Db_sanitize={",".join(sanitize)}')
     if args.wipe and os.path.exists(args.build_dir):
         shutil.rmtree(args.build_dir)
     if args.kissat is not None:
         build_opts.append(f'-Dkissat={_bool(args.kissat)}')
+    if args.trace is not None:
+        build_opts.append(f'-Dtrace={_bool(args.trace)}')
 
     configure_build(args.build_dir, build_opts)
 
@@ -72,7 +72,10 @@ struct BitwuzlaOptionInfo
   const char *lng;
   /** Option description. */
   const char *description;
-  /** Indicates whether values are numeric or strings. */
+  /**
+   * Indicates whether values are numeric or strings. String options are
+   * represented as options with modes without any available modes.
+   */
   bool is_numeric;
 
   struct NumericValue
@@ -162,6 +165,14 @@ bool bitwuzla_option_is_numeric(BitwuzlaOptions *options,
  * @return True if the given option is an option with a mode.
  */
 bool bitwuzla_option_is_mode(BitwuzlaOptions *options, BitwuzlaOption option);
+/**
+ * Determine if a given option is a string option.
+ * @param options The Bitwuzla options instance.
+ * @param option The option.
+ * @return True if the given option is a string option.
+ */
+bool bitwuzla_option_is_string(BitwuzlaOptions *options,
+                               BitwuzlaOption option);
 
 /**
  * Set option.
@@ -193,6 +204,21 @@ void bitwuzla_set_option_mode(BitwuzlaOptions *options,
                               BitwuzlaOption option,
                               const char *val);
 
+/**
+ * Set option value for string options.
+ *
+ * @param options The Bitwuzla options instance.
+ * @param option The option.
+ * @param val The option string value.
+ *
+ * @see
+ *   * `BitwuzlaOption`
+ *   * `bitwuzla_get_option_str`
+ */
+void bitwuzla_set_option_str(BitwuzlaOptions *options,
+                             BitwuzlaOption option,
+                             const char *val);
+
 /**
  * Get the current value of an option.
  *
@@ -221,6 +247,21 @@ uint64_t bitwuzla_get_option(BitwuzlaOptions *options, BitwuzlaOption option);
 const char *bitwuzla_get_option_mode(BitwuzlaOptions *options,
                                      BitwuzlaOption option);
 
+/**
+ * Get the current value of a string option.
+ *
+ * @param options The Bitwuzla options instance.
+ * @param option The option.
+ *
+ * @return The option value.
+ *
+ * @see
+ *   * `BitwuzlaOption`
+ *   * `bitwuzla_set_option_str`
+ */
+const char *bitwuzla_get_option_str(BitwuzlaOptions *options,
+                                    BitwuzlaOption option);
+
 /**
  * Get the details of an option.
  *
@@ -1411,6 +1452,29 @@ BitwuzlaResult bitwuzla_check_sat_assuming(Bitwuzla *bitwuzla,
  */
 BitwuzlaTerm bitwuzla_get_value(Bitwuzla *bitwuzla, BitwuzlaTerm term);
 
+/**
+ * Get terms representing the model values of given terms.
+ *
+ * Requires that the last `bitwuzla_check_sat()` query returned
+ * `::BITWUZLA_SAT`.
+ *
+ * @note This is more efficient than querying the values of many terms via
+ *       `bitwuzla_get_value()` one by one.
+ *
+ * @param bitwuzla The Bitwuzla instance.
+ * @param size The number of terms in `terms`.
+ * @param terms The terms to query model values for.
+ *
+ * @return An array of size `size` with the terms representing the model
+ *         values of `terms`, in the same order as `terms`. Only valid until
+ *         the next `bitwuzla_get_values` call.
+ *
+ * @see `bitwuzla_check_sat`
+ */
+BitwuzlaTerm *bitwuzla_get_values(Bitwuzla *bitwuzla,
+                                  size_t size,
+                                  BitwuzlaTerm terms[]);
+
 /**
  * Print the current input formula.
  *
@@ -1450,6 +1514,22 @@ void bitwuzla_get_statistics(Bitwuzla *bitwuzla,
                              const char ***values,
                              size_t *size);
 
+/**
+ * Print current statistics to the given file.
+ *
+ * @param bitwuzla The Bitwuzla instance.
+ * @param format   The output format for printing the statistics, either
+ *                 `"json"` or `"prometheus"` for the Prometheus text
+ *                 exposition format.
+ * @param file     The file to print the statistics to.
+ *
+ * @note This may be called from a different thread while
+ *       `bitwuzla_check_sat()` is running to monitor solving progress.
+ */
+void bitwuzla_print_statistics(Bitwuzla *bitwuzla,
+                               const char *format,
+                               FILE *file);
+
 /**
  * Get term manager instance.
  *
@@ -1997,6 +2077,45 @@ BitwuzlaTerm bitwuzla_mk_term(BitwuzlaTermManager *tm,
                               uint32_t argc,
                               BitwuzlaTerm args[]);
 
+/**
+ * Create a DAG of terms from a flat array of instructions.
+ *
+ * The instruction array is a sequence of records, one record per term to
+ * create, of the form
+ *
+ *   kind, n, arg_0, ..., arg_{n-1}, m, idx_0, ..., idx_{m-1}
+ *
+ * where `kind` is the operator kind, `n` the number of arguments and `m`
+ * the number of indices. An argument `arg_i < num_leaves` refers to
+ * `leaves[arg_i]`, any other argument refers to the term created by record
+ * `arg_i - num_leaves`, which must precede the referring record (i.e.,
+ * records are expected in topological order).
+ *
+ * This is equivalent to calling `bitwuzla_mk_term()` for each record in
+ * order, but avoids the per-call overhead when creating large terms.
+ *
+ * @param tm The term manager instance.
+ * @param num_leaves The number of leaf terms in `leaves`.
+ * @param leaves The leaf terms referred to by the instructions.
+ * @param size The size of the instruction array.
+ * @param instructions The instruction records.
+ * @param num_terms Output parameter, stores the number of created terms.
+ *
+ * @return An array of size `num_terms` with the terms created for each
+ *         record, in the order of the records. Only valid until the next
+ *         `bitwuzla_mk_terms` call.
+ *
+ * @see
+ *   * `bitwuzla_mk_term`
+ *   * `BitwuzlaKind`
+ */
+BitwuzlaTerm *bitwuzla_mk_terms(BitwuzlaTermManager *tm,
+                                size_t num_leaves,
+                                BitwuzlaTerm leaves[],
+                                size_t size,
+                                const uint64_t instructions[],
+                                size_t *num_terms);
+
 /**
  * Create an indexed term of given kind with one argument term and one index.
  *
@@ -215,6 +215,12 @@ class Options
    * @return True if `option` is an option with a mode.
    */
   bool is_mode(Option option) const;
+  /**
+   * Determine if given option is a string option.
+   * @param option The option to query.
+   * @return True if `option` is a string option.
+   */
+  bool is_string(Option option) const;
 
   /** @return The short name of this option. */
   const char *shrt(Option option) const;
@@ -237,17 +243,17 @@ class Options
    */
   void set(Option option, uint64_t value);
   /**
-   * Set option value for options with different modes.
+   * Set option value for options with different modes or string options.
    *
    * @param option The option.
-   * @param mode The option mode.
+   * @param mode The option mode or string value.
    */
   void set(Option option, const std::string &mode);
   /**
-   * Set option value for options with different modes.
+   * Set option value for options with different modes or string options.
    *
    * @param option The option.
-   * @param mode The option mode.
+   * @param mode The option mode or string value.
    */
   void set(Option option, const char *mode);
   /**
@@ -290,6 +296,13 @@ class Options
    * @return The option value.
    */
   const std::string &get_mode(Option option) const;
+  /**
+   * Get the current value of a string option.
+   *
+   * @param option The option.
+   * @return The option value.
+   */
+  const std::string &get_str(Option option) const;
 
  private:
   /** The wrapped internal options. */
@@ -310,6 +323,8 @@ struct OptionInfo
     NUMERIC,
     /*! Option with configuration modes. */
     MODE,
+    /*! String option (string configuration value). */
+    STRING,
   };
 
   /** The option value data of a Boolean option. */
@@ -342,6 +357,14 @@ struct OptionInfo
     /** List of available modes. */
     std::vector<std::string> modes;
   };
+  /** The option value data of a string option. */
+  struct String
+  {
+    /** Current string option value. */
+    std::string cur;
+    /** Default string option value. */
+    std::string dflt;
+  };
 
   /**
    * Constructor.
@@ -366,7 +389,7 @@ struct OptionInfo
   const char *description;
 
   /** The values. */
-  std::variant<Bool, Numeric, Mode> values;
+  std::variant<Bool, Numeric, Mode, String> values;
 
   /**
    * Additionall getter for values.
@@ -398,6 +421,13 @@ OptionInfo::Numeric OptionInfo::value() const;
 template <>
 OptionInfo::Mode OptionInfo::value() const;
 
+/**
+ * Get String option info wrapper.
+ * @return The option info wrapper.
+ */
+template <>
+OptionInfo::String OptionInfo::value() const;
+
 /* -------------------------------------------------------------------------- */
 /* Result                                                                     */
 /* -------------------------------------------------------------------------- */
@@ -1379,6 +1409,35 @@ class TermManager
                const std::vector<Term> &args,
                const std::vector<uint64_t> &indices = {});
 
+  /**
+   * Create a DAG of terms from a flat array of instructions.
+   *
+   * The instruction array is a sequence of records, one record per term to
+   * create, of the form
+   *
+   *   kind, n, arg_0, ..., arg_{n-1}, m, idx_0, ..., idx_{m-1}
+   *
+   * where `kind` is the operator kind, `n` the number of arguments and `m`
+   * the number of indices. An argument `arg_i < leaves.size()` refers to
+   * `leaves[arg_i]`, any other argument refers to the term created by record
+   * `arg_i - leaves.size()`, which must precede the referring record (i.e.,
+   * records are expected in topological order).
+   *
+   * This is equivalent to calling `TermManager::mk_term()` for each record
+   * in order, but avoids the per-call overhead when creating large terms.
+   *
+   * @param leaves The leaf terms referred to by the instructions.
+   * @param instructions The instruction records.
+   *
+   * @return The terms created for each record, in the order of the records.
+   *
+   * @see
+   *   * `TermManager::mk_term()`
+   *   * `Kind`
+   */
+  std::vector<Term> mk_terms(const std::vector<Term> &leaves,
+                             const std::vector<uint64_t> &instructions);
+
   /**
    * Create a (first-order) constant of given sort with given symbol.
    *
@@ -1622,6 +1681,22 @@ class Bitwuzla
    */
   Term get_value(const Term &term);
 
+  /**
+   * Get terms representing the model values of given terms.
+   *
+   * Requires that the last `check_sat()` query returned
+   * `Result::SAT`.
+   *
+   * @note This is more efficient than querying the values of many terms via
+   *       `get_value()` one by one.
+   *
+   * @param terms The terms to query model values for.
+   * @return The terms representing the model values of `terms`, in the same
+   *         order as `terms`.
+   * @see `check_sat()`
+   */
+  std::vector<Term> get_values(const std::vector<Term> &terms);
+
   /**
    * Print the current input formula to the given output stream.
    *
@@ -1639,6 +1714,23 @@ class Bitwuzla
    */
   std::map<std::string, std::string> statistics() const;
 
+  /**
+   * Print current statistics to the given output stream.
+   *
+   * Counters and timers are printed as numbers and histograms as maps from
+   * counted value to counter.
+   *
+   * @param out    The output stream.
+   * @param format The output format for printing the statistics, either
+   *               `"json"` or `"prometheus"` for the Prometheus text
+   *               exposition format.
+   *
+   * @note This may be called from a different thread while check_sat() is
+   *       running to monitor solving progress.
+   */
+  void print_statistics(std::ostream &out,
+                        const std::string &format = "json") const;
+
   /** @return The associated term manager instance. */
   TermManager &term_mgr();
 
@@ -100,9 +100,49 @@ enum ENUM(Option)
    *  * An unsigned integer for the memory limit in MB. [**default**: 0]
    */
   EVALUE(MEMORY_LIMIT),
+  /*! **Interval in milliseconds at which resource limits are checked.**
+   *
+   * Time and memory limits are checked asynchronously at this interval
+   * while solving.
+   *
+   * Values:
+   *  * An unsigned integer greater than zero. [**default**: 10]
+   *
+   *  @warning This is an expert option to configure resource limits.
+   */
+  EVALUE(RESOURCE_CHECK_INTERVAL),
 
   /* ---------------- Bitwuzla-specific Options ----------------------------- */
 
+  /*! **Lazy bit-blasting of expensive bit-vector operators.**
+   *
+   * When enabled, multiplication (if no operand is a value), unsigned
+   * division and unsigned remainder are not bit-blasted eagerly. They are
+   * abstracted by fresh bits, and only bit-blasted if the value of the
+   * abstraction in the current SAT model is inconsistent with the values of
+   * their operands.
+   *
+   * Values:
+   *  * **1**: enable
+   *  * **0**: disable [**default**]
+   *
+   *  @note Only applies to the bit-blasting engine.
+   */
+  EVALUE(BV_ABSTRACTION),
+  /*! **Configure the bit-blasting encoding of bit-vector multiplication.**
+   *
+   * Values:
+   *  * **shift-add**: Shift-and-add array multiplier. [**default**]
+   *  * **dadda**: Dadda tree multiplier. Multiplication with a value is
+   *               encoded as a sum of shifted rows over the canonical signed
+   *               digit representation of the value.
+   *  * **karatsuba**: Karatsuba splitting for wide operands with at most
+   *                   half of their bits significant (e.g., zero-extended
+   *                   operands), otherwise as **dadda**.
+   *
+   *  @warning This is an expert option to configure bit-blasting.
+   */
+  EVALUE(BV_MUL_ENCODING),
   /*! **Configure the bit-vector solver engine.**
    *
    * Values:
@@ -139,6 +179,68 @@ enum ENUM(Option)
    *    [Lingeling](https://github.com/arminbiere/lingeling)
    */
   EVALUE(SAT_SOLVER),
+  /*! **Lazy floating-point abstraction.**
+   *
+   * When enabled, floating-point multiplication, division, fused
+   * multiply-add, square root and remainder are not word-blasted eagerly.
+   * They are abstracted by fresh values constrained by cheap special value
+   * and sign rules, and only word-blasted if the current model violates the
+   * floating-point semantics of the operation.
+   *
+   * Values:
+   *  * **1**: enable
+   *  * **0**: disable [**default**]
+   */
+  EVALUE(FP_ABSTRACTION),
+  /*! **Reuse the previous model in incremental mode.**
+   *
+   * When enabled, the values of the constants in the assertions are recorded
+   * after each satisfiable check. Subsequent checks first evaluate the
+   * assertions and assumptions added since then under these values. If they
+   * are all satisfied, the check returns sat immediately and keeps the
+   * recorded model, without preprocessing or solving. The recorded model
+   * remains valid across pops. Models are not recorded if the assertions
+   * contain quantifiers, arrays, functions or uninterpreted sorts.
+   *
+   * @note The model returned by a check that reuses the recorded model may
+   *       differ from the model a full check would produce.
+   *
+   * Values:
+   *  * **1**: enable
+   *  * **0**: disable [**default**]
+   */
+  EVALUE(MODEL_REUSE),
+  /*! **Decision limit for SAT solver calls.**
+   *
+   * Limit the number of decisions of each call to the SAT solver. If the
+   * limit is reached, the satisfiability check returns unknown.
+   *
+   * Values:
+   *  * An unsigned integer value, 0 for no limit. [**default**: 0]
+   *
+   *  @note Only supported by CaDiCaL and Kissat.
+   */
+  EVALUE(SAT_DECISION_LIMIT),
+  /*! **Trace SAT solver proofs.**
+   *
+   * Trace the clausal proof of the SAT solver used for bit-blasting to the
+   * given file, in the format configured via option `SAT_PROOF_FORMAT`.
+   * An empty file name disables proof tracing.
+   *
+   * Values:
+   *  * A file name. [**default**: empty]
+   *
+   *  @note Only supported by CaDiCaL and only for bit-blasting solver
+   *        configurations (bv solver engine `bitblast` or `preprop`).
+   */
+  EVALUE(SAT_PROOF_FILE),
+  /*! **Format of traced SAT solver proofs.**
+   *
+   * Values:
+   *  * **drat**: DRAT [**default**]
+   *  * **lrat**: LRAT
+   */
+  EVALUE(SAT_PROOF_FORMAT),
 
   /* ---------------- BV: Prop Engine Options (Expert) ---------------------- */
 
@@ -269,6 +371,124 @@ enum ENUM(Option)
    *  @warning This is an expert option to configure the prop solver engine.
    */
   EVALUE(PROP_NORMALIZE),
+  /*! **Propagation-based local search solver engine:
+   *    Fixed-point constant bits propagation.**
+   *
+   * When enabled, constant bits implied by top-level constraints are
+   * propagated over the whole formula to a fixed point before local search,
+   * and the resulting constant bits of inputs are fixed. Constant bits are
+   * propagated through bit-level operators, and derived from the value
+   * ranges of the operands of inequalities.
+   *
+   * Values:
+   *  * **1**: enable [**default**]
+   *  * **0**: disable
+   *
+   *  @warning This is an expert option to configure the prop solver engine.
+   */
+  EVALUE(PROP_FIXPOINT),
+  /*! **Propagation-based local search solver engine:
+   *    Number of candidate moves.**
+   *
+   * Configure the number of candidate moves to select from in each move.
+   * Candidates are compared by the number of unsatisfied roots after the
+   * move, and then by a score that measures how close unsatisfied roots are
+   * to being satisfied. Scores are cached per root and only updated for
+   * roots in the cone of influence of a move. Score-based move selection is
+   * disabled if 1.
+   *
+   * Values:
+   *  * An unsigned integer value <= 100. [**default**: 1]
+   *
+   *  @warning This is an expert option to configure the prop solver engine.
+   */
+  EVALUE(PROP_CAND_MOVES),
+  /*! **Propagation-based local search solver engine:
+   *    Probability for perturbing inputs on restart.**
+   *
+   * Configure the probability with which an input is assigned a random
+   * value on restart (see **PROP_RESTARTS**). A value of 1000 corresponds to
+   * a full random restart.
+   *
+   * Values:
+   *  * An unsigned integer value <= 1000 (= 100%). [**default**: 100]
+   *
+   *  @warning This is an expert option to configure the prop solver engine.
+   */
+  EVALUE(PROP_PROB_PERTURB),
+  /*! **Propagation-based local search solver engine:
+   *    Luby restarts.**
+   *
+   * Configure the number of moves of the unit restart interval. The i-th
+   * restart is performed after the given number of moves times the i-th
+   * element of the Luby sequence since the previous restart. On restart, a
+   * random subset of the inputs is assigned random values (see
+   * **PROP_PROB_PERTURB**). Restarts are disabled if 0.
+   *
+   * Values:
+   *  * An unsigned integer value. [**default**: 0]
+   *
+   *  @warning This is an expert option to configure the prop solver engine.
+   */
+  EVALUE(PROP_RESTARTS),
+  /*! **Propagation-based local search solver engine:
+   *    Tabu tenure.**
+   *
+   * Configure the number of moves an input is tabu after its assignment was
+   * updated. Moves on tabu inputs are rejected unless no move on a non-tabu
+   * input is found after a fixed number of attempts. The tabu list is
+   * disabled if 0.
+   *
+   * Values:
+   *  * An unsigned integer value. [**default**: 0]
+   *
+   *  @warning This is an expert option to configure the prop solver engine.
+   */
+  EVALUE(PROP_TABU),
+  /*! **Propagation-based local search solver engine:
+   *    Fix bits implied by the SAT solver.**
+   *
+   * When enabled, input bits that are fixed at the top level of the SAT
+   * solver of the bit-blasting engine are fixed as constant bits for local
+   * search in preprop mode. Requires a previous call to the SAT solver, e.g.,
+   * via **PROP_SAT_SLICE** or in incremental mode.
+   *
+   * Values:
+   *  * **1**: enable [**default**]
+   *  * **0**: disable
+   *
+   *  @warning This is an expert option to configure the prop solver engine.
+   */
+  EVALUE(PROP_SAT_FIXED),
+  /*! **Propagation-based local search solver engine:
+   *    Seed SAT phases.**
+   *
+   * When enabled, the SAT solver of the bit-blasting engine uses the
+   * assignment with the fewest unsatisfied roots found by local search as
+   * preferred phases if the preprop engine falls back to bit-blasting.
+   *
+   * Values:
+   *  * **1**: enable [**default**]
+   *  * **0**: disable
+   *
+   *  @warning This is an expert option to configure the prop solver engine.
+   */
+  EVALUE(PROP_SAT_PHASES),
+  /*! **Propagation-based local search solver engine:
+   *    Alternate between local search and bit-blasting.**
+   *
+   * Configure the conflict limit of the first SAT solver call when the
+   * preprop engine alternates between local search and bit-blasting. The
+   * conflict limit is doubled for each subsequent SAT solver call. No
+   * alternation, i.e., a single unbounded SAT solver call after local search,
+   * if 0.
+   *
+   * Values:
+   *  * An unsigned integer value. [**default**: 0]
+   *
+   *  @warning This is an expert option to configure the prop solver engine.
+   */
+  EVALUE(PROP_SAT_SLICE),
 
   /*! **Preprocessing**
    *
@@ -288,6 +508,28 @@ enum ENUM(Option)
    *  * **0**: disable
    */
   EVALUE(PP_CONTRADICTING_ANDS),
+  /*! **Preprocessing: Eager array elimination**
+   *
+   * When enabled, eagerly eliminates arrays with a small index domain by
+   * expanding them into fresh element constants, and Ackermannizes arrays
+   * that are only read from a few times. The size limit is configured via
+   * option ::EVALUE(PP_ELIM_ARRAYS_THRESH).
+   *
+   * Values:
+   *  * **1**: enable
+   *  * **0**: disable [**default**]
+   */
+  EVALUE(PP_ELIM_ARRAYS),
+  /*! **Preprocessing: Eager array elimination: Threshold**
+   *
+   * The maximum size of the index domain of arrays that are expanded, and the
+   * maximum number of reads of arrays that are Ackermannized if option
+   * ::EVALUE(PP_ELIM_ARRAYS) is enabled.
+   *
+   * Values:
+   *  * An unsigned integer value > 0 [**default**: 16].
+   */
+  EVALUE(PP_ELIM_ARRAYS_THRESH),
   /*! **Preprocessing: Eliminate bit-vector extracts on bit-vector constants**
    *
    * When enabled, eliminates bit-vector extracts on constants.
@@ -314,6 +556,19 @@ enum ENUM(Option)
    *  * **0**: disable
    */
   EVALUE(PP_FLATTEN_AND),
+  /*! **Preprocessing: Known bits**
+   *
+   * When enabled, computes the known bits and value ranges of bit-vector
+   * terms implied by the assertions. Constants with known bits are replaced
+   * by a concatenation of their known bits and fresh constants for the
+   * unknown bits, and terms whose value is fully determined are replaced by
+   * their value.
+   *
+   * Values:
+   *  * **1**: enable
+   *  * **0**: disable [**default**]
+   */
+  EVALUE(PP_KNOWN_BITS),
   /*! **Preprocessing: Normalization**
    *
    * Values:
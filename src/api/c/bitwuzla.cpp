@@ -198,6 +198,17 @@ bitwuzla_option_is_mode(BitwuzlaOptions *options, BitwuzlaOption option)
   return res;
 }
 
+bool
+bitwuzla_option_is_string(BitwuzlaOptions *options, BitwuzlaOption option)
+{
+  bool res = false;
+  BITWUZLA_TRY_CATCH_BEGIN;
+  BITWUZLA_CHECK_NOT_NULL(options);
+  res = options->d_options.is_string(static_cast<bitwuzla::Option>(option));
+  BITWUZLA_TRY_CATCH_END;
+  return res;
+}
+
 void
 bitwuzla_set_option(BitwuzlaOptions *options,
                     BitwuzlaOption option,
@@ -219,6 +230,23 @@ bitwuzla_set_option_mode(BitwuzlaOptions *options,
   BITWUZLA_CHECK_NOT_NULL(options);
   BITWUZLA_CHECK_OPTION(option);
   BITWUZLA_CHECK_NOT_NULL(value);
+  BITWUZLA_CHECK(options->d_options.is_mode(import_option(option)))
+      << "expected option with option modes";
+  options->d_options.set(import_option(option), value);
+  BITWUZLA_TRY_CATCH_END;
+}
+
+void
+bitwuzla_set_option_str(BitwuzlaOptions *options,
+                        BitwuzlaOption option,
+                        const char *value)
+{
+  BITWUZLA_TRY_CATCH_BEGIN;
+  BITWUZLA_CHECK_NOT_NULL(options);
+  BITWUZLA_CHECK_OPTION(option);
+  BITWUZLA_CHECK_NOT_NULL(value);
+  BITWUZLA_CHECK(options->d_options.is_string(import_option(option)))
+      << "expected string option";
   options->d_options.set(import_option(option), value);
   BITWUZLA_TRY_CATCH_END;
 }
@@ -247,6 +275,18 @@ bitwuzla_get_option_mode(BitwuzlaOptions *options, BitwuzlaOption option)
   return res;
 }
 
+const char *
+bitwuzla_get_option_str(BitwuzlaOptions *options, BitwuzlaOption option)
+{
+  const char *res = nullptr;
+  BITWUZLA_TRY_CATCH_BEGIN;
+  BITWUZLA_CHECK_NOT_NULL(options);
+  BITWUZLA_CHECK_OPTION(option);
+  res = options->d_options.get_str(import_option(option)).c_str();
+  BITWUZLA_TRY_CATCH_END;
+  return res;
+}
+
 void
 bitwuzla_get_option_info(BitwuzlaOptions *options,
                          BitwuzlaOption option,
@@ -265,7 +305,8 @@ bitwuzla_get_option_info(BitwuzlaOptions *options,
   info->shrt        = cpp_info.shrt;
   info->lng         = cpp_info.lng;
   info->description = cpp_info.description;
-  info->is_numeric = cpp_info.kind != bitwuzla::OptionInfo::Kind::MODE;
+  info->is_numeric = cpp_info.kind != bitwuzla::OptionInfo::Kind::MODE
+                     && cpp_info.kind != bitwuzla::OptionInfo::Kind::STRING;
 
   if (info->is_numeric)
   {
@@ -290,6 +331,15 @@ bitwuzla_get_option_info(BitwuzlaOptions *options,
           std::get<bitwuzla::OptionInfo::Numeric>(cpp_info.values).max;
     }
   }
+  else if (cpp_info.kind == bitwuzla::OptionInfo::Kind::STRING)
+  {
+    info->mode.cur =
+        std::get<bitwuzla::OptionInfo::String>(cpp_info.values).cur.c_str();
+    info->mode.dflt =
+        std::get<bitwuzla::OptionInfo::String>(cpp_info.values).dflt.c_str();
+    info->mode.num_modes = 0;
+    info->mode.modes     = nullptr;
+  }
   else
   {
     info->mode.cur =
@@ -550,6 +600,35 @@ bitwuzla_get_value(Bitwuzla *bitwuzla, BitwuzlaTerm term)
   return res;
 }
 
+BitwuzlaTerm *
+bitwuzla_get_values(Bitwuzla *bitwuzla, size_t size, BitwuzlaTerm terms[])
+{
+  static thread_local std::vector<BitwuzlaTerm> res;
+  BITWUZLA_TRY_CATCH_BEGIN;
+  BITWUZLA_CHECK_NOT_NULL(bitwuzla);
+  if (size > 0)
+  {
+    BITWUZLA_CHECK_NOT_NULL(terms);
+  }
+  res.clear();
+  std::vector<bitwuzla::Term> cterms;
+  cterms.reserve(size);
+  for (size_t i = 0; i < size; ++i)
+  {
+    BITWUZLA_CHECK_TERM_AT_IDX(terms, i);
+    cterms.push_back(BitwuzlaTermManager::import_term(terms[i]));
+  }
+  auto values = bitwuzla->d_bitwuzla->get_values(cterms);
+  auto tm     = bitwuzla->d_tm;
+  res.reserve(values.size());
+  for (auto &value : values)
+  {
+    res.push_back(tm->export_term(value));
+  }
+  BITWUZLA_TRY_CATCH_END;
+  return size > 0 ? res.data() : nullptr;
+}
+
 void
 bitwuzla_print_formula(Bitwuzla *bitwuzla,
                        const char *format,
@@ -596,6 +675,19 @@ bitwuzla_get_statistics(Bitwuzla *bitwuzla,
   BITWUZLA_TRY_CATCH_END;
 }
 
+void
+bitwuzla_print_statistics(Bitwuzla *bitwuzla, const char *format, FILE *file)
+{
+  BITWUZLA_TRY_CATCH_BEGIN;
+  BITWUZLA_CHECK_NOT_NULL(bitwuzla);
+  BITWUZLA_CHECK_NOT_NULL(format);
+  BITWUZLA_CHECK_NOT_NULL(file);
+  std::stringstream ss;
+  bitwuzla->d_bitwuzla->print_statistics(ss, format);
+  fprintf(file, "%s", ss.str().c_str());
+  BITWUZLA_TRY_CATCH_END;
+}
+
 BitwuzlaTermManager *
 bitwuzla_get_term_mgr(Bitwuzla *bitwuzla)
 {
@@ -1091,6 +1183,46 @@ bitwuzla_mk_term(BitwuzlaTermManager *tm,
   return res;
 }
 
+BitwuzlaTerm *
+bitwuzla_mk_terms(BitwuzlaTermManager *tm,
+                  size_t num_leaves,
+                  BitwuzlaTerm leaves[],
+                  size_t size,
+                  const uint64_t instructions[],
+                  size_t *num_terms)
+{
+  static thread_local std::vector<BitwuzlaTerm> res;
+  BITWUZLA_TRY_CATCH_BEGIN;
+  BITWUZLA_CHECK_NOT_NULL(tm);
+  BITWUZLA_CHECK_NOT_NULL(num_terms);
+  if (num_leaves > 0)
+  {
+    BITWUZLA_CHECK_NOT_NULL(leaves);
+  }
+  if (size > 0)
+  {
+    BITWUZLA_CHECK_NOT_NULL(instructions);
+  }
+  res.clear();
+  std::vector<bitwuzla::Term> terms;
+  terms.reserve(num_leaves);
+  for (size_t i = 0; i < num_leaves; ++i)
+  {
+    BITWUZLA_CHECK_TERM_AT_IDX(leaves, i);
+    terms.push_back(BitwuzlaTermManager::import_term(leaves[i]));
+  }
+  auto created = tm->d_tm.mk_terms(
+      terms, std::vector<uint64_t>(instructions, instructions + size));
+  res.reserve(created.size());
+  for (auto &term : created)
+  {
+    res.push_back(tm->export_term(term));
+  }
+  *num_terms = res.size();
+  BITWUZLA_TRY_CATCH_END;
+  return res.empty() ? nullptr : res.data();
+}
+
 BitwuzlaTerm
 bitwuzla_mk_term1_indexed1(BitwuzlaTermManager *tm,
                            BitwuzlaKind kind,
@@ -1,7 +1,108 @@
 #include "api/c/bitwuzla_structs.h"
 
+#include <algorithm>
 #include <cassert>
 
+bitwuzla_term_t*
+TermHandleTable::find(uint64_t id) const
+{
+  if (d_slots.empty())
+  {
+    return nullptr;
+  }
+  return d_slots[probe(id)].d_term;
+}
+
+void
+TermHandleTable::insert(uint64_t id, bitwuzla_term_t* term)
+{
+  assert(term);
+  assert(!find(id));
+  // Keep the load factor below 3/4.
+  if (4 * (d_size + 1) > 3 * d_slots.size())
+  {
+    rehash(std::max(s_min_capacity, 2 * d_slots.size()));
+  }
+  Slot& slot  = d_slots[probe(id)];
+  slot.d_id   = id;
+  slot.d_term = term;
+  ++d_size;
+}
+
+void
+TermHandleTable::erase(uint64_t id)
+{
+  assert(find(id));
+  size_t mask = d_slots.size() - 1;
+  size_t i    = probe(id);
+  // Backward shift deletion, moves entries of the probe sequence following
+  // the erased entry into the gap if their home slot allows it.
+  for (size_t j = (i + 1) & mask; d_slots[j].d_term; j = (j + 1) & mask)
+  {
+    size_t k = home(d_slots[j].d_id);
+    if (((j - k) & mask) >= ((j - i) & mask))
+    {
+      d_slots[i] = d_slots[j];
+      i          = j;
+    }
+  }
+  d_slots[i] = Slot();
+  --d_size;
+  // Shrink if the load factor drops below 1/8.
+  if (d_slots.size() > s_min_capacity && 8 * d_size < d_slots.size())
+  {
+    rehash(d_slots.size() / 2);
+  }
+}
+
+void
+TermHandleTable::clear()
+{
+  std::vector<Slot>().swap(d_slots);
+  d_size  = 0;
+  d_shift = 64;
+}
+
+size_t
+TermHandleTable::home(uint64_t id) const
+{
+  // Fibonacci hashing, consecutive ids are spread over the table.
+  return static_cast<size_t>((id * UINT64_C(0x9e3779b97f4a7c15)) >> d_shift);
+}
+
+size_t
+TermHandleTable::probe(uint64_t id) const
+{
+  size_t mask = d_slots.size() - 1;
+  size_t i    = home(id);
+  while (d_slots[i].d_term && d_slots[i].d_id != id)
+  {
+    i = (i + 1) & mask;
+  }
+  return i;
+}
+
+void
+TermHandleTable::rehash(size_t capacity)
+{
+  assert((capacity & (capacity - 1)) == 0);
+  assert(4 * d_size <= 3 * capacity);
+  std::vector<Slot> slots(capacity);
+  d_slots.swap(slots);
+  d_shift = 64;
+  for (size_t c = capacity; c > 1; c >>= 1)
+  {
+    --d_shift;
+  }
+  for (const Slot& slot : slots)
+  {
+    if (slot.d_term)
+    {
+      d_slots[probe(slot.d_id)] = slot;
+    }
+  }
+}
+
 const bitwuzla::Sort&
 BitwuzlaTermManager::import_sort(BitwuzlaSort sort)
 {
@@ -32,12 +133,27 @@ BitwuzlaTermManager::export_term(const bitwuzla::Term& term)
 {
   assert(!term.is_null());
 
-  auto [it, inserted] = d_alloc_terms.try_emplace(term, term, this);
-  if (!inserted)
+  uint64_t id             = term.id();
+  bitwuzla_term_t* handle = d_term_handles.find(id);
+  if (handle)
   {
-    copy(&it->second);
+    return copy(handle);
   }
-  return &it->second;
+  if (d_free_terms.empty())
+  {
+    handle = &d_term_storage.emplace_back(term, this);
+  }
+  else
+  {
+    handle = d_free_terms.back();
+    d_free_terms.pop_back();
+    assert(handle->d_term.is_null());
+    handle->d_term = term;
+    handle->d_refs = 1;
+  }
+  d_term_handles.insert(id, handle);
+  ++d_num_alloc_terms;
+  return handle;
 }
 
 void
@@ -46,8 +162,11 @@ BitwuzlaTermManager::release(bitwuzla_term_t* term)
   --term->d_refs;
   if (term->d_refs == 0)
   {
-    assert(d_alloc_terms.find(term->d_term) != d_alloc_terms.end());
-    d_alloc_terms.erase(term->d_term);
+    assert(d_term_handles.find(term->d_term.id()) == term);
+    d_term_handles.erase(term->d_term.id());
+    term->d_term = bitwuzla::Term();
+    d_free_terms.push_back(term);
+    --d_num_alloc_terms;
   }
 }
 
@@ -80,5 +199,8 @@ void
 BitwuzlaTermManager::release()
 {
   d_alloc_sorts.clear();
-  d_alloc_terms.clear();
+  d_term_handles.clear();
+  d_free_terms.clear();
+  d_term_storage.clear();
+  d_num_alloc_terms = 0;
 }
@@ -17,6 +17,8 @@ extern "C" {
 #include <bitwuzla/cpp/bitwuzla.h>
 
 #include <cassert>
+#include <deque>
+#include <vector>
 
 /* -------------------------------------------------------------------------- */
 
@@ -96,6 +98,60 @@ struct bitwuzla_sort_t
   BitwuzlaTermManager *d_tm = nullptr;
 };
 
+/**
+ * Open-addressing hash table (linear probing) that maps term ids to wrapper
+ * terms.
+ *
+ * Term ids are unique but grow monotonically over the lifetime of a term
+ * manager (they also count internal nodes), hence the table is sized by the
+ * number of exported terms rather than by the largest id. The table shrinks
+ * when terms are released.
+ */
+class TermHandleTable
+{
+ public:
+  /** @return The wrapper term of given term id, nullptr if not exported. */
+  bitwuzla_term_t *find(uint64_t id) const;
+  /**
+   * Insert wrapper term for given term id.
+   * @note The id must not be in the table.
+   */
+  void insert(uint64_t id, bitwuzla_term_t *term);
+  /**
+   * Remove wrapper term of given term id.
+   * @note The id must be in the table.
+   */
+  void erase(uint64_t id);
+  /** Remove all entries and release the memory of the table. */
+  void clear();
+  /** @return The number of entries in the table. */
+  size_t size() const { return d_size; }
+
+ private:
+  /** The minimum capacity of a non-empty table. */
+  static constexpr size_t s_min_capacity = 16;
+
+  struct Slot
+  {
+    uint64_t d_id           = 0;
+    bitwuzla_term_t *d_term = nullptr;
+  };
+
+  /** @return The home slot of given id. */
+  size_t home(uint64_t id) const;
+  /** @return The index of the slot of given id or of the first empty slot. */
+  size_t probe(uint64_t id) const;
+  /** Rehash all entries into a table of given capacity (a power of two). */
+  void rehash(size_t capacity);
+
+  /** The slots, the capacity is zero or a power of two. */
+  std::vector<Slot> d_slots;
+  /** The number of used slots. */
+  size_t d_size = 0;
+  /** Shift to map a 64-bit hash to an index into d_slots. */
+  uint32_t d_shift = 64;
+};
+
 struct BitwuzlaTermManager
 {
   static const bitwuzla::Sort &import_sort(BitwuzlaSort sort);
@@ -150,8 +206,14 @@ struct BitwuzlaTermManager
  private:
   /** Map exported (and alive) C++ sorts to wrapper sort. */
   std::unordered_map<bitwuzla::Sort, bitwuzla_sort_t> d_alloc_sorts;
-  /** Map exported (and alive) C++ terms to wrapper term. */
-  std::unordered_map<bitwuzla::Term, bitwuzla_term_t> d_alloc_terms;
+  /** Wrapper terms of exported (and alive) C++ terms, keyed by term id. */
+  TermHandleTable d_term_handles;
+  /** Storage of wrapper terms, the addresses of its elements are stable. */
+  std::deque<bitwuzla_term_t> d_term_storage;
+  /** Released wrapper terms in d_term_storage, reused on export. */
+  std::vector<bitwuzla_term_t *> d_free_terms;
+  /** The number of exported (and alive) terms. */
+  size_t d_num_alloc_terms = 0;
 };
 
 struct Bitwuzla
@@ -10,6 +10,7 @@
 
 #include <bitwuzla/cpp/bitwuzla.h>
 
+#include <algorithm>
 #include <array>
 
 #include "api/checks.h"
@@ -57,6 +58,8 @@ _init_reverse(const std::unordered_map<K, V> &map)
 /** Map api options to internal options. */
 static const std::unordered_map<Option, bzla::option::Option>
     s_internal_options = {
+        {Option::BV_ABSTRACTION, bzla::option::Option::BV_ABSTRACTION},
+        {Option::BV_MUL_ENCODING, bzla::option::Option::BV_MUL_ENCODING},
         {Option::BV_SOLVER, bzla::option::Option::BV_SOLVER},
         {Option::LOGLEVEL, bzla::option::Option::LOG_LEVEL},
         {Option::PRODUCE_MODELS, bzla::option::Option::PRODUCE_MODELS},
@@ -69,7 +72,15 @@ static const std::unordered_map<Option, bzla::option::Option>
         {Option::VERBOSITY, bzla::option::Option::VERBOSITY},
         {Option::TIME_LIMIT_PER, bzla::option::Option::TIME_LIMIT_PER},
         {Option::MEMORY_LIMIT, bzla::option::Option::MEMORY_LIMIT},
+        {Option::RESOURCE_CHECK_INTERVAL,
+         bzla::option::Option::RESOURCE_CHECK_INTERVAL},
         {Option::REWRITE_LEVEL, bzla::option::Option::REWRITE_LEVEL},
+        {Option::FP_ABSTRACTION, bzla::option::Option::FP_ABSTRACTION},
+        {Option::MODEL_REUSE, bzla::option::Option::MODEL_REUSE},
+        {Option::SAT_DECISION_LIMIT,
+         bzla::option::Option::SAT_DECISION_LIMIT},
+        {Option::SAT_PROOF_FILE, bzla::option::Option::SAT_PROOF_FILE},
+        {Option::SAT_PROOF_FORMAT, bzla::option::Option::SAT_PROOF_FORMAT},
         {Option::PROP_CONST_BITS, bzla::option::Option::PROP_CONST_BITS},
         {Option::PROP_INFER_INEQ_BOUNDS,
          bzla::option::Option::PROP_INEQ_BOUNDS},
@@ -84,15 +95,27 @@ static const std::unordered_map<Option, bzla::option::Option>
          bzla::option::Option::PROP_PROB_PICK_INV_VALUE},
         {Option::PROP_SEXT, bzla::option::Option::PROP_SEXT},
         {Option::PROP_NORMALIZE, bzla::option::Option::PROP_NORMALIZE},
+        {Option::PROP_FIXPOINT, bzla::option::Option::PROP_FIXPOINT},
+        {Option::PROP_CAND_MOVES, bzla::option::Option::PROP_CAND_MOVES},
+        {Option::PROP_PROB_PERTURB, bzla::option::Option::PROP_PROB_PERTURB},
+        {Option::PROP_RESTARTS, bzla::option::Option::PROP_RESTARTS},
+        {Option::PROP_TABU, bzla::option::Option::PROP_TABU},
+        {Option::PROP_SAT_FIXED, bzla::option::Option::PROP_SAT_FIXED},
+        {Option::PROP_SAT_PHASES, bzla::option::Option::PROP_SAT_PHASES},
+        {Option::PROP_SAT_SLICE, bzla::option::Option::PROP_SAT_SLICE},
         {Option::NUM_OPTS, bzla::option::Option::NUM_OPTIONS},
 
         {Option::PREPROCESS, bzla::option::Option::PREPROCESS},
         {Option::PP_CONTRADICTING_ANDS,
          bzla::option::Option::PP_CONTRADICTING_ANDS},
+        {Option::PP_ELIM_ARRAYS, bzla::option::Option::PP_ELIM_ARRAYS},
+        {Option::PP_ELIM_ARRAYS_THRESH,
+         bzla::option::Option::PP_ELIM_ARRAYS_THRESH},
         {Option::PP_ELIM_BV_EXTRACTS,
          bzla::option::Option::PP_ELIM_BV_EXTRACTS},
         {Option::PP_EMBEDDED_CONSTR, bzla::option::Option::PP_EMBEDDED_CONSTR},
         {Option::PP_FLATTEN_AND, bzla::option::Option::PP_FLATTEN_AND},
+        {Option::PP_KNOWN_BITS, bzla::option::Option::PP_KNOWN_BITS},
         {Option::PP_NORMALIZE, bzla::option::Option::PP_NORMALIZE},
         {Option::PP_NORMALIZE_SHARE_AWARE,
          bzla::option::Option::PP_NORMALIZE_SHARE_AWARE},
@@ -401,6 +424,12 @@ Options::is_mode(Option option) const
   return d_options->is_mode(s_internal_options.at(option));
 }
 
+bool
+Options::is_string(Option option) const
+{
+  return d_options->is_string(s_internal_options.at(option));
+}
+
 const char *
 Options::shrt(Option option) const
 {
@@ -461,9 +490,10 @@ Options::set(Option option, const std::string &mode)
 {
   BITWUZLA_CHECK_NOT_NULL(d_options);
   bzla::option::Option opt = s_internal_options.at(option);
-  BITWUZLA_CHECK(d_options->is_mode(opt))
-      << "expected option with option modes";
-  BITWUZLA_CHECK(d_options->is_valid_mode(opt, mode))
+  BITWUZLA_CHECK(d_options->is_mode(opt) || d_options->is_string(opt))
+      << "expected option with option modes or string option";
+  BITWUZLA_CHECK(d_options->is_string(opt)
+                 || d_options->is_valid_mode(opt, mode))
       << "invalid mode for option";
   d_options->set<std::string>(s_internal_options.at(option), mode, true);
 }
@@ -473,9 +503,10 @@ Options::set(Option option, const char *mode)
 {
   BITWUZLA_CHECK_NOT_NULL(d_options);
   bzla::option::Option opt = s_internal_options.at(option);
-  BITWUZLA_CHECK(d_options->is_mode(opt))
-      << "expected option with option modes";
-  BITWUZLA_CHECK(d_options->is_valid_mode(opt, mode))
+  BITWUZLA_CHECK(d_options->is_mode(opt) || d_options->is_string(opt))
+      << "expected option with option modes or string option";
+  BITWUZLA_CHECK(d_options->is_string(opt)
+                 || d_options->is_valid_mode(opt, mode))
       << "invalid mode for option";
   d_options->set<std::string>(s_internal_options.at(option), mode, true);
 }
@@ -631,7 +662,8 @@ Options::set(const std::vector<std::string> &args)
     {
       BITWUZLA_CHECK(!value.empty())
           << "expected value for option '" << opt << "'";
-      BITWUZLA_CHECK(d_options->is_valid_mode(option, value))
+      BITWUZLA_CHECK(d_options->is_string(option)
+                     || d_options->is_valid_mode(option, value))
           << "invalid mode '" << value << "' for option '" << opt << "'";
       set(s_options.at(option), value);
     }
@@ -662,6 +694,15 @@ Options::get_mode(Option option) const
   return d_options->get<std::string>(opt);
 }
 
+const std::string &
+Options::get_str(Option option) const
+{
+  BITWUZLA_CHECK_NOT_NULL(d_options);
+  bzla::option::Option opt = s_internal_options.at(option);
+  BITWUZLA_CHECK(d_options->is_string(opt)) << "expected string option";
+  return d_options->get<std::string>(opt);
+}
+
 /* OptionInfo public -------------------------------------------------------- */
 
 OptionInfo::OptionInfo(const Options &options, Option option) : opt(option)
@@ -687,6 +728,12 @@ OptionInfo::OptionInfo(const Options &options, Option option) : opt(option)
                        options.d_options->min<uint64_t>(opt),
                        options.d_options->max<uint64_t>(opt)};
     }
+    else if (options.is_string(option))
+    {
+      kind   = Kind::STRING;
+      values = String{options.d_options->get<std::string>(opt),
+                      options.d_options->dflt<std::string>(opt)};
+    }
     else
     {
       assert(options.is_mode(option));
@@ -726,6 +773,14 @@ OptionInfo::value() const
   return std::get<OptionInfo::Mode>(values);
 }
 
+template <>
+OptionInfo::String
+OptionInfo::value() const
+{
+  BITWUZLA_CHECK(kind == Kind::STRING) << "expected string option";
+  return std::get<OptionInfo::String>(values);
+}
+
 /* Term public -------------------------------------------------------------- */
 
 Term::Term() : d_node(nullptr) {}
@@ -1521,6 +1576,23 @@ Bitwuzla::get_value(const Term &term)
   return d_ctx->get_value(*term.d_node);
 }
 
+std::vector<Term>
+Bitwuzla::get_values(const std::vector<Term> &terms)
+{
+  BITWUZLA_CHECK_NOT_NULL(d_ctx);
+  BITWUZLA_CHECK_OPT_PRODUCE_MODELS(d_ctx->options());
+  BITWUZLA_CHECK_LAST_CALL_SAT("get values");
+  for (size_t i = 0, size = terms.size(); i < size; ++i)
+  {
+    const Term &term = terms[i];
+    BITWUZLA_CHECK_TERM_NOT_NULL_AT_IDX(terms, i);
+    BITWUZLA_CHECK_TERM_TERM_MGR_BITWUZLA(
+        term, "term at position " + std::to_string(i));
+  }
+  return Term::node_vector_to_terms(
+      d_ctx->get_values(Term::term_vector_to_nodes(terms)));
+}
+
 void
 Bitwuzla::print_formula(std::ostream &out, const std::string &format) const
 {
@@ -1542,6 +1614,23 @@ Bitwuzla::statistics() const
   return d_ctx->env().statistics().get();
 }
 
+void
+Bitwuzla::print_statistics(std::ostream &out, const std::string &format) const
+{
+  BITWUZLA_CHECK_STR_NOT_EMPTY(format);
+  BITWUZLA_CHECK(format == "json" || format == "prometheus")
+      << "invalid format, expected 'json' or 'prometheus'";
+  auto snapshot = d_ctx->env().statistics().snapshot();
+  if (format == "json")
+  {
+    snapshot.print_json(out);
+  }
+  else
+  {
+    snapshot.print_prometheus(out);
+  }
+}
+
 TermManager &
 Bitwuzla::term_mgr()
 {
@@ -2275,6 +2364,76 @@ TermManager::mk_term(Kind kind,
       s_internal_kinds.at(kind), Term::term_vector_to_nodes(args), indices);
 }
 
+std::vector<Term>
+TermManager::mk_terms(const std::vector<Term> &leaves,
+                      const std::vector<uint64_t> &instructions)
+{
+  for (size_t i = 0, size = leaves.size(); i < size; ++i)
+  {
+    BITWUZLA_CHECK_TERM_NOT_NULL_AT_IDX(leaves, i);
+    BITWUZLA_CHECK(d_nm.get() == leaves[i].d_node->nm())
+        << "mismatching term manager for leaf at index " << i;
+  }
+
+  // Validate the structure of all records up front, i.e., kinds, record
+  // lengths and argument references. Sort checks are performed per record
+  // on construction.
+  size_t num_leaves = leaves.size();
+  size_t num_terms  = 0;
+  size_t max_args = 0, max_indices = 0;
+  for (size_t i = 0, size = instructions.size(); i < size; ++num_terms)
+  {
+    size_t start = i;
+    BITWUZLA_CHECK(instructions[i] < static_cast<uint64_t>(Kind::NUM_KINDS))
+        << "invalid term kind in record at index " << start;
+    BITWUZLA_CHECK(++i < size)
+        << "incomplete record at index " << start
+        << ", expected number of arguments";
+    uint64_t num_args = instructions[i++];
+    BITWUZLA_CHECK(num_args < size - i)
+        << "incomplete record at index " << start << ", expected " << num_args
+        << " arguments and number of indices";
+    for (uint64_t j = 0; j < num_args; ++i, ++j)
+    {
+      BITWUZLA_CHECK(instructions[i] < num_leaves + num_terms)
+          << "invalid argument reference '" << instructions[i]
+          << "' in record at index " << start
+          << ", expected leaf or preceding record";
+    }
+    uint64_t num_indices = instructions[i++];
+    BITWUZLA_CHECK(num_indices <= size - i)
+        << "incomplete record at index " << start << ", expected "
+        << num_indices << " indices";
+    i += num_indices;
+    max_args    = std::max(max_args, static_cast<size_t>(num_args));
+    max_indices = std::max(max_indices, static_cast<size_t>(num_indices));
+  }
+
+  std::vector<Term> res;
+  res.reserve(num_terms);
+  std::vector<Term> args;
+  std::vector<uint64_t> indices;
+  args.reserve(max_args);
+  indices.reserve(max_indices);
+  for (size_t i = 0, size = instructions.size(); i < size;)
+  {
+    Kind kind         = static_cast<Kind>(instructions[i++]);
+    uint64_t num_args = instructions[i++];
+    args.clear();
+    for (uint64_t j = 0; j < num_args; ++j)
+    {
+      uint64_t ref = instructions[i++];
+      args.push_back(ref < num_leaves ? leaves[ref] : res[ref - num_leaves]);
+    }
+    uint64_t num_indices = instructions[i++];
+    indices.assign(instructions.begin() + i,
+                   instructions.begin() + i + num_indices);
+    i += num_indices;
+    res.push_back(mk_term(kind, args, indices));
+  }
+  return res;
+}
+
 Term
 TermManager::mk_const(const Sort &sort,
                       const std::optional<std::string> &symbol)
@@ -705,6 +705,8 @@ cdef class Options:
         """
         if self.c_options.is_mode(option.value):
             return self.c_options.get_mode(option.value).decode()
+        elif self.c_options.is_string(option.value):
+            return self.c_options.get_str(option.value).decode()
         elif self.c_options.is_numeric(option.value):
             return self.c_options.get(option.value)
         elif self.c_options.is_bool(option.value):
@@ -735,6 +737,14 @@ cdef class Options:
         """
         return self.c_options.is_mode(option.value)
 
+    def is_string(self, option: Option):
+        """ Determine if given option is a string option.
+
+            :param option: The option to query.
+            :return: True if `option` is a string option.
+        """
+        return self.c_options.is_string(option.value)
+
 # --------------------------------------------------------------------------- #
 # OptionInfo wrapper
 # --------------------------------------------------------------------------- #
@@ -746,6 +756,7 @@ class OptionInfoKind(Enum):
     BOOL = bitwuzla_api.CppOptionInfoKind.BOOL
     NUMERIC = bitwuzla_api.CppOptionInfoKind.NUMERIC
     MODE = bitwuzla_api.CppOptionInfoKind.MODE
+    STRING = bitwuzla_api.CppOptionInfoKind.STRING
 
 cdef class OptionInfo:
     """ The class holding all information about an option.
@@ -783,6 +794,9 @@ cdef class OptionInfo:
         if self.kind() == OptionInfoKind.MODE:
             return self.c_info.get().value[
                     bitwuzla_api.OptionInfoMode]().dflt.decode()
+        if self.kind() == OptionInfoKind.STRING:
+            return self.c_info.get().value[
+                    bitwuzla_api.OptionInfoString]().dflt.decode()
         return self.c_info.get().value[bitwuzla_api.OptionInfoNumeric]().dflt
 
     def cur(self):
@@ -794,6 +808,9 @@ cdef class OptionInfo:
         if self.kind() == OptionInfoKind.MODE:
             return self.c_info.get().value[
                     bitwuzla_api.OptionInfoMode]().cur.decode()
+        if self.kind() == OptionInfoKind.STRING:
+            return self.c_info.get().value[
+                    bitwuzla_api.OptionInfoString]().cur.decode()
         return self.c_info.get().value[bitwuzla_api.OptionInfoNumeric]().cur
 
     def min(self):
@@ -1227,6 +1244,36 @@ cdef class TermManager:
                                              _term_vec(terms),
                                              indices))
 
+    def mk_terms(self, leaves: list[Term],
+                 instructions: list[int]) -> list[Term]:
+        """Create a DAG of terms from a flat list of instructions.
+
+           The instruction list is a sequence of records, one record per
+           term to create, of the form
+           ``kind, n, arg_0, ..., arg_{n-1}, m, idx_0, ..., idx_{m-1}``,
+           where ``kind`` is the operator kind (as :class:`~bitwuzla.Kind`
+           or its integer value), ``n`` the number of arguments and ``m``
+           the number of indices. An argument ``arg_i < len(leaves)`` refers
+           to ``leaves[arg_i]``, any other argument refers to the term
+           created by record ``arg_i - len(leaves)``, which must precede the
+           referring record.
+
+           This is equivalent to calling :func:`~bitwuzla.TermManager.mk_term`
+           for each record in order, but avoids the per-call overhead when
+           creating large terms.
+
+           :param leaves: The leaf terms referred to by the instructions.
+           :param instructions: The instruction records.
+           :return: The terms created for each record, in the order of the
+                    records.
+        """
+        cdef vector[uint64_t] cinstrs
+        cinstrs.reserve(len(instructions))
+        for i in instructions:
+            cinstrs.push_back(i.value if isinstance(i, Kind) else i)
+        return _terms(self, self.c_tm_ptr.mk_terms(_term_vec(leaves),
+                                                   cinstrs))
+
     # ----------------------------------------------------------------------- #
     # Term substitution
     # ----------------------------------------------------------------------- #
@@ -1432,6 +1479,22 @@ cdef class Bitwuzla:
         """
         return _term(self.tm, self.c_bitwuzla.get().get_value(_cterm(term)))
 
+    def get_values(self, terms: list[Term]) -> list[Term]:
+        """Get model values of a list of terms.
+
+           Requires that the last :func:`~bitwuzla.Bitwuzla.check_sat` call
+           returned `~bitwuzla.Result.SAT`.
+
+           .. note::
+               This is more efficient than querying the values of many terms
+               via :func:`~bitwuzla.Bitwuzla.get_value` one by one.
+
+           :return: List of terms representing the model values of `terms`,
+                    in the same order as `terms`.
+        """
+        return _terms(self.tm,
+                      self.c_bitwuzla.get().get_values(_term_vec(terms)))
+
     def print_formula(self, fmt: str = 'smt2', uint8_t base = 2) -> str:
         """Get the current input formula as a string.
 
@@ -1461,6 +1524,19 @@ cdef class Bitwuzla:
         return {_to_str(k): _to_str(v)
                 for [k, v] in self.c_bitwuzla.get().statistics()}
 
+    def print_statistics(self, fmt: str = 'json') -> str:
+        """Get the current statistics as a string.
+
+           :param fmt: The output format, either ``"json"`` or
+                       ``"prometheus"`` for the Prometheus text exposition
+                       format.
+           :return: The current statistics as a string in the given format.
+        """
+        cdef bitwuzla_api.stringstream c_ss
+        self.c_bitwuzla.get().print_statistics(c_ss,
+                                               <const string&> fmt.encode())
+        return c_ss.to_string().decode()
+
     def term_mgr(self) -> TermManager:
         tm = TermManager()
         tm.c_tm_ptr = &self.c_bitwuzla.get().term_mgr()
@@ -108,6 +108,7 @@ cdef extern from "bitwuzla/cpp/bitwuzla.h" namespace "bitwuzla":
         bool is_bool(Option option) except +raise_error
         bool is_numeric(Option option) except +raise_error
         bool is_mode(Option option) except +raise_error
+        bool is_string(Option option) except +raise_error
         const char *shrt(Option option) except +raise_error
         const char *lng(Option option) except +raise_error
         const char *description(Option option) except +raise_error
@@ -119,11 +120,13 @@ cdef extern from "bitwuzla/cpp/bitwuzla.h" namespace "bitwuzla":
         void set(const vector[string] &args) except +raise_error
         uint64_t get(Option option) except +raise_error
         const string &get_mode(Option option) except +raise_error
+        const string &get_str(Option option) except +raise_error
 
     cdef enum class CppOptionInfoKind "bitwuzla::OptionInfo::Kind":
         BOOL,
         NUMERIC,
-        MODE
+        MODE,
+        STRING
 
     cdef cppclass OptionInfoBool "bitwuzla::OptionInfo::Bool":
         bool cur
@@ -140,6 +143,10 @@ cdef extern from "bitwuzla/cpp/bitwuzla.h" namespace "bitwuzla":
         string dflt
         vector[string] modes
 
+    cdef cppclass OptionInfoString "bitwuzla::OptionInfo::String":
+        string cur
+        string dflt
+
     cdef cppclass OptionInfo:
         OptionInfo()
         OptionInfo(Options options, Option option) except +raise_error
@@ -150,6 +157,7 @@ cdef extern from "bitwuzla/cpp/bitwuzla.h" namespace "bitwuzla":
         OptionInfoBool value[OptionInfoBool]() except +raise_error
         OptionInfoNumeric value[OptionInfoNumeric]() except +raise_error
         OptionInfoMode value[OptionInfoMode]() except +raise_error
+        OptionInfoString value[OptionInfoString]() except +raise_error
 
     cdef cppclass Sort:
         Sort() except +raise_error
@@ -258,6 +266,9 @@ cdef extern from "bitwuzla/cpp/bitwuzla.h" namespace "bitwuzla":
         Term mk_term(Kind kind,
                      const vector[Term] &args,
                      const vector[uint64_t] &indices) except +raise_error
+        vector[Term] mk_terms(const vector[Term] &leaves,
+                              const vector[uint64_t] &instructions) \
+                                except +raise_error
         Term mk_const(const Sort &sort,
                       optional[const string] symbol) except +raise_error
         Term mk_var(const Sort &sort,
@@ -284,8 +295,10 @@ cdef extern from "bitwuzla/cpp/bitwuzla.h" namespace "bitwuzla":
         void simplify() except +raise_error
         Result check_sat(const vector[Term] &assumptions) except +raise_error
         Term get_value(const Term &term) except +raise_error
+        vector[Term] get_values(const vector[Term] &terms) except +raise_error
         void print_formula(ostream& outfile, string& fmt) except +raise_error
         map[string, string] statistics() except +raise_error
+        void print_statistics(ostream& outfile, string& fmt) except +raise_error
         TermManager& term_mgr() except +raise_error
 
 
@@ -72,4 +72,35 @@ Env::terminate() const
   return d_terminator->terminate();
 }
 
+void
+Env::register_memory_release(std::function<void()> release)
+{
+  d_memory_releases.push_back(release);
+}
+
+void
+Env::raise_memory_pressure()
+{
+  d_memory_pressure.store(true, std::memory_order_relaxed);
+}
+
+bool
+Env::check_memory_pressure()
+{
+  if (!d_memory_pressure.load(std::memory_order_relaxed))
+  {
+    return false;
+  }
+  d_memory_pressure.store(false, std::memory_order_relaxed);
+  if (d_memory_releases.empty())
+  {
+    return false;
+  }
+  for (const auto& release : d_memory_releases)
+  {
+    release();
+  }
+  return true;
+}
+
 }  // namespace bzla
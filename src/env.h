@@ -11,6 +11,10 @@
 #ifndef BZLA_ENV_H_INCLUDED
 #define BZLA_ENV_H_INCLUDED
 
+#include <atomic>
+#include <functional>
+#include <vector>
+
 #include "node/node_manager.h"
 #include "option/option.h"
 #include "rewrite/rewriter.h"
@@ -67,6 +71,29 @@ class Env
   /** @return The currently connected terminator instance. */
   Terminator* terminator() const { return d_terminator; }
 
+  /**
+   * Register a component that can release reclaimable memory (e.g., caches)
+   * under memory pressure. Release functions are called in the order of
+   * registration and must only release memory that is not needed for
+   * correctness.
+   * @param release The release function of the component.
+   */
+  void register_memory_release(std::function<void()> release);
+
+  /**
+   * Signal that memory usage exceeded the soft memory limit.
+   * @note This function is thread-safe.
+   */
+  void raise_memory_pressure();
+
+  /**
+   * Release reclaimable memory of all registered components if memory
+   * pressure was signaled since the last call. Must only be called at points
+   * where none of the released caches are in use.
+   * @return True if memory was released.
+   */
+  bool check_memory_pressure();
+
  private:
   /** The associated node manager. */
   NodeManager& d_nm;
@@ -80,6 +107,10 @@ class Env
   Terminator* d_terminator = nullptr;
   /** The associated logger class. */
   util::Logger d_logger;
+  /** True if memory pressure was signaled, set by raise_memory_pressure(). */
+  std::atomic<bool> d_memory_pressure{false};
+  /** The registered functions to release memory under memory pressure. */
+  std::vector<std::function<void()>> d_memory_releases;
 };
 
 }  // namespace bzla
@@ -82,6 +82,27 @@ AigCnfEncoder::value(const AigNode& aig)
   return aig.is_negated() ? -val : val;
 }
 
+int32_t
+AigCnfEncoder::fixed(const AigNode& aig)
+{
+  if (aig.is_true())
+  {
+    return 1;
+  }
+  else if (aig.is_false())
+  {
+    return -1;
+  }
+
+  if (!is_encoded(aig))
+  {
+    return 0;
+  }
+
+  int32_t val = d_sat_solver.fixed(std::abs(aig.get_id()));
+  return aig.is_negated() ? -val : val;
+}
+
 const AigCnfEncoder::Statistics&
 AigCnfEncoder::statistics() const
 {
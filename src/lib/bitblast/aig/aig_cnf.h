@@ -33,6 +33,16 @@ class SatInterface
   virtual void add_clause(const std::initializer_list<int64_t>& literals) = 0;
 
   virtual bool value(int64_t lit) = 0;
+
+  /**
+   * Determine if given literal is implied by the formula (fixed at the top
+   * level).
+   *
+   * @param lit Id of literal to be queried.
+   * @return 1 if it is implied, -1 if its negation is implied and 0 if
+   *         unknown.
+   */
+  virtual int32_t fixed(int64_t lit) = 0;
 };
 
 class AigCnfEncoder
@@ -58,6 +68,15 @@ class AigCnfEncoder
 
   int32_t value(const AigNode& node);
 
+  /**
+   * Determine if given AIG node is fixed at the top level.
+   *
+   * @param node The AIG node to query.
+   * @return 1 if it is implied, -1 if its negation is implied and 0 if not
+   *         encoded or unknown.
+   */
+  int32_t fixed(const AigNode& node);
+
   /** @return CNF statistics. */
   const Statistics& statistics() const;
 
@@ -11,6 +11,7 @@
 #ifndef BZLA__BITBLAST_BITBLASTER_H
 #define BZLA__BITBLAST_BITBLASTER_H
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <cstddef>
@@ -46,12 +47,32 @@ class BitInterface
   T mk_ite(const T& c, const T& a, const T& b);
 };
 
+/** Circuit encodings for bit-vector multiplication. */
+enum class MulEncoding
+{
+  /** Shift-and-add array multiplier. */
+  SHIFT_ADD,
+  /**
+   * Dadda tree multiplier, multiplication with a value is encoded via the
+   * canonical signed digit representation of the value.
+   */
+  DADDA,
+  /**
+   * Karatsuba multiplication for wide operands with at most half of their
+   * bits significant (e.g., zero-extended operands), Dadda otherwise.
+   */
+  KARATSUBA,
+};
+
 template <class T>
 class BitblasterInterface
 {
  public:
   using Bits = std::vector<T>;
 
+  /** Configure the encoding for bit-vector multiplication. */
+  void set_mul_encoding(MulEncoding encoding) { d_mul_encoding = encoding; }
+
   virtual Bits bv_value(const BitVector& bv_value)
   {
     Bits res;
@@ -342,6 +363,31 @@ class BitblasterInterface
 
   virtual Bits bv_mul(const Bits& a, const Bits& b)
   {
+    if (d_mul_encoding != MulEncoding::SHIFT_ADD)
+    {
+      if (is_value(b))
+      {
+        return const_mul_helper(a, b);
+      }
+      if (is_value(a))
+      {
+        return const_mul_helper(b, a);
+      }
+      if (d_mul_encoding == MulEncoding::KARATSUBA)
+      {
+        size_t size = a.size();
+        size_t m =
+            std::max(num_significant_bits(a), num_significant_bits(b));
+        if (m >= s_karatsuba_min_size && 2 * m <= size)
+        {
+          Bits res = karatsuba_helper(Bits(a.rbegin(), a.rbegin() + m),
+                                      Bits(b.rbegin(), b.rbegin() + m));
+          res.resize(size, d_bit_mgr.mk_false());
+          return Bits(res.rbegin(), res.rend());
+        }
+      }
+      return dadda_mul_helper(a, b);
+    }
     // Normalize operands s.t. operands with fixed bits come first
     if (a > b)
     {
@@ -382,6 +428,15 @@ class BitblasterInterface
   BitInterface<T> d_bit_mgr;
 
  private:
+  /** Columns of bits of equal weight, least significant column first. */
+  using Columns = std::vector<std::vector<T>>;
+
+  /** Minimum operand size for splitting operands in karatsuba_helper(). */
+  static constexpr size_t s_karatsuba_min_size = 16;
+
+  /** The configured multiplication encoding. */
+  MulEncoding d_mul_encoding = MulEncoding::SHIFT_ADD;
+
   Bits add_helper(const Bits& a, const Bits& b)
   {
     Bits res;
@@ -437,6 +492,266 @@ class BitblasterInterface
     return res;
   }
 
+  /** Determine if all bits of `a` are constant. */
+  bool is_value(const Bits& a)
+  {
+    T false_bit = d_bit_mgr.mk_false();
+    T true_bit  = d_bit_mgr.mk_true();
+    for (const T& bit : a)
+    {
+      if (!(bit == false_bit) && !(bit == true_bit))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /** Get the number of bits of `a` below its leading constant zero bits. */
+  size_t num_significant_bits(const Bits& a)
+  {
+    T false_bit = d_bit_mgr.mk_false();
+    size_t i    = 0;
+    while (i < a.size() && a[i] == false_bit)
+    {
+      ++i;
+    }
+    return a.size() - i;
+  }
+
+  /**
+   * Add `row` (lsb at position 0) shifted left by `shift` to given columns.
+   * Bits beyond the number of columns are discarded.
+   */
+  void add_row(Columns& cols, const Bits& row, size_t shift)
+  {
+    T false_bit = d_bit_mgr.mk_false();
+    for (size_t i = 0; i < row.size() && i + shift < cols.size(); ++i)
+    {
+      if (!(row[i] == false_bit))
+      {
+        cols[i + shift].push_back(row[i]);
+      }
+    }
+  }
+
+  /**
+   * Add the two's complement negation of `row` (lsb at position 0) shifted
+   * left by `shift` to given columns, i.e., -(row << shift) is added as
+   * (~row << shift) + (1 << shift), where ~row is extended with ones.
+   */
+  void add_neg_row(Columns& cols, const Bits& row, size_t shift)
+  {
+    if (shift >= cols.size())
+    {
+      return;
+    }
+    Bits neg;
+    for (size_t i = 0; i + shift < cols.size(); ++i)
+    {
+      neg.push_back(i < row.size() ? d_bit_mgr.mk_not(row[i])
+                                   : d_bit_mgr.mk_true());
+    }
+    add_row(cols, neg, shift);
+    cols[shift].push_back(d_bit_mgr.mk_true());
+  }
+
+  /**
+   * Sum up given columns with a Dadda tree of half and full adders, followed
+   * by a ripple-carry adder for the two remaining rows.
+   *
+   * Returns the sum (lsb at position 0) modulo 2^n, where n is the number of
+   * columns.
+   */
+  Bits reduce_columns(Columns& cols)
+  {
+    size_t max_height = 0;
+    for (const auto& col : cols)
+    {
+      max_height = std::max(max_height, col.size());
+    }
+
+    // Maximum column heights of the reduction stages: 2, 3, 4, 6, 9, ...
+    std::vector<size_t> heights{2};
+    while (heights.back() < max_height)
+    {
+      heights.push_back(heights.back() * 3 / 2);
+    }
+
+    for (auto it = heights.rbegin(); it != heights.rend(); ++it)
+    {
+      size_t height = *it;
+      for (size_t i = 0, size = cols.size(); i < size; ++i)
+      {
+        std::vector<T>& col = cols[i];
+        while (col.size() > height)
+        {
+          T sum, cout;
+          size_t n = col.size();
+          if (n == height + 1)
+          {
+            std::tie(sum, cout) = half_adder(col[n - 2], col[n - 1]);
+            col.resize(n - 2);
+          }
+          else
+          {
+            std::tie(sum, cout) =
+                full_adder(col[n - 3], col[n - 2], col[n - 1]);
+            col.resize(n - 3);
+          }
+          col.insert(col.begin(), sum);
+          if (i + 1 < size)
+          {
+            cols[i + 1].push_back(cout);
+          }
+        }
+      }
+    }
+
+    Bits res;
+    res.reserve(cols.size());
+    T false_bit = d_bit_mgr.mk_false();
+    T carry     = false_bit;
+    for (const auto& col : cols)
+    {
+      assert(col.size() <= 2);
+      T sum;
+      std::tie(sum, carry) =
+          full_adder(col.empty() ? false_bit : col[0],
+                     col.size() < 2 ? false_bit : col[1],
+                     carry);
+      res.push_back(sum);
+    }
+    return res;
+  }
+
+  /**
+   * Add the partial products of `a` and `b` (lsb at position 0) to given
+   * columns.
+   */
+  void add_partial_products(Columns& cols, const Bits& a, const Bits& b)
+  {
+    T false_bit = d_bit_mgr.mk_false();
+    for (size_t i = 0; i < b.size() && i < cols.size(); ++i)
+    {
+      // Optimization: Skip rows that are zero.
+      if (b[i] == false_bit)
+      {
+        continue;
+      }
+      Bits row;
+      for (size_t j = 0; j < a.size() && i + j < cols.size(); ++j)
+      {
+        row.push_back(d_bit_mgr.mk_and(a[j], b[i]));
+      }
+      add_row(cols, row, i);
+    }
+  }
+
+  /** Encode Dadda tree multiplier. */
+  Bits dadda_mul_helper(const Bits& a, const Bits& b)
+  {
+    Columns cols(a.size());
+    add_partial_products(
+        cols, Bits(a.rbegin(), a.rend()), Bits(b.rbegin(), b.rend()));
+    Bits res = reduce_columns(cols);
+    return Bits(res.rbegin(), res.rend());
+  }
+
+  /**
+   * Encode multiplication of `a` with value `c`.
+   *
+   * Value `c` is recoded into its canonical signed digit representation
+   * c = sum_i d_i * 2^i with d_i in {-1, 0, 1} and no two adjacent non-zero
+   * digits, and a * c is encoded as the sum of the shifted (and negated for
+   * d_i = -1) rows of `a` for each non-zero digit. This minimizes the number
+   * of rows, e.g., for c = 2^k - 1 only two rows are added.
+   */
+  Bits const_mul_helper(const Bits& a, const Bits& c)
+  {
+    size_t size = a.size();
+    T true_bit  = d_bit_mgr.mk_true();
+    Bits a_lsb(a.rbegin(), a.rend());
+    Columns cols(size);
+
+    bool carry = false;
+    for (size_t i = 0, j = size - 1; i < size; ++i, --j)
+    {
+      bool bit = c[j] == true_bit;
+      if (bit != carry)
+      {
+        // Odd: emit -1 if the next bit is set (and propagate the carry),
+        // else 1.
+        bool next = i + 1 < size && c[j - 1] == true_bit;
+        if (next)
+        {
+          add_neg_row(cols, a_lsb, i);
+          carry = true;
+        }
+        else
+        {
+          add_row(cols, a_lsb, i);
+          carry = false;
+        }
+      }
+      // Even: propagate the carry if bit + carry = 2.
+    }
+    Bits res = reduce_columns(cols);
+    return Bits(res.rbegin(), res.rend());
+  }
+
+  /**
+   * Encode full (non-truncated) multiplication of `a` and `b` of size m (lsb
+   * at position 0) via Karatsuba splitting, i.e., for a = a1 * 2^h + a0 and
+   * b = b1 * 2^h + b0, with z0 = a0 * b0, z2 = a1 * b1 and
+   * z1 = (a0 + a1) * (b0 + b1) - z0 - z2:
+   *
+   *   a * b = z2 * 2^2h + z1 * 2^h + z0
+   *
+   * Operands smaller than `s_karatsuba_min_size` are multiplied with a Dadda
+   * tree.
+   *
+   * Returns the product of size 2 * m (lsb at position 0).
+   */
+  Bits karatsuba_helper(const Bits& a, const Bits& b)
+  {
+    assert(a.size() == b.size());
+    size_t m = a.size();
+    if (m < s_karatsuba_min_size)
+    {
+      Columns cols(2 * m);
+      add_partial_products(cols, a, b);
+      return reduce_columns(cols);
+    }
+
+    size_t h = m / 2;
+    size_t k = m - h;
+    Bits a0(a.begin(), a.begin() + h), a1(a.begin() + h, a.end());
+    Bits b0(b.begin(), b.begin() + h), b1(b.begin() + h, b.end());
+
+    Bits z0 = karatsuba_helper(a0, b0);
+    Bits z2 = karatsuba_helper(a1, b1);
+
+    Columns sum_a(k + 1), sum_b(k + 1);
+    add_row(sum_a, a0, 0);
+    add_row(sum_a, a1, 0);
+    add_row(sum_b, b0, 0);
+    add_row(sum_b, b1, 0);
+    Bits z1 = karatsuba_helper(reduce_columns(sum_a), reduce_columns(sum_b));
+
+    Columns mid(z1.size());
+    add_row(mid, z1, 0);
+    add_neg_row(mid, z0, 0);
+    add_neg_row(mid, z2, 0);
+    z1 = reduce_columns(mid);
+
+    Columns res(2 * m);
+    add_row(res, z0, 0);
+    add_row(res, z1, h);
+    add_row(res, z2, 2 * h);
+    return reduce_columns(res);
+  }
+
   T ult_helper(const Bits& a, const Bits& b)
   {
     size_t lsb = a.size() - 1;
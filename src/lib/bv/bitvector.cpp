@@ -440,6 +440,31 @@ BitVector::from_si(uint64_t size, int64_t value, bool truncate)
   return res;
 }
 
+BitVector
+BitVector::from_limbs(uint64_t size, const std::vector<uint64_t>& limbs)
+{
+  assert(size > 0);
+  assert(limbs.size() == (size + 63) / 64);
+
+  BitVector res(size);
+  if (res.is_gmp())
+  {
+    mpz_import(res.d_val_gmp,
+               limbs.size(),
+               -1,
+               sizeof(uint64_t),
+               0,
+               0,
+               limbs.data());
+    mpz_fdiv_r_2exp_ull(res.d_val_gmp, res.d_val_gmp, size);
+  }
+  else
+  {
+    res.d_val_uint64 = uint64_fdiv_r_2exp(size, limbs[0]);
+  }
+  return res;
+}
+
 BitVector::BitVector(const BitVector& other)
 {
   if (other.is_null())
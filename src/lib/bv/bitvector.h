@@ -16,6 +16,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace bzla {
 
@@ -101,6 +102,19 @@ class BitVector
    */
   static BitVector from_si(uint64_t size, int64_t value, bool truncate = false);
 
+  /**
+   * Construct a bit-vector of given size from given 64-bit limbs.
+   *
+   * Bits of the most significant limb beyond `size` are truncated.
+   *
+   * @param size  The size of the bit-vector.
+   * @param limbs The limbs representing the bit-vector value, least
+   *              significant limb first. Must consist of `ceil(size / 64)`
+   *              limbs.
+   */
+  static BitVector from_limbs(uint64_t size,
+                              const std::vector<uint64_t>& limbs);
+
   /**
    * Create a true bit-vector (value 1 of size 1).
    * @return A bit-vector representing True.
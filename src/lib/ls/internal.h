@@ -20,18 +20,24 @@ template <class VALUE>
 struct LocalSearch<VALUE>::StatisticsInternal
 {
   StatisticsInternal(util::Statistics& stats, const std::string& prefix);
-  uint64_t& num_roots;
-  uint64_t& num_roots_ineq;
-  uint64_t& num_roots_sat;
-  uint64_t& num_roots_unsat;
-  uint64_t& num_props;
-  uint64_t& num_updates;
-  uint64_t& num_moves;
+  util::CounterStatistic& num_roots;
+  util::CounterStatistic& num_roots_ineq;
+  util::CounterStatistic& num_roots_sat;
+  util::CounterStatistic& num_roots_unsat;
+  util::CounterStatistic& num_props;
+  util::CounterStatistic& num_updates;
+  util::CounterStatistic& num_moves;
+  util::CounterStatistic& num_cand_moves;
+  util::CounterStatistic& num_cand_updates;
+  util::CounterStatistic& num_restarts;
+  util::CounterStatistic& num_perturbed;
+  util::CounterStatistic& num_tabu_rejects;
+  util::CounterStatistic& num_fixed_bits_prop;
 
-  uint64_t& num_props_inv;
-  uint64_t& num_props_cons;
+  util::CounterStatistic& num_props_inv;
+  util::CounterStatistic& num_props_cons;
 
-  uint64_t& num_conflicts;
+  util::CounterStatistic& num_conflicts;
 
 #ifndef NDEBUG
   util::HistogramStatistic& num_inv_values;
@@ -49,16 +55,36 @@ struct LocalSearch<VALUE>::StatisticsInternal
 template <class VALUE>
 LocalSearch<VALUE>::StatisticsInternal::StatisticsInternal(
     util::Statistics& stats, const std::string& prefix)
-    : num_roots(stats.new_stat<uint64_t>(prefix + "num_roots")),
-      num_roots_ineq(stats.new_stat<uint64_t>(prefix + "num_roots_ineq")),
-      num_roots_sat(stats.new_stat<uint64_t>(prefix + "num_roots_sat")),
-      num_roots_unsat(stats.new_stat<uint64_t>(prefix + "num_roots_unsat")),
-      num_props(stats.new_stat<uint64_t>(prefix + "num_props")),
-      num_updates(stats.new_stat<uint64_t>(prefix + "num_updates")),
-      num_moves(stats.new_stat<uint64_t>(prefix + "num_moves")),
-      num_props_inv(stats.new_stat<uint64_t>(prefix + "num_props_inv")),
-      num_props_cons(stats.new_stat<uint64_t>(prefix + "num_props_cons")),
-      num_conflicts(stats.new_stat<uint64_t>(prefix + "num_conflicts")),
+    : num_roots(stats.new_stat<util::CounterStatistic>(prefix + "num_roots")),
+      num_roots_ineq(
+          stats.new_stat<util::CounterStatistic>(prefix + "num_roots_ineq")),
+      num_roots_sat(
+          stats.new_stat<util::CounterStatistic>(prefix + "num_roots_sat")),
+      num_roots_unsat(
+          stats.new_stat<util::CounterStatistic>(prefix + "num_roots_unsat")),
+      num_props(stats.new_stat<util::CounterStatistic>(prefix + "num_props")),
+      num_updates(
+          stats.new_stat<util::CounterStatistic>(prefix + "num_updates")),
+      num_moves(stats.new_stat<util::CounterStatistic>(prefix + "num_moves")),
+      num_cand_moves(
+          stats.new_stat<util::CounterStatistic>(prefix + "num_cand_moves")),
+      num_cand_updates(
+          stats.new_stat<util::CounterStatistic>(prefix + "num_cand_updates")),
+      num_restarts(
+          stats.new_stat<util::CounterStatistic>(prefix + "num_restarts")),
+      num_perturbed(
+          stats.new_stat<util::CounterStatistic>(prefix + "num_perturbed")),
+      num_tabu_rejects(
+          stats.new_stat<util::CounterStatistic>(prefix + "num_tabu_rejects")),
+      num_fixed_bits_prop(
+          stats.new_stat<util::CounterStatistic>(
+              prefix + "num_fixed_bits_prop")),
+      num_props_inv(
+          stats.new_stat<util::CounterStatistic>(prefix + "num_props_inv")),
+      num_props_cons(
+          stats.new_stat<util::CounterStatistic>(prefix + "num_props_cons")),
+      num_conflicts(
+          stats.new_stat<util::CounterStatistic>(prefix + "num_conflicts")),
 #ifndef NDEBUG
       num_inv_values(
           stats.new_stat<util::HistogramStatistic>(prefix + "num_inv_values")),
@@ -68,6 +68,33 @@ template struct LocalSearchMove<BitVector>;
 
 /* -------------------------------------------------------------------------- */
 
+namespace {
+/**
+ * Compute the i-th element of the Luby sequence (1, 1, 2, 1, 1, 2, 4, ...).
+ * @param i The index, starting from 1.
+ */
+uint64_t
+luby(uint64_t i)
+{
+  assert(i > 0);
+  for (;;)
+  {
+    uint64_t k = 1;
+    while ((static_cast<uint64_t>(1) << k) - 1 < i)
+    {
+      ++k;
+    }
+    if ((static_cast<uint64_t>(1) << k) - 1 == i)
+    {
+      return static_cast<uint64_t>(1) << (k - 1);
+    }
+    i -= (static_cast<uint64_t>(1) << (k - 1)) - 1;
+  }
+}
+}  // namespace
+
+/* -------------------------------------------------------------------------- */
+
 template <class VALUE>
 LocalSearch<VALUE>::LocalSearch(uint64_t max_nprops,
                                 uint64_t max_nupdates,
@@ -208,6 +235,12 @@ LocalSearch<VALUE>::pop()
       if (it->second == 1)
       {
         d_roots_unsat.erase(id);
+        auto sit = d_root_scores.find(id);
+        if (sit != d_root_scores.end())
+        {
+          d_score -= sit->second;
+          d_root_scores.erase(sit);
+        }
         d_roots_ineq.erase(root);
         root->set_is_root(false);
         d_roots_cnt.erase(it);
@@ -493,6 +526,74 @@ LocalSearch<VALUE>::update_unsat_roots(Node<VALUE>* root)
     /* add to unsatisfied roots list */
     d_roots_unsat.insert(id);
   }
+
+  if (d_options.num_cand_moves > 1)
+  {
+    /* update cached score */
+    auto sit = d_root_scores.find(id);
+    if (sit != d_root_scores.end())
+    {
+      d_score -= sit->second;
+      d_root_scores.erase(sit);
+    }
+    if (root->assignment().is_false())
+    {
+      double score = compute_score(root);
+      d_root_scores.emplace(id, score);
+      d_score += score;
+    }
+  }
+}
+
+template <class VALUE>
+bool
+LocalSearch<VALUE>::is_tabu(const Node<VALUE>* input) const
+{
+  if (d_options.tabu_tenure == 0) return false;
+  auto it = d_tabu.find(input->id());
+  return it != d_tabu.end() && it->second > d_internal->d_stats.num_moves;
+}
+
+template <class VALUE>
+void
+LocalSearch<VALUE>::restart()
+{
+  StatisticsInternal& stats = d_internal->d_stats;
+
+  Log(1) << "*** restart: " << d_num_restarts + 1;
+
+  if (d_num_restarts > 0)
+  {
+    stats.num_restarts += 1;
+    for (const auto& node : d_nodes)
+    {
+      if (!is_leaf_node(node.get()) || node->is_value()
+          || d_parents.at(node->id()).empty())
+      {
+        continue;
+      }
+      if (d_rng->pick_with_prob(d_options.prob_perturb))
+      {
+        stats.num_updates +=
+            update_cone(node.get(), mk_random_value(node.get()));
+        stats.num_perturbed += 1;
+      }
+    }
+    d_tabu.clear();
+    if (d_options.num_cand_moves > 1)
+    {
+      /* recompute sum of cached scores to discard accumulated rounding
+       * errors of incremental updates */
+      d_score = 0;
+      for (const auto& [id, score] : d_root_scores)
+      {
+        d_score += score;
+      }
+    }
+  }
+  d_num_restarts += 1;
+  d_next_restart =
+      stats.num_moves + d_options.restart_base * luby(d_num_restarts);
 }
 
 template <class VALUE>
@@ -533,7 +634,9 @@ LocalSearch<VALUE>::normalize_ids()
 
 template <class VALUE>
 uint64_t
-LocalSearch<VALUE>::update_cone(Node<VALUE>* node, const VALUE& assignment)
+LocalSearch<VALUE>::update_cone(Node<VALUE>* node,
+                                const VALUE& assignment,
+                                ConeAssignments* cone_assignments)
 {
   util::Timer timer(d_internal->d_stats.time_update_cone);
 
@@ -554,6 +657,7 @@ LocalSearch<VALUE>::update_cone(Node<VALUE>* node, const VALUE& assignment)
 
   /* update assignment of given node */
   node->set_assignment(assignment);
+  d_updated_inputs.insert(node->id());
   uint64_t nupdates = 1;
 
   std::vector<Node<VALUE>*> cone;
@@ -600,6 +704,10 @@ LocalSearch<VALUE>::update_cone(Node<VALUE>* node, const VALUE& assignment)
     cur->evaluate();
     Log(2) << "      -> new assignment: " << cur->assignment();
     nupdates += 1;
+    if (cone_assignments)
+    {
+      cone_assignments->emplace_back(cur, cur->assignment());
+    }
     if (d_logger.is_log_enabled(2))
     {
       for (const auto& s : cur->log())
@@ -623,6 +731,47 @@ LocalSearch<VALUE>::update_cone(Node<VALUE>* node, const VALUE& assignment)
   return nupdates;
 }
 
+template <class VALUE>
+uint64_t
+LocalSearch<VALUE>::commit_cone(Node<VALUE>* node,
+                                const VALUE& assignment,
+                                const ConeAssignments& cone)
+{
+  util::Timer timer(d_internal->d_stats.time_update_cone);
+
+  assert(node);
+  assert(is_leaf_node(node));
+
+  Log(1) << "*** commit cone: " << *node << " with: " << assignment;
+  Log(1);
+
+  if (node->assignment().compare(assignment) == 0) return 0;
+
+  node->set_assignment(assignment);
+  d_updated_inputs.insert(node->id());
+  if (node->is_root())
+  {
+    update_unsat_roots(node);
+  }
+  /* The recorded assignments are in the order of recomputation, i.e.,
+   * children are assigned before their parents. */
+  for (const auto& [cur, value] : cone)
+  {
+    cur->set_assignment(value);
+    if (cur->is_root())
+    {
+      update_unsat_roots(cur);
+    }
+  }
+#ifndef NDEBUG
+  for (uint64_t id : d_roots_unsat)
+  {
+    assert(get_node(id)->assignment().is_false());
+  }
+#endif
+  return cone.size() + 1;
+}
+
 template <class VALUE>
 Result
 LocalSearch<VALUE>::move()
@@ -653,37 +802,109 @@ LocalSearch<VALUE>::move()
 
   if (d_roots_unsat.empty()) return Result::SAT;
 
+  if (d_options.restart_base > 0 && stats.num_moves >= d_next_restart)
+  {
+    restart();
+    if (d_roots_unsat.empty()) return Result::SAT;
+  }
+
   LocalSearchMove<VALUE> m;
-  do
+  /* The number of unsat roots and the score of the best candidate move. */
+  uint64_t best_num_unsat = UINT64_MAX;
+  double best_score       = 0;
+  /* The cone assignments of the best candidate move, reused to commit it. */
+  ConeAssignments best_cone;
+  ConeAssignments cand_cone;
+
+  for (uint32_t i = 0, n = std::max(d_options.num_cand_moves, 1u); i < n; ++i)
   {
-    if (d_max_nprops > 0 && stats.num_props >= d_max_nprops)
+    /* The maximum number of attempts to find a move on a non-tabu input. */
+    static constexpr uint32_t TABU_MAX_ATTEMPTS = 10;
+    uint32_t attempts = 0;
+
+    LocalSearchMove<VALUE> cand;
+    do
     {
-      return Result::UNKNOWN;
+      if ((d_max_nprops > 0 && stats.num_props >= d_max_nprops)
+          || (d_max_nupdates > 0 && stats.num_updates >= d_max_nupdates))
+      {
+        if (m.d_input == nullptr)
+        {
+          return Result::UNKNOWN;
+        }
+        break;
+      }
+
+      Node<VALUE>* root = get_node(
+          d_rng->pick_from_set<std::unordered_set<uint64_t>, uint64_t>(
+              d_roots_unsat));
+
+      if (root->is_value_false())
+      {
+        // Store root responsible for unsat result.
+        d_false_root = root->id();
+        return Result::UNSAT;
+      }
+
+      Log(1);
+      Log(1) << " ** select constraint: " << *root;
+
+      cand = select_move(root, *d_true);
+      stats.num_props += cand.d_nprops;
+      stats.num_updates += cand.d_nupdates;
+
+      if (cand.d_input && is_tabu(cand.d_input)
+          && ++attempts < TABU_MAX_ATTEMPTS)
+      {
+        Log(1) << "  | reject tabu input: " << *cand.d_input;
+        stats.num_tabu_rejects += 1;
+        cand.d_input = nullptr;
+      }
+    } while (cand.d_input == nullptr);
+
+    if (cand.d_input == nullptr)
+    {
+      break;
     }
-    if (d_max_nupdates > 0 && stats.num_updates >= d_max_nupdates)
+    if (n == 1)
     {
-      return Result::UNKNOWN;
+      m = cand;
+      break;
     }
 
-    Node<VALUE>* root =
-        get_node(d_rng->pick_from_set<std::unordered_set<uint64_t>, uint64_t>(
-            d_roots_unsat));
-
-    if (root->is_value_false())
+    /* Score candidate by tentatively applying and reverting it. Tentative
+     * updates do not count towards the update limit, only the committed
+     * move does. */
+    stats.num_cand_moves += 1;
+    VALUE prev        = cand.d_input->assignment();
+    double prev_score = d_score;
+    cand_cone.clear();
+    stats.num_cand_updates +=
+        update_cone(cand.d_input, cand.d_assignment, &cand_cone);
+    uint64_t num_unsat = d_roots_unsat.size();
+    double score       = d_score;
+    stats.num_cand_updates += update_cone(cand.d_input, prev);
+    d_score = prev_score;
+
+    Log(1) << "  | candidate: " << *cand.d_input << " -> "
+           << cand.d_assignment << " (unsat roots: " << num_unsat
+           << ", score: " << score << ")";
+
+    if (num_unsat < best_num_unsat
+        || (num_unsat == best_num_unsat && score > best_score))
     {
-      // Store root responsible for unsat result.
-      d_false_root = root->id();
-      return Result::UNSAT;
+      m              = cand;
+      best_num_unsat = num_unsat;
+      best_score     = score;
+      best_cone.swap(cand_cone);
     }
+    if (num_unsat == 0)
+    {
+      break;
+    }
+  }
 
-    Log(1);
-    Log(1) << " ** select constraint: " << *root;
-
-    m = select_move(root, *d_true);
-    stats.num_props += m.d_nprops;
-    stats.num_updates += m.d_nupdates;
-  } while (m.d_input == nullptr);
-
+  assert(m.d_input);
   assert(!m.d_assignment.is_null());
 
   Log(1);
@@ -694,7 +915,22 @@ LocalSearch<VALUE>::move()
   Log(1);
 
   stats.num_moves += 1;
-  stats.num_updates += update_cone(m.d_input, m.d_assignment);
+  if (best_num_unsat != UINT64_MAX)
+  {
+    /* Reuse the cone assignments, score and number of unsat roots computed
+     * when the move was applied tentatively. */
+    stats.num_updates += commit_cone(m.d_input, m.d_assignment, best_cone);
+    assert(d_roots_unsat.size() == best_num_unsat);
+    d_score = best_score;
+  }
+  else
+  {
+    stats.num_updates += update_cone(m.d_input, m.d_assignment);
+  }
+  if (d_options.tabu_tenure > 0)
+  {
+    d_tabu[m.d_input->id()] = stats.num_moves + d_options.tabu_tenure;
+  }
   stats.num_roots       = d_roots.size();
   stats.num_roots_ineq  = d_roots_ineq.size();
   stats.num_roots_unsat = d_roots_unsat.size();
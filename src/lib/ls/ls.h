@@ -110,16 +110,19 @@ class LocalSearch
   using ParentsSet   = std::unordered_set<uint64_t>;
   using ParentsMap   = std::unordered_map<uint64_t, ParentsSet>;
 
+  /** The nodes of a cone of influence paired with their new assignment. */
+  using ConeAssignments = std::vector<std::pair<Node<VALUE>*, VALUE>>;
+
   struct Statistics
   {
-    uint64_t& num_roots;
-    uint64_t& num_roots_ineq;
-    uint64_t& num_props;
-    uint64_t& num_updates;
-    uint64_t& num_moves;
-    uint64_t& num_props_inv;
-    uint64_t& num_props_cons;
-    uint64_t& num_conflicts;
+    uint64_t num_roots;
+    uint64_t num_roots_ineq;
+    uint64_t num_props;
+    uint64_t num_updates;
+    uint64_t num_moves;
+    uint64_t num_props_inv;
+    uint64_t num_props_cons;
+    uint64_t num_conflicts;
 #ifndef NDEBUG
     std::unordered_map<std::string, uint64_t> num_inv_values;
     std::unordered_map<std::string, uint64_t> num_cons_values;
@@ -177,6 +180,32 @@ class LocalSearch
      * a random input (see use_path_sel_essential).
      */
     uint32_t prob_pick_ess_input = 990;
+    /**
+     * The number of candidate moves to select from per move. Candidates are
+     * compared by the number of unsatisfied roots after the move, and then
+     * by the sum of the scores of unsatisfied roots, which measure their
+     * distance to satisfaction. A value of 1 disables score-based move
+     * selection.
+     */
+    uint32_t num_cand_moves = 1;
+    /**
+     * The number of moves of a Luby restart interval unit, i.e., the i-th
+     * restart is performed after `restart_base * luby(i)` moves since the
+     * previous restart. A value of 0 disables restarts.
+     */
+    uint32_t restart_base = 0;
+    /**
+     * The probability for each input to be assigned a random value on
+     * restart. Interpreted as prob_perturb * 1/10 %, i.e., 1000 corresponds
+     * to a full random restart.
+     */
+    uint32_t prob_perturb = 100;
+    /**
+     * The number of moves an input is tabu after its assignment was updated.
+     * Moves on tabu inputs are rejected unless no other move was found after
+     * a fixed number of attempts. A value of 0 disables the tabu list.
+     */
+    uint32_t tabu_tenure = 0;
   } d_options;
 
   /**
@@ -266,6 +295,18 @@ class LocalSearch
    */
   void set_assignment(uint64_t id, const VALUE& assignment);
 
+  /**
+   * Get the ids of the inputs whose assignment was updated by a move or a
+   * restart since the last call to clear_updated_inputs().
+   * @return The ids of the updated inputs.
+   */
+  const std::unordered_set<uint64_t>& get_updated_inputs() const
+  {
+    return d_updated_inputs;
+  }
+  /** Reset the set of updated inputs, see get_updated_inputs(). */
+  void clear_updated_inputs() { d_updated_inputs.clear(); }
+
   /**
    * Register node as root.
    *
@@ -379,15 +420,58 @@ class LocalSearch
    * @param node The node.
    */
   virtual void compute_bounds(Node<VALUE>* node) = 0;
+  /**
+   * Compute the score of given unsatisfied root, i.e., a measure for how
+   * close its current assignment is to satisfying it.
+   * @param root The root.
+   * @return The score in [0, 1), the higher the closer to satisfaction.
+   */
+  virtual double compute_score(Node<VALUE>* root) const = 0;
+  /**
+   * Create a random value for given input that is consistent with its
+   * constant bits.
+   * @param input The input.
+   * @return The random value.
+   */
+  virtual VALUE mk_random_value(Node<VALUE>* input) = 0;
+  /**
+   * Determine if the given input is tabu, i.e., if it was updated less than
+   * `d_options.tabu_tenure` moves ago.
+   * @param input The input to query.
+   * @return True if `input` is tabu.
+   */
+  bool is_tabu(const Node<VALUE>* input) const;
+  /**
+   * Restart by assigning random values to a random subset of the inputs
+   * (see `d_options.prob_perturb`) and schedule the next restart.
+   */
+  void restart();
   /**
    * Update the assignment of the given node to the given assignment, and
    * recompute the assignment of all nodes in its cone of influence
    *
    * @param node The node to update.
    * @param assignment The new assignment of the given node.
+   * @param cone If not null, the recomputed assignments of the nodes in the
+   *             cone are recorded here, in the order of recomputation.
    * @return The number of updated assignments.
    */
-  uint64_t update_cone(Node<VALUE>* node, const VALUE& assignment);
+  uint64_t update_cone(Node<VALUE>* node,
+                       const VALUE& assignment,
+                       ConeAssignments* cone = nullptr);
+  /**
+   * Update the assignment of the given node to the given assignment, and
+   * set the assignments of its cone of influence to the given assignments
+   * recorded by update_cone() when the move was applied tentatively.
+   *
+   * @param node The node to update.
+   * @param assignment The new assignment of the given node.
+   * @param cone The recorded assignments of the cone of the given node.
+   * @return The number of updated assignments.
+   */
+  uint64_t commit_cone(Node<VALUE>* node,
+                       const VALUE& assignment,
+                       const ConeAssignments& cone);
   /**
    * Select an input and a new assignment for that input by propagating the
    * given target value `t_root` for the given root along one path towards an
@@ -428,6 +512,22 @@ class LocalSearch
   std::unordered_set<uint64_t> d_roots_unsat;
   /** Root responsible for unsat result. */
   uint64_t d_false_root;
+  /**
+   * The cached scores of the unsatisfied roots, maintained if score-based
+   * move selection is enabled. Scores are only recomputed for roots in the
+   * cone of influence of an updated input.
+   */
+  std::unordered_map<uint64_t, double> d_root_scores;
+  /** The sum of the scores in d_root_scores. */
+  double d_score = 0;
+  /** The inputs updated since the last call to clear_updated_inputs(). */
+  std::unordered_set<uint64_t> d_updated_inputs;
+  /** Map input to the number of moves after which it is no longer tabu. */
+  std::unordered_map<uint64_t, uint64_t> d_tabu;
+  /** The number of restarts, used to compute the next Luby interval. */
+  uint64_t d_num_restarts = 0;
+  /** The number of moves after which the next restart is performed. */
+  uint64_t d_next_restart = 0;
 
   /**
    * The set of (to be considered) top-level inequalities. Maps inequality
@@ -10,6 +10,7 @@
 
 #include "ls/ls_bv.h"
 
+#include <algorithm>
 #include <cassert>
 #include <functional>
 #include <iostream>
@@ -17,12 +18,37 @@
 
 #include "../util/hash_pair.h"
 #include "bv/bitvector.h"
+#include "bv/bounds/bitvector_bounds.h"
 #include "bv/domain/bitvector_domain.h"
 #include "ls/bv/bitvector_node.h"
 #include "ls/internal.h"
 
 namespace bzla::ls {
 
+namespace {
+
+/**
+ * Get the range of values of given domain.
+ * @param d         The domain.
+ * @param is_signed True to flip the msb, i.e., to map the signed to the
+ *                  unsigned order.
+ * @return The range.
+ */
+BitVectorRange
+mk_range(const BitVectorDomain& d, bool is_signed)
+{
+  BitVectorRange res(d);
+  uint64_t msb = d.size() - 1;
+  if (is_signed && d.is_fixed_bit(msb))
+  {
+    res.d_min.flip_bit(msb);
+    res.d_max.flip_bit(msb);
+  }
+  return res;
+}
+
+}  // namespace
+
 /* LocalSearchBv public ----------------------------------------------------- */
 
 LocalSearchBV::LocalSearchBV(uint64_t max_nprops,
@@ -106,6 +132,104 @@ LocalSearchBV::fix_bit(uint64_t id, uint32_t idx, bool value)
   node->fix_bit(idx, value);
 }
 
+uint64_t
+LocalSearchBV::fix_bits(uint64_t id, const BitVectorDomain& domain)
+{
+  assert(id < d_nodes.size());  // API check
+  BitVectorNode* node = get_node(id);
+  assert(is_leaf_node(node));                      // API check
+  assert(node->domain().size() == domain.size());  // API check
+
+  uint64_t nfixed = 0;
+  for (uint64_t i = 0, size = domain.size(); i < size; ++i)
+  {
+    if (domain.is_fixed_bit(i) && !node->domain().is_fixed_bit(i))
+    {
+      node->fix_bit(i, domain.is_fixed_bit_true(i));
+      nfixed += 1;
+    }
+    assert(!domain.is_fixed_bit(i)
+           || node->domain().is_fixed_bit_true(i)
+                  == domain.is_fixed_bit_true(i));
+  }
+
+  const BitVectorDomain& d = node->domain();
+  if (nfixed && !d.match_fixed_bits(node->assignment()))
+  {
+    d_internal->d_stats.num_updates +=
+        update_cone(node, d.lo().bvor(node->assignment().bvand(d.hi())));
+  }
+  return nfixed;
+}
+
+uint64_t
+LocalSearchBV::propagate_fixpoint()
+{
+  size_t nroots_top =
+      d_roots_control.empty() ? d_roots.size() : d_roots_control[0];
+
+  std::map<uint64_t, BitVectorDomain> domains;
+  std::vector<uint64_t> changed;
+  std::vector<uint64_t> visit;
+  std::unordered_set<uint64_t> cache;
+
+  // top-level roots must be true
+  for (size_t i = 0; i < nroots_top; ++i)
+  {
+    BitVectorNode* root = get_node(d_roots[i]);
+    BitVectorDomain& d =
+        domains.try_emplace(root->id(), root->domain()).first->second;
+    if (d.is_fixed_bit_false(0))
+    {
+      return 0;
+    }
+    d.fix_bit(0, true);
+    if (cache.insert(root->id()).second)
+    {
+      visit.push_back(root->id());
+    }
+  }
+
+  while (!visit.empty())
+  {
+    uint64_t id = visit.back();
+    visit.pop_back();
+    cache.erase(id);
+    if (!propagate_fixpoint(get_node(id), domains, changed))
+    {
+      return 0;
+    }
+    // revisit updated nodes and their parents
+    for (uint64_t cid : changed)
+    {
+      if (cache.insert(cid).second)
+      {
+        visit.push_back(cid);
+      }
+      for (uint64_t pid : d_parents.at(cid))
+      {
+        if (cache.insert(pid).second)
+        {
+          visit.push_back(pid);
+        }
+      }
+    }
+    changed.clear();
+  }
+
+  uint64_t nfixed = 0;
+  for (const auto& [id, domain] : domains)
+  {
+    BitVectorNode* node = get_node(id);
+    if (is_leaf_node(node) && !node->is_value())
+    {
+      nfixed += fix_bits(id, domain);
+    }
+  }
+  d_internal->d_stats.num_fixed_bits_prop += nfixed;
+  return nfixed;
+}
+
 /* LocalSearchBv private ---------------------------------------------------- */
 
 uint64_t
@@ -435,6 +559,475 @@ LocalSearchBV::compute_bounds(Node<BitVector>* node)
   }
 }
 
+double
+LocalSearchBV::compute_score(Node<BitVector>* root) const
+{
+  assert(root->is_root());
+  assert(root->assignment().is_false());
+
+  BitVectorNode* node = reinterpret_cast<BitVectorNode*>(root);
+  bool negated        = node->is_not();
+  if (negated)
+  {
+    node = node->child(0);
+  }
+  if (node->arity() != 2)
+  {
+    return 0;
+  }
+
+  const BitVector& s = node->child(0)->assignment();
+  const BitVector& t = node->child(1)->assignment();
+  uint64_t size      = s.size();
+
+  if (node->kind() == NodeKind::EQ)
+  {
+    if (negated)
+    {
+      // s = t, flipping any bit satisfies the root
+      return 1.0 - 1.0 / (size + 1);
+    }
+    uint64_t dist  = 0;
+    BitVector diff = s.bvxor(t);
+    for (uint64_t i = 0; i < size; ++i)
+    {
+      dist += diff.bit(i);
+    }
+    return 1.0 - static_cast<double>(dist) / (size + 1);
+  }
+
+  if (node->kind() == NodeKind::BV_ULT || node->kind() == NodeKind::BV_SLT)
+  {
+    BitVector ss = s, tt = t;
+    if (node->kind() == NodeKind::BV_SLT)
+    {
+      // map signed to unsigned order
+      BitVector min_signed = BitVector::mk_min_signed(size);
+      ss.ibvxor(min_signed);
+      tt.ibvxor(min_signed);
+    }
+    // unsat s < t: s >= t, difference s - t
+    // unsat s >= t: s < t, difference t - s - 1
+    // The distance is the bit length of the difference plus one, i.e., at
+    // least 1 if the difference is 0.
+    BitVector diff = negated ? tt.bvsub(ss) : ss.bvsub(tt);
+    if (negated)
+    {
+      diff.ibvdec();
+    }
+    uint64_t dist = size - diff.count_leading_zeros() + 1;
+    return 1.0 - static_cast<double>(dist) / (size + 1);
+  }
+  return 0;
+}
+
+BitVector
+LocalSearchBV::mk_random_value(Node<BitVector>* input)
+{
+  assert(is_leaf_node(input));
+  const BitVectorDomain& domain =
+      reinterpret_cast<BitVectorNode*>(input)->domain();
+  if (domain.is_fixed())
+  {
+    return domain.lo();
+  }
+  if (domain.has_fixed_bits())
+  {
+    BitVectorDomainGenerator gen(domain, d_rng.get());
+    return gen.random();
+  }
+  return BitVector(domain.size(), *d_rng);
+}
+
+bool
+LocalSearchBV::propagate_fixpoint(BitVectorNode* node,
+                                  std::map<uint64_t, BitVectorDomain>& domains,
+                                  std::vector<uint64_t>& changed)
+{
+  bool conflict = false;
+
+  auto domain = [&domains](BitVectorNode* n) -> BitVectorDomain& {
+    return domains.try_emplace(n->id(), n->domain()).first->second;
+  };
+  // fix bit 'idx' of node 'n' to 'value'
+  auto fix = [&](BitVectorNode* n, uint64_t idx, bool value) {
+    BitVectorDomain& d = domain(n);
+    if (!d.is_fixed_bit(idx))
+    {
+      d.fix_bit(idx, value);
+      changed.push_back(n->id());
+    }
+    else if (d.is_fixed_bit_true(idx) != value)
+    {
+      conflict = true;
+    }
+  };
+  // propagate between bit 'idx_a' of node 'a' and bit 'idx_b' of node 'b'
+  auto link = [&](BitVectorNode* a,
+                  uint64_t idx_a,
+                  BitVectorNode* b,
+                  uint64_t idx_b,
+                  bool negated) {
+    const BitVectorDomain& da = domain(a);
+    const BitVectorDomain& db = domain(b);
+    if (da.is_fixed_bit(idx_a))
+    {
+      fix(b, idx_b, da.is_fixed_bit_true(idx_a) != negated);
+    }
+    else if (db.is_fixed_bit(idx_b))
+    {
+      fix(a, idx_a, db.is_fixed_bit_true(idx_b) != negated);
+    }
+  };
+  // fix the common prefix of the min and max value of range 'r' of node 'n'
+  auto fix_prefix = [&](BitVectorNode* n,
+                        const BitVectorRange& r,
+                        bool is_signed) {
+    if (r.d_min.compare(r.d_max) > 0)
+    {
+      conflict = true;
+      return;
+    }
+    uint64_t msb = n->size() - 1;
+    for (uint64_t i = msb + 1; i > 0; --i)
+    {
+      bool bit = r.d_min.bit(i - 1);
+      if (bit != r.d_max.bit(i - 1))
+      {
+        break;
+      }
+      fix(n, i - 1, is_signed && i - 1 == msb ? !bit : bit);
+    }
+  };
+
+  uint64_t size            = node->size();
+  const BitVectorDomain& d = domain(node);
+
+  switch (node->kind())
+  {
+    case NodeKind::NOT:
+    case NodeKind::BV_NOT:
+      for (uint64_t i = 0; i < size; ++i)
+      {
+        link(node, i, node->child(0), i, true);
+      }
+      break;
+
+    case NodeKind::AND:
+    case NodeKind::BV_AND: {
+      BitVectorNode* child0     = node->child(0);
+      BitVectorNode* child1     = node->child(1);
+      const BitVectorDomain& d0 = domain(child0);
+      const BitVectorDomain& d1 = domain(child1);
+      for (uint64_t i = 0; i < size; ++i)
+      {
+        if (d0.is_fixed_bit_false(i) || d1.is_fixed_bit_false(i))
+        {
+          fix(node, i, false);
+        }
+        else if (d0.is_fixed_bit_true(i) && d1.is_fixed_bit_true(i))
+        {
+          fix(node, i, true);
+        }
+        if (d.is_fixed_bit_true(i))
+        {
+          fix(child0, i, true);
+          fix(child1, i, true);
+        }
+        else if (d.is_fixed_bit_false(i))
+        {
+          if (d0.is_fixed_bit_true(i))
+          {
+            fix(child1, i, false);
+          }
+          else if (d1.is_fixed_bit_true(i))
+          {
+            fix(child0, i, false);
+          }
+        }
+      }
+    }
+    break;
+
+    case NodeKind::XOR:
+    case NodeKind::BV_XOR: {
+      BitVectorNode* child0     = node->child(0);
+      BitVectorNode* child1     = node->child(1);
+      const BitVectorDomain& d0 = domain(child0);
+      const BitVectorDomain& d1 = domain(child1);
+      for (uint64_t i = 0; i < size; ++i)
+      {
+        if (d0.is_fixed_bit(i) && d1.is_fixed_bit(i))
+        {
+          fix(node, i, d0.is_fixed_bit_true(i) != d1.is_fixed_bit_true(i));
+        }
+        else if (d.is_fixed_bit(i) && d0.is_fixed_bit(i))
+        {
+          fix(child1, i, d.is_fixed_bit_true(i) != d0.is_fixed_bit_true(i));
+        }
+        else if (d.is_fixed_bit(i) && d1.is_fixed_bit(i))
+        {
+          fix(child0, i, d.is_fixed_bit_true(i) != d1.is_fixed_bit_true(i));
+        }
+      }
+    }
+    break;
+
+    case NodeKind::EQ: {
+      BitVectorNode* child0     = node->child(0);
+      BitVectorNode* child1     = node->child(1);
+      const BitVectorDomain& d0 = domain(child0);
+      const BitVectorDomain& d1 = domain(child1);
+      uint64_t csize            = child0->size();
+      bool is_fixed             = true;
+      for (uint64_t i = 0; i < csize; ++i)
+      {
+        if (!d0.is_fixed_bit(i) || !d1.is_fixed_bit(i))
+        {
+          is_fixed = false;
+        }
+        else if (d0.is_fixed_bit_true(i) != d1.is_fixed_bit_true(i))
+        {
+          fix(node, 0, false);
+          is_fixed = false;
+          break;
+        }
+      }
+      if (is_fixed)
+      {
+        fix(node, 0, true);
+      }
+      if (d.is_fixed_bit_true(0))
+      {
+        for (uint64_t i = 0; i < csize; ++i)
+        {
+          link(child0, i, child1, i, false);
+        }
+      }
+      else if (d.is_fixed_bit_false(0) && csize == 1)
+      {
+        link(child0, 0, child1, 0, true);
+      }
+    }
+    break;
+
+    case NodeKind::ITE: {
+      BitVectorNode* child0     = node->child(0);
+      BitVectorNode* child1     = node->child(1);
+      BitVectorNode* child2     = node->child(2);
+      const BitVectorDomain& d0 = domain(child0);
+      if (d0.is_fixed_bit(0))
+      {
+        BitVectorNode* branch = d0.is_fixed_bit_true(0) ? child1 : child2;
+        for (uint64_t i = 0; i < size; ++i)
+        {
+          link(node, i, branch, i, false);
+        }
+        break;
+      }
+      const BitVectorDomain& d1 = domain(child1);
+      const BitVectorDomain& d2 = domain(child2);
+      for (uint64_t i = 0; i < size; ++i)
+      {
+        if (d1.is_fixed_bit(i) && d2.is_fixed_bit(i)
+            && d1.is_fixed_bit_true(i) == d2.is_fixed_bit_true(i))
+        {
+          fix(node, i, d1.is_fixed_bit_true(i));
+        }
+        if (d.is_fixed_bit(i))
+        {
+          // condition must select the branch that does not disagree
+          if (d1.is_fixed_bit(i)
+              && d1.is_fixed_bit_true(i) != d.is_fixed_bit_true(i))
+          {
+            fix(child0, 0, false);
+          }
+          if (d2.is_fixed_bit(i)
+              && d2.is_fixed_bit_true(i) != d.is_fixed_bit_true(i))
+          {
+            fix(child0, 0, true);
+          }
+        }
+      }
+    }
+    break;
+
+    case NodeKind::BV_CONCAT: {
+      uint64_t size1 = node->child(1)->size();
+      for (uint64_t i = 0; i < size; ++i)
+      {
+        if (i < size1)
+        {
+          link(node, i, node->child(1), i, false);
+        }
+        else
+        {
+          link(node, i, node->child(0), i - size1, false);
+        }
+      }
+    }
+    break;
+
+    case NodeKind::BV_EXTRACT: {
+      uint64_t lo = static_cast<BitVectorExtract*>(node)->lo();
+      for (uint64_t i = 0; i < size; ++i)
+      {
+        link(node, i, node->child(0), lo + i, false);
+      }
+    }
+    break;
+
+    case NodeKind::BV_SEXT: {
+      uint64_t msb0 = node->child(0)->size() - 1;
+      for (uint64_t i = 0; i < size; ++i)
+      {
+        link(node, i, node->child(0), std::min(i, msb0), false);
+      }
+    }
+    break;
+
+    case NodeKind::BV_SHL:
+    case NodeKind::BV_SHR:
+    case NodeKind::BV_ASHR: {
+      const BitVectorDomain& d1 = domain(node->child(1));
+      if (!d1.is_fixed())
+      {
+        break;
+      }
+      // shift amounts >= size are normalized to size
+      const BitVector& s = d1.lo();
+      uint64_t shift     = size;
+      if (s.size() <= 64 || s.count_leading_zeros() >= s.size() - 64)
+      {
+        shift = std::min(s.to_uint64(true), size);
+      }
+      for (uint64_t i = 0; i < size; ++i)
+      {
+        if (node->kind() == NodeKind::BV_SHL)
+        {
+          if (i < shift)
+          {
+            fix(node, i, false);
+          }
+          else
+          {
+            link(node, i, node->child(0), i - shift, false);
+          }
+        }
+        else if (i + shift < size)
+        {
+          link(node, i, node->child(0), i + shift, false);
+        }
+        else if (node->kind() == NodeKind::BV_SHR)
+        {
+          fix(node, i, false);
+        }
+        else
+        {
+          link(node, i, node->child(0), size - 1, false);
+        }
+      }
+    }
+    break;
+
+    case NodeKind::BV_ADD: {
+      BitVectorNode* child0     = node->child(0);
+      BitVectorNode* child1     = node->child(1);
+      const BitVectorDomain& d0 = domain(child0);
+      const BitVectorDomain& d1 = domain(child1);
+      // propagate from the lsb as long as the carry is known
+      bool carry = false;
+      for (uint64_t i = 0; i < size && !conflict; ++i)
+      {
+        if (d0.is_fixed_bit(i) && d1.is_fixed_bit(i))
+        {
+          fix(node,
+              i,
+              d0.is_fixed_bit_true(i) ^ d1.is_fixed_bit_true(i) ^ carry);
+        }
+        else if (d.is_fixed_bit(i) && d0.is_fixed_bit(i))
+        {
+          fix(child1,
+              i,
+              d.is_fixed_bit_true(i) ^ d0.is_fixed_bit_true(i) ^ carry);
+        }
+        else if (d.is_fixed_bit(i) && d1.is_fixed_bit(i))
+        {
+          fix(child0,
+              i,
+              d.is_fixed_bit_true(i) ^ d1.is_fixed_bit_true(i) ^ carry);
+        }
+        else
+        {
+          break;
+        }
+        bool a = d0.is_fixed_bit_true(i);
+        bool b = d1.is_fixed_bit_true(i);
+        carry  = (a && b) || (carry && (a != b));
+      }
+    }
+    break;
+
+    case NodeKind::BV_ULT:
+    case NodeKind::BV_SLT: {
+      bool is_signed        = node->kind() == NodeKind::BV_SLT;
+      BitVectorNode* child0 = node->child(0);
+      BitVectorNode* child1 = node->child(1);
+      BitVectorRange r0     = mk_range(domain(child0), is_signed);
+      BitVectorRange r1     = mk_range(domain(child1), is_signed);
+      if (r0.d_max.compare(r1.d_min) < 0)
+      {
+        fix(node, 0, true);
+      }
+      else if (r0.d_min.compare(r1.d_max) >= 0)
+      {
+        fix(node, 0, false);
+      }
+      if (d.is_fixed_bit_true(0))
+      {
+        // child0 < child1
+        if (r1.d_max.is_zero() || r0.d_min.is_ones())
+        {
+          conflict = true;
+          break;
+        }
+        BitVector max0 = r1.d_max.bvdec();
+        if (max0.compare(r0.d_max) < 0)
+        {
+          r0.d_max = max0;
+        }
+        BitVector min1 = r0.d_min.bvinc();
+        if (min1.compare(r1.d_min) > 0)
+        {
+          r1.d_min = min1;
+        }
+      }
+      else if (d.is_fixed_bit_false(0))
+      {
+        // child0 >= child1
+        if (r1.d_min.compare(r0.d_min) > 0)
+        {
+          r0.d_min = r1.d_min;
+        }
+        if (r0.d_max.compare(r1.d_max) < 0)
+        {
+          r1.d_max = r0.d_max;
+        }
+      }
+      else
+      {
+        break;
+      }
+      fix_prefix(child0, r0, is_signed);
+      fix_prefix(child1, r1, is_signed);
+    }
+    break;
+
+    default: break;
+  }
+  return !conflict;
+}
+
 std::vector<std::pair<uint64_t, uint64_t>>
 LocalSearchBV::split_indices(BitVectorNode* node)
 {
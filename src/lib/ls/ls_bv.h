@@ -11,6 +11,7 @@
 #ifndef BZLA__LS_LS_BV_H
 #define BZLA__LS_LS_BV_H
 
+#include <map>
 #include <optional>
 #include <string>
 
@@ -106,9 +107,45 @@ class LocalSearchBV : public LocalSearch<BitVector>
 
   /** Fix domain bit of given node at index 'idx' to 'value'. */
   void fix_bit(uint64_t id, uint32_t idx, bool value);
+  /**
+   * Fix the domain bits of given leaf node to the fixed bits of the given
+   * domain, and update its assignment (and the assignments in its cone) if
+   * it does not match the new fixed bits.
+   * @param id     The id of the leaf node.
+   * @param domain The domain with the bits to fix.
+   * @return The number of newly fixed bits.
+   */
+  uint64_t fix_bits(uint64_t id, const BitVectorDomain& domain);
+
+  /**
+   * Propagate the constant bits implied by the top-level roots (the roots at
+   * assertion level 0) over all nodes to a fixed point, and fix the resulting
+   * constant bits of leaf nodes (see fix_bits()).
+   *
+   * Constant bits are propagated up and down through bit-level operators,
+   * concats, extracts, sign extensions, equalities, if-then-else and shifts
+   * by a constant, and up through additions. For inequalities, they are
+   * additionally derived from the value ranges of their operands. The
+   * constant bits of non-leaf nodes are not modified.
+   *
+   * @return The number of newly fixed bits of leaf nodes. No bits are fixed
+   *         if a conflict is detected, i.e., if the top-level roots are
+   *         unsatisfiable.
+   */
+  uint64_t propagate_fixpoint();
 
   void compute_bounds(Node<BitVector>* node) override;
 
+  /**
+   * Compute the score of given unsatisfied root. For (negated) equalities,
+   * the score is based on the Hamming distance of the operands, for
+   * (negated) inequalities on the magnitude of their difference. All other
+   * roots have score 0.
+   */
+  double compute_score(Node<BitVector>* root) const override;
+
+  BitVector mk_random_value(Node<BitVector>* input) override;
+
   void normalize() override;
 
  private:
@@ -162,6 +199,19 @@ class LocalSearchBV : public LocalSearch<BitVector>
    */
   void update_bounds_aux(BitVectorNode* root, int32_t pos);
 
+  /**
+   * Helper for propagate_fixpoint(), derives constant bits of given node
+   * from the constant bits of its children and vice versa.
+   * @param node    The node.
+   * @param domains Maps node ids to their current propagated domain,
+   *                nodes without entry have their original domain.
+   * @param changed The ids of the nodes whose domain was updated.
+   * @return False if a conflict was detected.
+   */
+  bool propagate_fixpoint(BitVectorNode* node,
+                          std::map<uint64_t, BitVectorDomain>& domains,
+                          std::vector<uint64_t>& changed);
+
   /**
    * Helper to split index ranges of multiple extracts on the same child such
    * that none of the ranges are overlapping.
@@ -62,6 +62,10 @@ main(int32_t argc, char* argv[])
         std::cout << name << ": " << val << std::endl;
       }
     }
+    if (!main_options.stats_format.empty())
+    {
+      bitwuzla->print_statistics(std::cout, main_options.stats_format);
+    }
   }
   catch (const bitwuzla::parser::Exception& e)
   {
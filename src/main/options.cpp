@@ -156,6 +156,11 @@ print_help()
                     format_longm("lang"),
                     format_dflt(dflt_opts.language),
                     "input language {smt2, btor2}");
+  opts.emplace_back("",
+                    format_longm("stats-format"),
+                    "",
+                    "print statistics in given format after solving "
+                    "{json, prometheus}");
 
   // Format library options
   bitwuzla::Options options;
@@ -187,6 +192,13 @@ print_help()
                         format_dflt(options.get_mode(o)),
                         desc.str());
     }
+    else if (options.is_string(o))
+    {
+      opts.emplace_back(format_shortm(shrt),
+                        format_longm(lng),
+                        format_dflt(options.get_str(o)),
+                        options.description(o));
+    }
     else if (options.is_numeric(o))
     {
       opts.emplace_back(format_shortn(shrt),
@@ -384,6 +396,16 @@ parse_options(int32_t argc, char* argv[], std::vector<std::string>& args)
       opts.language = val;
       lang_forced   = true;
     }
+    else if (check_opt_value(arg, "", "--stats-format"))
+    {
+      auto [opt, val] = parse_arg_val(argc, i, argv);
+      if (val != "json" && val != "prometheus")
+      {
+        Error() << "invalid statistics format given `" << val
+                << "`, expected 'json' or 'prometheus'";
+      }
+      opts.stats_format = val;
+    }
     else if (arg[0] == '-')
     {
       args.push_back(arg);
@@ -401,7 +423,7 @@ parse_options(int32_t argc, char* argv[], std::vector<std::string>& args)
         if (library_opts.is_valid(name))
         {
           auto option = library_opts.option(name.c_str());
-          if (library_opts.is_mode(option))
+          if (library_opts.is_mode(option) || library_opts.is_string(option))
           {
             if (i + 1 < argc)
             {
@@ -25,6 +25,7 @@ struct Options
   uint64_t time_limit     = 0;
   std::string infile_name = "<stdin>";
   std::string language    = "smt2";
+  std::string stats_format;
 };
 
 /**
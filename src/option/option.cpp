@@ -157,8 +157,32 @@ Options::Options()
                    "set maximum memory limit in MB",
                    "memory-limit",
                    "M"),
+      resource_check_interval(this,
+                              Option::RESOURCE_CHECK_INTERVAL,
+                              10,
+                              1,
+                              UINT64_MAX,
+                              "interval in milliseconds at which time and "
+                              "memory limits are checked",
+                              "resource-check-interval",
+                              nullptr,
+                              true),
 
       // Bitwuzla-specific
+      bv_abstraction(this,
+                     Option::BV_ABSTRACTION,
+                     false,
+                     "abstract expensive bit-vector operators and refine "
+                     "lazily",
+                     "bv-abstraction"),
+      bv_mul_encoding(this,
+                      Option::BV_MUL_ENCODING,
+                      BvMulEncoding::SHIFT_ADD,
+                      {{BvMulEncoding::SHIFT_ADD, "shift-add"},
+                       {BvMulEncoding::DADDA, "dadda"},
+                       {BvMulEncoding::KARATSUBA, "karatsuba"}},
+                      "bit-vector multiplication encoding",
+                      "bv-mul-encoding"),
       bv_solver(this,
                 Option::BV_SOLVER,
                 BvSolver::BITBLAST,
@@ -176,6 +200,26 @@ Options::Options()
                  "backend SAT solver",
                  "sat-solver",
                  "S"),
+      sat_decision_limit(this,
+                         Option::SAT_DECISION_LIMIT,
+                         0,
+                         0,
+                         UINT64_MAX,
+                         "limit the number of decisions per SAT solver call "
+                         "(0 for no limit)",
+                         "sat-decision-limit"),
+      sat_proof_file(this,
+                     Option::SAT_PROOF_FILE,
+                     "",
+                     "trace proof of the SAT solver to given file",
+                     "sat-proof-file"),
+      sat_proof_format(this,
+                       Option::SAT_PROOF_FORMAT,
+                       SatProofFormat::DRAT,
+                       {{SatProofFormat::DRAT, "drat"},
+                        {SatProofFormat::LRAT, "lrat"}},
+                       "format of SAT solver proofs",
+                       "sat-proof-format"),
       rewrite_level(this,
                     Option::REWRITE_LEVEL,
                     REWRITE_LEVEL_MAX,
@@ -184,6 +228,18 @@ Options::Options()
                     "rewrite level",
                     "rewrite-level",
                     "rwl"),
+      fp_abstraction(this,
+                     Option::FP_ABSTRACTION,
+                     false,
+                     "abstract expensive floating-point operations and refine "
+                     "lazily",
+                     "fp-abstraction"),
+      model_reuse(this,
+                  Option::MODEL_REUSE,
+                  false,
+                  "check incremental assertions against the previous model "
+                  "before solving",
+                  "model-reuse"),
       // BV: propagation-based local search engine
       prop_nprops(this,
                   Option::PROP_NPROPS,
@@ -257,6 +313,67 @@ Options::Options()
                      false,
                      "enable normalization for local search",
                      "prop-normalize"),
+      prop_fixpoint(this,
+                    Option::PROP_FIXPOINT,
+                    true,
+                    "propagate constant bits implied by top-level constraints "
+                    "to a fixed point before local search",
+                    "prop-fixpoint"),
+      prop_cand_moves(this,
+                      Option::PROP_CAND_MOVES,
+                      1,
+                      1,
+                      100,
+                      "number of candidate moves to select from based on "
+                      "scores (1 disables score-based move selection)",
+                      "prop-cand-moves"),
+      prop_prob_perturb(
+          this,
+          Option::PROP_PROB_PERTURB,
+          100,
+          0,
+          PROB_100,
+          "probability for assigning a random value to an input on restart "
+          "(interpreted as <n>/1000)",
+          "prop-prob-perturb"),
+      prop_restarts(this,
+                    Option::PROP_RESTARTS,
+                    0,
+                    0,
+                    UINT32_MAX,
+                    "number of moves of a Luby restart interval unit for "
+                    "propagation-based local search (0 disables restarts)",
+                    "prop-restarts"),
+      prop_tabu(this,
+                Option::PROP_TABU,
+                0,
+                0,
+                UINT32_MAX,
+                "number of moves an updated input is tabu for "
+                "propagation-based local search (0 disables the tabu list)",
+                "prop-tabu"),
+      prop_sat_fixed(this,
+                     Option::PROP_SAT_FIXED,
+                     true,
+                     "fix constant bits of inputs to the values of bits fixed "
+                     "by the SAT solver in preprop mode",
+                     "prop-sat-fixed"),
+      prop_sat_phases(this,
+                      Option::PROP_SAT_PHASES,
+                      true,
+                      "seed the phases of the SAT solver with the best "
+                      "assignment found by local search in preprop mode",
+                      "prop-sat-phases"),
+      prop_sat_slice(this,
+                     Option::PROP_SAT_SLICE,
+                     0,
+                     0,
+                     UINT64_MAX,
+                     "number of conflicts of the first SAT slice when "
+                     "alternating between local search and bit-blasting in "
+                     "preprop mode, doubled for each slice, no alternation "
+                     "if 0",
+                     "prop-sat-slice"),
 
       // Preprocessing
       preprocess(
@@ -266,6 +383,12 @@ Options::Options()
                     false,
                     "enable contradicting ands preprocessing pass",
                     "pp-contr-ands"),
+      pp_elim_arrays(this,
+                     Option::PP_ELIM_ARRAYS,
+                     false,
+                     "eagerly eliminate arrays with small index domain or few "
+                     "reads",
+                     "pp-elim-arrays"),
       pp_elim_bv_extracts(this,
                           Option::PP_ELIM_BV_EXTRACTS,
                           false,
@@ -281,6 +404,11 @@ Options::Options()
                      true,
                      "enable AND flattening preprocessing pass",
                      "pp-flatten-and"),
+      pp_known_bits(this,
+                    Option::PP_KNOWN_BITS,
+                    false,
+                    "enable known bits preprocessing pass",
+                    "pp-known-bits"),
       pp_normalize(this,
                    Option::PP_NORMALIZE,
                    true,
@@ -323,6 +451,15 @@ Options::Options()
           "enable bit-vector unsigned inequality normalization if variable "
           "substitution preprocessing pass is enabled",
           "pp-variable-subst-norm-bv-ineq"),
+      pp_elim_arrays_thresh(this,
+                            Option::PP_ELIM_ARRAYS_THRESH,
+                            16,
+                            1,
+                            1024,
+                            "maximum index domain size and number of reads "
+                            "of arrays to eliminate if array elimination "
+                            "preprocessing pass is enabled",
+                            "pp-elim-arrays-thresh"),
 
       // Debugging
       dbg_rw_node_thresh(
@@ -386,6 +523,12 @@ Options::is_mode(Option opt)
   return data(opt)->is_mode();
 }
 
+bool
+Options::is_string(Option opt)
+{
+  return data(opt)->is_string();
+}
+
 bool
 Options::is_valid(const std::string& name) const
 {
@@ -460,9 +603,16 @@ template <>
 void
 Options::set(Option opt, const std::string& value, bool is_user_set)
 {
-  assert(data(opt)->is_mode());
+  assert(data(opt)->is_mode() || data(opt)->is_string());
   assert(is_user_set || !data(opt)->d_is_user_set);
-  reinterpret_cast<OptionMode*>(data(opt))->set_str(value, is_user_set);
+  if (data(opt)->is_string())
+  {
+    reinterpret_cast<OptionString*>(data(opt))->set(value, is_user_set);
+  }
+  else
+  {
+    reinterpret_cast<OptionMode*>(data(opt))->set_str(value, is_user_set);
+  }
 }
 
 void
@@ -493,7 +643,7 @@ Options::set(const std::string& name,
   }
   else
   {
-    assert(is_mode(it->second));
+    assert(is_mode(it->second) || is_string(it->second));
     set<std::string>(it->second, value, is_user_set);
   }
 }
@@ -518,7 +668,11 @@ template <>
 const std::string&
 Options::get(Option opt)
 {
-  assert(data(opt)->is_mode());
+  assert(data(opt)->is_mode() || data(opt)->is_string());
+  if (data(opt)->is_string())
+  {
+    return (*reinterpret_cast<OptionString*>(data(opt)))();
+  }
   return reinterpret_cast<OptionMode*>(data(opt))->get_str();
 }
 
@@ -542,7 +696,11 @@ template <>
 const std::string&
 Options::dflt(Option opt)
 {
-  assert(data(opt)->is_mode());
+  assert(data(opt)->is_mode() || data(opt)->is_string());
+  if (data(opt)->is_string())
+  {
+    return reinterpret_cast<OptionString*>(data(opt))->dflt();
+  }
   return reinterpret_cast<OptionMode*>(data(opt))->dflt_str();
 }
 
@@ -612,13 +770,21 @@ Options::data(Option opt)
     case Option::PRODUCE_UNSAT_ASSUMPTIONS: return &produce_unsat_assumptions;
     case Option::PRODUCE_UNSAT_CORES: return &produce_unsat_cores;
     case Option::SAT_SOLVER: return &sat_solver;
+    case Option::SAT_DECISION_LIMIT: return &sat_decision_limit;
+    case Option::SAT_PROOF_FILE: return &sat_proof_file;
+    case Option::SAT_PROOF_FORMAT: return &sat_proof_format;
     case Option::SEED: return &seed;
     case Option::VERBOSITY: return &verbosity;
     case Option::TIME_LIMIT_PER: return &time_limit_per;
     case Option::MEMORY_LIMIT: return &memory_limit;
+    case Option::RESOURCE_CHECK_INTERVAL: return &resource_check_interval;
 
+    case Option::BV_ABSTRACTION: return &bv_abstraction;
+    case Option::BV_MUL_ENCODING: return &bv_mul_encoding;
     case Option::BV_SOLVER: return &bv_solver;
     case Option::REWRITE_LEVEL: return &rewrite_level;
+    case Option::FP_ABSTRACTION: return &fp_abstraction;
+    case Option::MODEL_REUSE: return &model_reuse;
 
     case Option::PROP_NPROPS: return &prop_nprops;
     case Option::PROP_NUPDATES: return &prop_nupdates;
@@ -631,12 +797,22 @@ Options::data(Option opt)
     case Option::PROP_OPT_LT_CONCAT_SEXT: return &prop_opt_lt_concat_sext;
     case Option::PROP_SEXT: return &prop_sext;
     case Option::PROP_NORMALIZE: return &prop_normalize;
+    case Option::PROP_FIXPOINT: return &prop_fixpoint;
+    case Option::PROP_CAND_MOVES: return &prop_cand_moves;
+    case Option::PROP_PROB_PERTURB: return &prop_prob_perturb;
+    case Option::PROP_RESTARTS: return &prop_restarts;
+    case Option::PROP_TABU: return &prop_tabu;
+    case Option::PROP_SAT_FIXED: return &prop_sat_fixed;
+    case Option::PROP_SAT_PHASES: return &prop_sat_phases;
+    case Option::PROP_SAT_SLICE: return &prop_sat_slice;
 
     case Option::PREPROCESS: return &preprocess;
     case Option::PP_CONTRADICTING_ANDS: return &pp_contr_ands;
+    case Option::PP_ELIM_ARRAYS: return &pp_elim_arrays;
     case Option::PP_ELIM_BV_EXTRACTS: return &pp_elim_bv_extracts;
     case Option::PP_EMBEDDED_CONSTR: return &pp_embedded_constr;
     case Option::PP_FLATTEN_AND: return &pp_flatten_and;
+    case Option::PP_KNOWN_BITS: return &pp_known_bits;
     case Option::PP_NORMALIZE: return &pp_normalize;
     case Option::PP_NORMALIZE_SHARE_AWARE: return &pp_normalize_share_aware;
     case Option::PP_SKELETON_PREPROC: return &pp_skeleton_preproc;
@@ -646,6 +822,7 @@ Options::data(Option opt)
     case Option::PP_VARIABLE_SUBST_NORM_EQ: return &pp_variable_subst_norm_eq;
     case Option::PP_VARIABLE_SUBST_NORM_DISEQ:
       return &pp_variable_subst_norm_diseq;
+    case Option::PP_ELIM_ARRAYS_THRESH: return &pp_elim_arrays_thresh;
 
     case Option::DBG_RW_NODE_THRESH: return &dbg_rw_node_thresh;
     case Option::DBG_PP_NODE_THRESH: return &dbg_pp_node_thresh;
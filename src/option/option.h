@@ -32,10 +32,18 @@ enum class Option
   VERBOSITY,                  // numeric
   TIME_LIMIT_PER,             // numeric
   MEMORY_LIMIT,               // numeric
-
-  BV_SOLVER,      // enum
-  REWRITE_LEVEL,  // numeric
-  SAT_SOLVER,     // enum
+  RESOURCE_CHECK_INTERVAL,    // numeric
+
+  BV_ABSTRACTION,   // bool
+  BV_MUL_ENCODING,  // enum
+  BV_SOLVER,        // enum
+  FP_ABSTRACTION,      // bool
+  MODEL_REUSE,         // bool
+  REWRITE_LEVEL,       // numeric
+  SAT_SOLVER,          // enum
+  SAT_DECISION_LIMIT,  // numeric
+  SAT_PROOF_FILE,      // string
+  SAT_PROOF_FORMAT,    // enum
 
   PROP_NPROPS,                  // numeric
   PROP_NUPDATES,                // numeric
@@ -47,13 +55,23 @@ enum class Option
   PROP_OPT_LT_CONCAT_SEXT,      // bool
   PROP_SEXT,                    // bool
   PROP_NORMALIZE,               // bool
+  PROP_FIXPOINT,                // bool
+  PROP_CAND_MOVES,              // numeric
+  PROP_PROB_PERTURB,            // numeric
+  PROP_RESTARTS,                // numeric
+  PROP_TABU,                    // numeric
+  PROP_SAT_FIXED,               // bool
+  PROP_SAT_PHASES,              // bool
+  PROP_SAT_SLICE,               // numeric
 
   // Preprocessing options for enabling/disabling passes
   PREPROCESS,                // bool
   PP_CONTRADICTING_ANDS,     // bool
+  PP_ELIM_ARRAYS,            // bool
   PP_ELIM_BV_EXTRACTS,       // bool
   PP_EMBEDDED_CONSTR,        // bool
   PP_FLATTEN_AND,            // bool
+  PP_KNOWN_BITS,             // bool
   PP_NORMALIZE,              // bool
   PP_NORMALIZE_SHARE_AWARE,  // bool
   PP_SKELETON_PREPROC,       // bool
@@ -61,6 +79,7 @@ enum class Option
   PP_OPT_END,
 
   // Preprocessing pass options for configuring passes
+  PP_ELIM_ARRAYS_THRESH,           // numeric
   PP_VARIABLE_SUBST_NORM_BV_INEQ,  // bool
   PP_VARIABLE_SUBST_NORM_EQ,       // bool
   PP_VARIABLE_SUBST_NORM_DISEQ,    // bool
@@ -86,6 +105,13 @@ enum class BvNumberFormat
   HEX,
 };
 
+enum class BvMulEncoding
+{
+  SHIFT_ADD,
+  DADDA,
+  KARATSUBA,
+};
+
 enum class BvSolver
 {
   BITBLAST,
@@ -100,6 +126,12 @@ enum class SatSolver
   KISSAT,
 };
 
+enum class SatProofFormat
+{
+  DRAT,
+  LRAT,
+};
+
 enum class PropPathSelection
 {
   ESSENTIAL,
@@ -144,6 +176,8 @@ class OptionBase
    * @return True if this option is an option that takes a mode (an enum value).
    */
   virtual bool is_mode() { return false; }
+  /** @return True if this option is an option that takes a string value. */
+  virtual bool is_string() { return false; }
 
   /** @return The description of this option. */
   const char* description() const { return d_description; }
@@ -307,6 +341,67 @@ class OptionNumeric : public OptionBase
   bool d_allow_inc;
 };
 
+/** Option info data for options that take an arbitrary string value. */
+class OptionString : public OptionBase
+{
+ public:
+  /**
+   * Constructor.
+   *
+   * @note On construction, given string value determines the initial and the
+   *       default value of the option.
+   *
+   * @param options   The associated options object.
+   * @param opt       The corresponding option.
+   * @param value     The initial and default value of the option.
+   * @param desc      The option description (used for CLI help message).
+   * @param lng       The long name of the option (`--<lng>` for the CLI).
+   * @param shrt      The short name of the option (`-<shrt>` for the CLI).
+   * @param is_expert True if this is an expert option.
+   */
+  OptionString(Options* options,
+               Option opt,
+               const std::string& value,
+               const char* desc,
+               const char* lng,
+               const char* shrt = nullptr,
+               bool is_expert   = false)
+      : OptionBase(options, opt, desc, lng, shrt, is_expert),
+        d_value(value),
+        d_default(value)
+  {
+  }
+  OptionString() = delete;
+
+  bool is_string() override { return true; }
+
+  /**
+   * Set the current value of a string option.
+   * @param value       The current value.
+   * @param is_user_set True if this option was configured from outside.
+   */
+  void set(const std::string& value, bool is_user_set = false)
+  {
+    d_value       = value;
+    d_is_user_set = is_user_set;
+  }
+
+  /**
+   * Get the current value of a string option.
+   * @return The current value of a string option.
+   */
+  const std::string& operator()() const { return d_value; }
+
+  /** @return The default value of this option. */
+  const std::string& dflt() const { return d_default; }
+
+ private:
+  /** The current value. */
+  std::string d_value;
+  /** The default value. */
+  std::string d_default;
+};
+
 /**
  * Base class for option info data for options that have modes (take enum
  * values).
@@ -455,11 +550,19 @@ class Options
   OptionNumeric verbosity;
   OptionNumeric time_limit_per;
   OptionNumeric memory_limit;
+  OptionNumeric resource_check_interval;
 
   // Bitwuzla-specific options
+  OptionBool bv_abstraction;
+  OptionModeT<BvMulEncoding> bv_mul_encoding;
   OptionModeT<BvSolver> bv_solver;
   OptionModeT<SatSolver> sat_solver;
+  OptionNumeric sat_decision_limit;
+  OptionString sat_proof_file;
+  OptionModeT<SatProofFormat> sat_proof_format;
   OptionNumeric rewrite_level;
+  OptionBool fp_abstraction;
+  OptionBool model_reuse;
 
   // BV: propagation-based local search engine
   OptionNumeric prop_nprops;
@@ -472,13 +575,23 @@ class Options
   OptionBool prop_opt_lt_concat_sext;
   OptionBool prop_sext;
   OptionBool prop_normalize;
+  OptionBool prop_fixpoint;
+  OptionNumeric prop_cand_moves;
+  OptionNumeric prop_prob_perturb;
+  OptionNumeric prop_restarts;
+  OptionNumeric prop_tabu;
+  OptionBool prop_sat_fixed;
+  OptionBool prop_sat_phases;
+  OptionNumeric prop_sat_slice;
 
   // Preprocessing
   OptionBool preprocess;
   OptionBool pp_contr_ands;
+  OptionBool pp_elim_arrays;
   OptionBool pp_elim_bv_extracts;
   OptionBool pp_embedded_constr;
   OptionBool pp_flatten_and;
+  OptionBool pp_known_bits;
   OptionBool pp_normalize;
   OptionBool pp_normalize_share_aware;
   OptionBool pp_skeleton_preproc;
@@ -486,6 +599,7 @@ class Options
   OptionBool pp_variable_subst_norm_eq;
   OptionBool pp_variable_subst_norm_diseq;
   OptionBool pp_variable_subst_norm_bv_ineq;
+  OptionNumeric pp_elim_arrays_thresh;
 
   // Debug options
   OptionNumeric dbg_rw_node_thresh;
@@ -502,6 +616,8 @@ class Options
   bool is_numeric_inc(Option opt);
   /** @return True if the given option is an option with modes. */
   bool is_mode(Option opt);
+  /** @return True if the given option is a string option. */
+  bool is_string(Option opt);
 
   /** @return True if given string is a valid short or long option name. */
   bool is_valid(const std::string& name) const;
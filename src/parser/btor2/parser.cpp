@@ -897,7 +897,8 @@ Parser::error_eof()
 /* Parser::Statistics ------------------------------------------------------- */
 
 Parser::Statistics::Statistics()
-    : num_lines(d_stats.new_stat<uint64_t>("parser::btor2:num_lines")),
+    : num_lines(
+          d_stats.new_stat<util::CounterStatistic>("parser::btor2:num_lines")),
       time_parse(
           d_stats.new_stat<util::TimerStatistic>("parser::btor2::time_parse"))
 {
@@ -160,7 +160,7 @@ class Parser : public bzla::parser::Parser
     util::Statistics d_stats;
 
     /** The overall number of parsed lines. */
-    uint64_t& num_lines;
+    util::CounterStatistic& num_lines;
 
     /**
      * The time required for parsing.
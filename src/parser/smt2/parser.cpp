@@ -1121,8 +1121,9 @@ Parser::parse_command_set_option()
     {
       try
       {
-        const char* value = d_lexer->token();
-        if (d_options.is_mode(d_options.option(opt.c_str())))
+        const char* value       = d_lexer->token();
+        bitwuzla::Option option = d_options.option(opt.c_str());
+        if (d_options.is_mode(option) || d_options.is_string(option))
         {
           size_t len = strlen(value);
           if (value[0] != '"' || value[len - 1] != '"')
@@ -3575,11 +3576,20 @@ Parser::print_work_control_stack()
 /* Parser::Statistics ------------------------------------------------------- */
 
 Parser::Statistics::Statistics()
-    : num_assertions(d_stats.new_stat<uint64_t>("parser::smt2:num_assertions")),
-      num_check_sat(d_stats.new_stat<uint64_t>("parser::smt2:num_check_sat")),
-      num_commands(d_stats.new_stat<uint64_t>("parser::smt2:num_commands")),
-      num_exit(d_stats.new_stat<uint64_t>("parser::smt2:num_exit")),
-      num_set_logic(d_stats.new_stat<uint64_t>("parser::smt2:num_set_logic")),
+    : num_assertions(
+          d_stats.new_stat<util::CounterStatistic>(
+              "parser::smt2:num_assertions")),
+      num_check_sat(
+          d_stats.new_stat<util::CounterStatistic>(
+              "parser::smt2:num_check_sat")),
+      num_commands(
+          d_stats.new_stat<util::CounterStatistic>(
+              "parser::smt2:num_commands")),
+      num_exit(
+          d_stats.new_stat<util::CounterStatistic>("parser::smt2:num_exit")),
+      num_set_logic(
+          d_stats.new_stat<util::CounterStatistic>(
+              "parser::smt2:num_set_logic")),
       time_parse(
           d_stats.new_stat<util::TimerStatistic>("parser::smt2::time_parse"))
 {
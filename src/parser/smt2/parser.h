@@ -862,15 +862,15 @@ class Parser : public bzla::parser::Parser
     util::Statistics d_stats;
 
     /** The number of assert commands. */
-    uint64_t& num_assertions;
+    util::CounterStatistic& num_assertions;
     /** The number of check-sat(-assuming) commands. */
-    uint64_t& num_check_sat;
+    util::CounterStatistic& num_check_sat;
     /** The overall number of commands. */
-    uint64_t& num_commands;
+    util::CounterStatistic& num_commands;
     /** The number of exit commands. */
-    uint64_t& num_exit;
+    util::CounterStatistic& num_exit;
     /** The number of set-logic commands. */
-    uint64_t& num_set_logic;
+    util::CounterStatistic& num_set_logic;
 
     /**
      * The time required for parsing.
@@ -165,7 +165,7 @@ PassContradictingAnds::process(const Node& node)
 
 PassContradictingAnds::Statistics::Statistics(util::Statistics& stats,
                                               const std::string& prefix)
-    : num_substs(stats.new_stat<uint64_t>(prefix + "num_substs"))
+    : num_substs(stats.new_stat<util::CounterStatistic>(prefix + "num_substs"))
 {
 }
 
@@ -53,7 +53,7 @@ class PassContradictingAnds : public PreprocessingPass
   struct Statistics
   {
     Statistics(util::Statistics& stats, const std::string& prefix);
-    uint64_t& num_substs;
+    util::CounterStatistic& num_substs;
   } d_stats;
 };
 
@@ -0,0 +1,529 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "preprocess/pass/elim_arrays.h"
+
+#include "env.h"
+#include "node/node_manager.h"
+#include "node/node_ref_vector.h"
+#include "node/node_utils.h"
+
+namespace bzla::preprocess::pass {
+
+using namespace node;
+
+/* --- PassElimArrays public ------------------------------------------------ */
+
+PassElimArrays::PassElimArrays(Env& env,
+                               backtrack::BacktrackManager* backtrack_mgr)
+    : PreprocessingPass(env, backtrack_mgr, "ea", "elim_arrays"),
+      d_substitutions(backtrack_mgr),
+      d_model_substitutions(backtrack_mgr),
+      d_ackermannized(backtrack_mgr),
+      d_linked(backtrack_mgr),
+      d_stats(env.statistics())
+{
+}
+
+void
+PassElimArrays::apply(AssertionVector& assertions)
+{
+  // Disabled if unsat cores enabled.
+  if (d_env.options().produce_unsat_cores())
+  {
+    return;
+  }
+
+  util::Timer timer(d_stats_pass.time_apply);
+  d_collect_cache.clear();
+
+  NodeManager& nm = d_env.nm();
+
+  std::unordered_set<Node> consts, blocked;
+  std::unordered_map<Node, std::vector<Node>> reads;
+  bool has_binder = false;
+  bool modified   = false;
+
+  // We always have to consider all assertions since Ackermannization requires
+  // all occurrences of an array constant.
+  for (size_t i = 0, size = assertions.size(); i < size; ++i)
+  {
+    modified |= collect(assertions[i], consts, reads, blocked, has_binder);
+  }
+
+  // Expand array constants with small index domain.
+  for (const Node& c : consts)
+  {
+    if (is_small(c.type()))
+    {
+      if (d_substitutions.find(c) == d_substitutions.end())
+      {
+        Node expanded = mk_expanded_array(c);
+        d_substitutions.emplace(c, expanded);
+        d_model_substitutions.emplace(c, expanded);
+        ++d_stats.num_expanded;
+      }
+      modified = true;
+    }
+  }
+
+  // Ackermannize array constants with few reads. Only done for the initial
+  // set of assertions since for later assertions, previous occurrences of an
+  // array constant are already registered with the solver.
+  backtrack::unordered_map<Node, Node> read_substs(nullptr);
+  std::vector<std::pair<Node, std::vector<std::pair<Node, Node>>>> ackermann;
+  if (assertions.initial_assertions() && !has_binder)
+  {
+    uint64_t thresh = d_env.options().pp_elim_arrays_thresh();
+    for (const auto& [c, sels] : reads)
+    {
+      if (is_small(c.type()) || blocked.find(c) != blocked.end()
+          || d_ackermannized.find(c) != d_ackermannized.end()
+          || sels.size() > thresh)
+      {
+        continue;
+      }
+      auto& [array, elements] = ackermann.emplace_back();
+      array                   = c;
+      for (const Node& sel : sels)
+      {
+        Node e = nm.mk_const(c.type().array_element());
+        read_substs.emplace(sel, e);
+        elements.emplace_back(sel, e);
+      }
+      modified = true;
+    }
+  }
+
+  // Link Ackermannized array constants that reappear in new assertions.
+  std::vector<Node> relink;
+  for (const Node& c : consts)
+  {
+    if (d_ackermannized.find(c) != d_ackermannized.end()
+        && d_linked.find(c) == d_linked.end())
+    {
+      relink.push_back(c);
+    }
+  }
+
+  if (modified)
+  {
+    d_read_cache.clear();
+    d_subst_cache.clear();
+    d_elim_cache.clear();
+    d_row_cache.clear();
+    for (size_t i = 0, size = assertions.size(); i < size; ++i)
+    {
+      const Node& assertion = assertions[i];
+      assertions.replace(i, process(assertion, read_substs));
+    }
+  }
+
+  for (const auto& [array, elements] : ackermann)
+  {
+    ackermannize(assertions, array, elements, read_substs);
+  }
+  for (const Node& array : relink)
+  {
+    link(assertions, array);
+  }
+
+  d_collect_cache.clear();
+  d_read_cache.clear();
+  d_subst_cache.clear();
+  d_elim_cache.clear();
+  d_row_cache.clear();
+}
+
+Node
+PassElimArrays::process(const Node& term)
+{
+  // Substitute eliminated array constants with their model substitution,
+  // unless they were linked back into the solver.
+  std::unordered_map<Node, Node> cache;
+  node_ref_vector visit{term};
+  do
+  {
+    const Node& cur     = visit.back();
+    auto [it, inserted] = cache.emplace(cur, Node());
+    auto its            = d_model_substitutions.find(cur);
+    bool subst          = its != d_model_substitutions.end()
+                 && d_linked.find(cur) == d_linked.end();
+    if (inserted)
+    {
+      // The substitution may contain other eliminated array constants.
+      if (subst)
+      {
+        visit.push_back(its->second);
+      }
+      else
+      {
+        visit.insert(visit.end(), cur.begin(), cur.end());
+      }
+      continue;
+    }
+    else if (it->second.is_null())
+    {
+      if (subst)
+      {
+        auto itc = cache.find(its->second);
+        assert(itc != cache.end());
+        assert(!itc->second.is_null());
+        it->second = itc->second;
+      }
+      else
+      {
+        std::vector<Node> children;
+        for (const Node& child : cur)
+        {
+          auto itc = cache.find(child);
+          assert(itc != cache.end());
+          assert(!itc->second.is_null());
+          children.push_back(itc->second);
+        }
+        it->second = utils::rebuild_node(d_env.nm(), cur, children);
+      }
+    }
+    visit.pop_back();
+  } while (!visit.empty());
+  return cache.at(term);
+}
+
+/* --- PassElimArrays private ----------------------------------------------- */
+
+bool
+PassElimArrays::is_small(const Type& type) const
+{
+  if (!type.is_array())
+  {
+    return false;
+  }
+  const Type& index = type.array_index();
+  uint64_t thresh   = d_env.options().pp_elim_arrays_thresh();
+  if (index.is_bool())
+  {
+    return thresh >= 2;
+  }
+  if (index.is_bv())
+  {
+    uint64_t size = index.bv_size();
+    return size < 64 && (static_cast<uint64_t>(1) << size) <= thresh;
+  }
+  return false;
+}
+
+std::vector<Node>
+PassElimArrays::index_values(const Type& type) const
+{
+  assert(is_small(type));
+  NodeManager& nm   = d_env.nm();
+  const Type& index = type.array_index();
+  std::vector<Node> values;
+  if (index.is_bool())
+  {
+    values.push_back(nm.mk_value(false));
+    values.push_back(nm.mk_value(true));
+  }
+  else
+  {
+    uint64_t size = index.bv_size();
+    for (uint64_t i = 0, n = static_cast<uint64_t>(1) << size; i < n; ++i)
+    {
+      values.push_back(nm.mk_value(BitVector::from_ui(size, i)));
+    }
+  }
+  return values;
+}
+
+bool
+PassElimArrays::collect(const Node& assertion,
+                        std::unordered_set<Node>& consts,
+                        std::unordered_map<Node, std::vector<Node>>& reads,
+                        std::unordered_set<Node>& blocked,
+                        bool& has_binder)
+{
+  bool res = false;
+  node_ref_vector visit{assertion};
+  do
+  {
+    const Node& cur = visit.back();
+    visit.pop_back();
+
+    if (!d_collect_cache.insert(cur).second)
+    {
+      continue;
+    }
+
+    Kind k = cur.kind();
+    if (cur.is_const() && cur.type().is_array())
+    {
+      consts.insert(cur);
+      continue;
+    }
+
+    if (k == Kind::FORALL || k == Kind::EXISTS || k == Kind::LAMBDA)
+    {
+      has_binder = true;
+    }
+    else if (k == Kind::SELECT)
+    {
+      const Node& array = cur[0];
+      if (is_small(array.type()))
+      {
+        Kind ka = array.kind();
+        res |= ka == Kind::STORE || ka == Kind::ITE || ka == Kind::CONST_ARRAY;
+      }
+      else if (array.is_const())
+      {
+        reads[array].push_back(cur);
+      }
+    }
+    else if (k == Kind::EQUAL && is_small(cur[0].type()))
+    {
+      res = true;
+    }
+
+    for (size_t i = 0, size = cur.num_children(); i < size; ++i)
+    {
+      const Node& child = cur[i];
+      // Array constants are only allowed to occur as array of a read to be
+      // eligible for Ackermannization.
+      if (child.is_const() && child.type().is_array()
+          && (k != Kind::SELECT || i != 0))
+      {
+        blocked.insert(child);
+      }
+      visit.push_back(child);
+    }
+  } while (!visit.empty());
+  return res;
+}
+
+Node
+PassElimArrays::mk_expanded_array(const Node& array)
+{
+  NodeManager& nm          = d_env.nm();
+  const Type& type         = array.type();
+  std::vector<Node> values = index_values(type);
+  const Type& element_type = type.array_element();
+
+  // The last index value is covered by the base constant array, which yields
+  // if-then-else chains without unreachable default value when reads are
+  // pushed down.
+  Node res = nm.mk_const_array(type, nm.mk_const(element_type));
+  for (size_t i = 0, size = values.size() - 1; i < size; ++i)
+  {
+    res = nm.mk_node(Kind::STORE, {res, values[i], nm.mk_const(element_type)});
+  }
+  return res;
+}
+
+void
+PassElimArrays::ackermannize(AssertionVector& assertions,
+                             const Node& array,
+                             const std::vector<std::pair<Node, Node>>& reads,
+                             const backtrack::unordered_map<Node, Node>& substs)
+{
+  NodeManager& nm = d_env.nm();
+  Node null;
+
+  std::vector<std::pair<Node, Node>> elements;
+  for (const auto& [sel, e] : reads)
+  {
+    // Indices may contain reads that were eliminated.
+    elements.emplace_back(process(sel[1], substs), e);
+  }
+
+  for (size_t i = 0, size = elements.size(); i < size; ++i)
+  {
+    const auto& [index_i, e_i] = elements[i];
+    for (size_t j = i + 1; j < size; ++j)
+    {
+      const auto& [index_j, e_j] = elements[j];
+      Node lemma = nm.mk_node(Kind::IMPLIES,
+                              {nm.mk_node(Kind::EQUAL, {index_i, index_j}),
+                               nm.mk_node(Kind::EQUAL, {e_i, e_j})});
+      assertions.push_back(d_env.rewriter().rewrite(lemma), null);
+      ++d_stats.num_lemmas;
+    }
+  }
+
+  // Model values for the array are given by the values of the reads.
+  Node model = utils::mk_default_value(nm, array.type());
+  for (const auto& [index, e] : elements)
+  {
+    model = nm.mk_node(Kind::STORE, {model, index, e});
+  }
+  d_model_substitutions.emplace(array, model);
+  d_ackermannized.emplace(array, elements);
+  ++d_stats.num_ackermannized;
+}
+
+void
+PassElimArrays::link(AssertionVector& assertions, const Node& array)
+{
+  NodeManager& nm = d_env.nm();
+  Node null;
+
+  auto it = d_ackermannized.find(array);
+  assert(it != d_ackermannized.end());
+  for (const auto& [index, e] : it->second)
+  {
+    Node lemma = nm.mk_node(
+        Kind::EQUAL, {nm.mk_node(Kind::SELECT, {array, index}), e});
+    assertions.push_back(d_env.rewriter().rewrite(lemma), null);
+  }
+  d_linked.insert(array);
+  ++d_stats.num_linked;
+}
+
+Node
+PassElimArrays::process(const Node& node,
+                        const backtrack::unordered_map<Node, Node>& substs)
+{
+  Node res = node;
+  if (!substs.empty())
+  {
+    res = substitute(res, substs, d_read_cache).first;
+  }
+  if (!d_substitutions.empty())
+  {
+    res = substitute(res, d_substitutions, d_subst_cache).first;
+  }
+  return d_env.rewriter().rewrite(eliminate(res));
+}
+
+Node
+PassElimArrays::eliminate(const Node& term)
+{
+  NodeManager& nm = d_env.nm();
+  node_ref_vector visit{term};
+  do
+  {
+    const Node& cur     = visit.back();
+    auto [it, inserted] = d_elim_cache.emplace(cur, Node());
+    if (inserted)
+    {
+      visit.insert(visit.end(), cur.begin(), cur.end());
+      continue;
+    }
+    else if (it->second.is_null())
+    {
+      std::vector<Node> children;
+      for (const Node& child : cur)
+      {
+        auto itc = d_elim_cache.find(child);
+        assert(itc != d_elim_cache.end());
+        assert(!itc->second.is_null());
+        children.push_back(itc->second);
+      }
+
+      Kind k = cur.kind();
+      if (k == Kind::SELECT && is_small(children[0].type()))
+      {
+        it->second = read_over_write(children[0], children[1]);
+      }
+      else if (k == Kind::EQUAL && is_small(children[0].type()))
+      {
+        // Extensionality over a finite index domain.
+        std::vector<Node> eqs;
+        for (const Node& value : index_values(children[0].type()))
+        {
+          eqs.push_back(nm.mk_node(Kind::EQUAL,
+                                   {read_over_write(children[0], value),
+                                    read_over_write(children[1], value)}));
+        }
+        it->second = utils::mk_nary(nm, Kind::AND, eqs);
+      }
+      else
+      {
+        it->second = utils::rebuild_node(nm, cur, children);
+      }
+    }
+    visit.pop_back();
+  } while (!visit.empty());
+  return d_elim_cache.at(term);
+}
+
+Node
+PassElimArrays::read_over_write(const Node& array, const Node& index)
+{
+  NodeManager& nm = d_env.nm();
+  Node sel        = nm.mk_node(Kind::SELECT, {array, index});
+  auto it         = d_row_cache.find(sel);
+  if (it != d_row_cache.end())
+  {
+    return it->second;
+  }
+
+  // Collect the stores that may be hit by index.
+  std::vector<std::pair<Node, Node>> stores;
+  Node cur = array;
+  Node res;
+  while (res.is_null())
+  {
+    Kind k = cur.kind();
+    if (k == Kind::STORE)
+    {
+      if (cur[1] == index)
+      {
+        res = cur[2];
+      }
+      else
+      {
+        if (!cur[1].is_value() || !index.is_value())
+        {
+          stores.emplace_back(nm.mk_node(Kind::EQUAL, {index, cur[1]}),
+                              cur[2]);
+        }
+        cur = cur[0];
+      }
+    }
+    else if (k == Kind::ITE)
+    {
+      res = nm.mk_node(Kind::ITE,
+                       {cur[0],
+                        read_over_write(cur[1], index),
+                        read_over_write(cur[2], index)});
+    }
+    else if (k == Kind::CONST_ARRAY)
+    {
+      res = cur[0];
+    }
+    else
+    {
+      res = nm.mk_node(Kind::SELECT, {cur, index});
+    }
+  }
+
+  for (auto its = stores.rbegin(); its != stores.rend(); ++its)
+  {
+    res = nm.mk_node(Kind::ITE, {its->first, its->second, res});
+  }
+  d_row_cache.emplace(sel, res);
+  return res;
+}
+
+PassElimArrays::Statistics::Statistics(util::Statistics& stats)
+    : num_expanded(
+        stats.new_stat<util::CounterStatistic>(
+            "preprocess::elim_arrays::num_expanded")),
+      num_ackermannized(stats.new_stat<util::CounterStatistic>(
+          "preprocess::elim_arrays::num_ackermannized")),
+      num_lemmas(
+          stats.new_stat<util::CounterStatistic>(
+              "preprocess::elim_arrays::num_lemmas")),
+      num_linked(
+          stats.new_stat<util::CounterStatistic>(
+              "preprocess::elim_arrays::num_linked"))
+{
+}
+
+}  // namespace bzla::preprocess::pass
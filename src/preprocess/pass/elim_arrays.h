@@ -0,0 +1,163 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_PREPROCESS_PASS_ELIM_ARRAYS_H_INCLUDED
+#define BZLA_PREPROCESS_PASS_ELIM_ARRAYS_H_INCLUDED
+
+#include <unordered_map>
+#include <unordered_set>
+
+#include "backtrack/unordered_map.h"
+#include "backtrack/unordered_set.h"
+#include "preprocess/preprocessing_pass.h"
+#include "util/statistics.h"
+
+namespace bzla::preprocess::pass {
+
+/**
+ * Preprocessing pass to eagerly eliminate arrays.
+ *
+ * Array constants with a small index domain are replaced by a chain of stores
+ * over all index values with fresh element constants, and reads on them are
+ * turned into if-then-else chains over the element constants. Array constants
+ * with a large index domain that only occur as the array of a few reads are
+ * eliminated via Ackermannization, i.e., each read is replaced with a fresh
+ * constant and functional consistency is ensured by adding lemmas
+ * `i = j -> e_i = e_j` for each pair of reads.
+ */
+class PassElimArrays : public PreprocessingPass
+{
+ public:
+  PassElimArrays(Env& env, backtrack::BacktrackManager* backtrack_mgr);
+
+  void apply(AssertionVector& assertions) override;
+
+  Node process(const Node& term) override;
+
+ private:
+  /**
+   * @return True if arrays of given type have an index domain that is small
+   *         enough to be expanded.
+   */
+  bool is_small(const Type& type) const;
+
+  /** @return The values of the index domain of given (small) array type. */
+  std::vector<Node> index_values(const Type& type) const;
+
+  /**
+   * Collect array constants and reads on array constants reachable from
+   * assertion.
+   *
+   * @param assertion The assertion.
+   * @param consts The set of array constants.
+   * @param reads Maps array constants to reads that have the constant as
+   *              array.
+   * @param blocked The set of array constants that occur in other positions
+   *                than the array of a read.
+   * @param has_binder Set to true if the assertion contains binders.
+   * @return True if the assertion contains terms that are eliminated by this
+   *         pass.
+   */
+  bool collect(const Node& assertion,
+               std::unordered_set<Node>& consts,
+               std::unordered_map<Node, std::vector<Node>>& reads,
+               std::unordered_set<Node>& blocked,
+               bool& has_binder);
+
+  /**
+   * Create store chain over all values of the index domain of given array
+   * constant with fresh element constants.
+   */
+  Node mk_expanded_array(const Node& array);
+
+  /**
+   * Add functional consistency lemmas for the reads of an Ackermannized array
+   * constant and record its model substitution.
+   *
+   * @param assertions The current set of assertions.
+   * @param array The array constant.
+   * @param reads The reads on `array` paired with the fresh constants they
+   *              are substituted with.
+   * @param substs The substitution map for reads.
+   */
+  void ackermannize(AssertionVector& assertions,
+                    const Node& array,
+                    const std::vector<std::pair<Node, Node>>& reads,
+                    const backtrack::unordered_map<Node, Node>& substs);
+
+  /**
+   * Add lemmas that link the reads of an Ackermannized array constant to
+   * their element constants. Required if the array constant reappears in
+   * assertions added after it was Ackermannized.
+   *
+   * @param assertions The current set of assertions.
+   * @param array The array constant.
+   */
+  void link(AssertionVector& assertions, const Node& array);
+
+  /**
+   * Apply read substitutions, substitute small index domain array constants
+   * and eliminate reads and equalities over them.
+   *
+   * @param node The node to process.
+   * @param substs The substitution map for reads.
+   * @return The processed and rewritten node.
+   */
+  Node process(const Node& node,
+               const backtrack::unordered_map<Node, Node>& substs);
+
+  /**
+   * Eliminate reads and equalities over arrays with small index domain in
+   * given term.
+   */
+  Node eliminate(const Node& term);
+
+  /**
+   * Push read on `index` down through stores, if-then-else and constant
+   * arrays.
+   */
+  Node read_over_write(const Node& array, const Node& index);
+
+  /** Cache for visited nodes when collecting array constants. */
+  std::unordered_set<Node> d_collect_cache;
+  /** Cache for substituting reads. */
+  std::unordered_map<Node, Node> d_read_cache;
+  /** Cache for substituting small index domain array constants. */
+  std::unordered_map<Node, Node> d_subst_cache;
+  /** Cache for eliminate(). */
+  std::unordered_map<Node, Node> d_elim_cache;
+  /** Cache for read_over_write(), maps select nodes to their expansion. */
+  std::unordered_map<Node, Node> d_row_cache;
+
+  /** Maps small index domain array constants to their expanded array. */
+  backtrack::unordered_map<Node, Node> d_substitutions;
+  /** Substitutions for eliminated array constants used for model queries. */
+  backtrack::unordered_map<Node, Node> d_model_substitutions;
+  /** Maps Ackermannized array constants to pairs of index and element. */
+  backtrack::unordered_map<Node, std::vector<std::pair<Node, Node>>>
+      d_ackermannized;
+  /**
+   * Ackermannized array constants that reappeared in later assertions and
+   * were linked back to their element constants.
+   */
+  backtrack::unordered_set<Node> d_linked;
+
+  struct Statistics
+  {
+    Statistics(util::Statistics& stats);
+    util::CounterStatistic& num_expanded;
+    util::CounterStatistic& num_ackermannized;
+    util::CounterStatistic& num_lemmas;
+    util::CounterStatistic& num_linked;
+  } d_stats;
+};
+
+}  // namespace bzla::preprocess::pass
+#endif
@@ -222,7 +222,9 @@ PassElimExtract::compute_non_overlapping(
 }
 
 PassElimExtract::Statistics::Statistics(util::Statistics& stats)
-    : num_elim(stats.new_stat<uint64_t>("preprocess::elim_extract::num_elim"))
+    : num_elim(
+          stats.new_stat<util::CounterStatistic>(
+              "preprocess::elim_extract::num_elim"))
 {
 }
 
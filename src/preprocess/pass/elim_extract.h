@@ -47,7 +47,7 @@ class PassElimExtract : public PreprocessingPass
   struct Statistics
   {
     Statistics(util::Statistics& stats);
-    uint64_t& num_elim;
+    util::CounterStatistic& num_elim;
   } d_stats;
 };
 
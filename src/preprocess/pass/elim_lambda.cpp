@@ -153,7 +153,9 @@ PassElimLambda::reduce(const Node& node) const
 }
 
 PassElimLambda::Statistics::Statistics(util::Statistics& stats)
-    : num_elim(stats.new_stat<uint64_t>("preprocess::lambda::num_elim"))
+    : num_elim(
+          stats.new_stat<util::CounterStatistic>(
+              "preprocess::lambda::num_elim"))
 {
 }
 
@@ -38,7 +38,7 @@ class PassElimLambda : public PreprocessingPass
   struct Statistics
   {
     Statistics(util::Statistics& stats);
-    uint64_t& num_elim;
+    util::CounterStatistic& num_elim;
   } d_stats;
 };
 
@@ -203,7 +203,8 @@ PassElimUninterpreted::process(const Node& node)
 
 PassElimUninterpreted::Statistics::Statistics(util::Statistics& stats)
     : num_substs(
-        stats.new_stat<uint64_t>("preprocess::uninterpreted::num_substs"))
+        stats.new_stat<util::CounterStatistic>(
+            "preprocess::uninterpreted::num_substs"))
 {
 }
 
@@ -37,7 +37,7 @@ class PassElimUninterpreted : public PreprocessingPass
   struct Statistics
   {
     Statistics(util::Statistics& stats);
-    uint64_t& num_substs;
+    util::CounterStatistic& num_substs;
   } d_stats;
 };
 
@@ -37,7 +37,7 @@ class PassEmbeddedConstraints : public PreprocessingPass
   struct Statistics
   {
     Statistics(util::Statistics& stats, const std::string& prefix);
-    uint64_t& num_substs;
+    util::CounterStatistic& num_substs;
   } d_stats;
 };
 
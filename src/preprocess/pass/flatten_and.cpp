@@ -68,8 +68,10 @@ PassFlattenAnd::apply(AssertionVector& assertions)
 
 PassFlattenAnd::Statistics::Statistics(util::Statistics& stats,
                                        const std::string& prefix)
-    : num_flattened(stats.new_stat<uint64_t>(prefix + "num_flattened")),
-      num_assertions(stats.new_stat<uint64_t>(prefix + "num_assertions"))
+    : num_flattened(
+          stats.new_stat<util::CounterStatistic>(prefix + "num_flattened")),
+      num_assertions(
+          stats.new_stat<util::CounterStatistic>(prefix + "num_assertions"))
 {
 }
 
@@ -30,8 +30,8 @@ class PassFlattenAnd : public PreprocessingPass
   struct Statistics
   {
     Statistics(util::Statistics& stats, const std::string& prefix);
-    uint64_t& num_flattened;
-    uint64_t& num_assertions;
+    util::CounterStatistic& num_flattened;
+    util::CounterStatistic& num_assertions;
   } d_stats;
 };
 
@@ -0,0 +1,764 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "preprocess/pass/known_bits.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+#include "bv/bitvector.h"
+#include "bv/bounds/bitvector_bounds.h"
+#include "env.h"
+#include "node/kind_info.h"
+#include "node/node_manager.h"
+#include "node/node_ref_vector.h"
+#include "node/node_utils.h"
+#include "node/unordered_node_ref_map.h"
+
+namespace bzla::preprocess::pass {
+
+using namespace bzla::node;
+
+namespace {
+
+/** @return True if given node is a binder, which are not traversed. */
+bool
+is_binder(const Node& node)
+{
+  return node.kind() == Kind::LAMBDA || KindInfo::is_quant(node.kind());
+}
+
+/**
+ * Get the range of values of given domain.
+ * @param d         The domain.
+ * @param is_signed True to flip the msb, i.e., to map the signed to the
+ *                  unsigned order.
+ * @return The range.
+ */
+BitVectorRange
+mk_range(const BitVectorDomain& d, bool is_signed)
+{
+  BitVectorRange res(d);
+  uint64_t msb = d.size() - 1;
+  if (is_signed && d.is_fixed_bit(msb))
+  {
+    res.d_min.flip_bit(msb);
+    res.d_max.flip_bit(msb);
+  }
+  return res;
+}
+
+}  // namespace
+
+/* --- PassKnownBits public ------------------------------------------------- */
+
+PassKnownBits::PassKnownBits(Env& env,
+                             backtrack::BacktrackManager* backtrack_mgr)
+    : PreprocessingPass(env, backtrack_mgr, "kb", "known_bits"),
+      d_stats(env.statistics(), "preprocess::" + name() + "::")
+{
+}
+
+void
+PassKnownBits::apply(AssertionVector& assertions)
+{
+  util::Timer timer(d_stats_pass.time_apply);
+
+  // Disabled if unsat cores enabled.
+  if (d_env.options().produce_unsat_cores())
+  {
+    return;
+  }
+
+  Log(1) << "Apply known bits preprocessing pass";
+
+  NodeManager& nm = d_env.nm();
+  Node null;
+
+  // Make known bits of constants implied by the assertions explicit.
+  if (!compute(assertions, true))
+  {
+    Log(1) << "Known bits are conflicting";
+    assertions.push_back(nm.mk_value(false), null);
+    d_domains.clear();
+    d_parents.clear();
+    return;
+  }
+
+  std::vector<Node> consts;
+  for (const auto& [node, domain] : d_domains)
+  {
+    if (node.kind() == Kind::CONSTANT && domain.has_fixed_bits()
+        && !processed(node))
+    {
+      consts.push_back(node);
+    }
+  }
+  // Sort to create fresh constants in a deterministic order.
+  std::sort(consts.begin(), consts.end(), [](const Node& a, const Node& b) {
+    return a.id() < b.id();
+  });
+  for (const Node& c : consts)
+  {
+    const BitVectorDomain& d = d_domains.at(c);
+    for (uint64_t i = 0, size = d.size(); i < size; ++i)
+    {
+      d_stats.num_fixed_bits += d.is_fixed_bit(i);
+    }
+    d_stats.num_substs += 1;
+    assertions.push_back(nm.mk_node(Kind::EQUAL, {c, mk_substitution(c, d)}),
+                         null);
+    cache_assertion(c);
+  }
+  Log(1) << "Found " << consts.size() << " constants with known bits";
+
+  // Replace terms that are determined by the known bits of values.
+  [[maybe_unused]] bool res = compute(assertions, false);
+  assert(res);
+  d_cache.clear();
+  for (size_t i = 0, size = assertions.size(); i < size; ++i)
+  {
+    const Node& assertion = assertions[i];
+    Node simplified       = simplify(assertion);
+    if (simplified != assertion)
+    {
+      assertions.replace(i, simplified);
+    }
+  }
+  d_cache.clear();
+  d_domains.clear();
+  d_parents.clear();
+}
+
+/* --- PassKnownBits private ------------------------------------------------ */
+
+bool
+PassKnownBits::compute(const AssertionVector& assertions, bool top_level)
+{
+  d_domains.clear();
+  d_parents.clear();
+  d_changed.clear();
+
+  // Propagate up from values.
+  node_ref_vector visit;
+  unordered_node_ref_map<bool> cache;
+  for (size_t i = 0, size = assertions.size(); i < size; ++i)
+  {
+    visit.push_back(assertions[i]);
+  }
+  while (!visit.empty())
+  {
+    const Node& cur     = visit.back();
+    auto [it, inserted] = cache.emplace(cur, true);
+    if (inserted)
+    {
+      if (!is_binder(cur))
+      {
+        visit.insert(visit.end(), cur.begin(), cur.end());
+      }
+      continue;
+    }
+    else if (it->second)
+    {
+      it->second = false;
+      if (!is_binder(cur))
+      {
+        if (top_level)
+        {
+          for (const Node& child : cur)
+          {
+            d_parents[child].push_back(cur);
+          }
+        }
+        bool res = propagate(cur, false);
+        assert(res);
+        (void) res;
+      }
+    }
+    visit.pop_back();
+  }
+  d_changed.clear();
+
+  if (!top_level)
+  {
+    return true;
+  }
+
+  // Propagate down from the assertions and up again until fixed-point.
+  std::vector<Node> queue;
+  std::unordered_set<Node> queued;
+  for (size_t i = 0, size = assertions.size(); i < size; ++i)
+  {
+    const Node& assertion = assertions[i];
+    if (!fix(assertion, 0, true))
+    {
+      return false;
+    }
+    if (queued.insert(assertion).second)
+    {
+      queue.push_back(assertion);
+    }
+  }
+  d_changed.clear();
+
+  while (!queue.empty())
+  {
+    Node cur = queue.back();
+    queue.pop_back();
+    queued.erase(cur);
+    if (!propagate(cur, true))
+    {
+      return false;
+    }
+    // Revisit updated terms and their parents.
+    for (const Node& node : d_changed)
+    {
+      if (queued.insert(node).second)
+      {
+        queue.push_back(node);
+      }
+      auto it = d_parents.find(node);
+      if (it != d_parents.end())
+      {
+        for (const Node& parent : it->second)
+        {
+          if (queued.insert(parent).second)
+          {
+            queue.push_back(parent);
+          }
+        }
+      }
+    }
+    d_changed.clear();
+  }
+  return true;
+}
+
+bool
+PassKnownBits::propagate(const Node& node, bool top_level)
+{
+  const Type& type = node.type();
+  if (!type.is_bv() && !type.is_bool())
+  {
+    return true;
+  }
+
+  bool res = true;
+
+  auto fix_bit = [&](const Node& n, uint64_t idx, bool value) {
+    res = fix(n, idx, value) && res;
+  };
+  // Propagate bit 'idx_c' of child 'c' up to bit 'idx' of node, and down if
+  // 'top_level' is true.
+  auto link = [&](const Node& c, uint64_t idx, uint64_t idx_c, bool negated) {
+    const BitVectorDomain& d  = domain(node);
+    const BitVectorDomain& dc = domain(c);
+    if (dc.is_fixed_bit(idx_c))
+    {
+      fix_bit(node, idx, dc.is_fixed_bit_true(idx_c) != negated);
+    }
+    else if (top_level && d.is_fixed_bit(idx))
+    {
+      fix_bit(c, idx_c, d.is_fixed_bit_true(idx) != negated);
+    }
+  };
+  // Fix the common prefix of the min and max value of range 'r' of term 'n'.
+  auto fix_prefix = [&](const Node& n,
+                        const BitVectorRange& r,
+                        bool is_signed) {
+    if (r.d_min.compare(r.d_max) > 0)
+    {
+      res = false;
+      return;
+    }
+    uint64_t msb = r.size() - 1;
+    for (uint64_t i = msb + 1; i > 0; --i)
+    {
+      bool bit = r.d_min.bit(i - 1);
+      if (bit != r.d_max.bit(i - 1))
+      {
+        break;
+      }
+      fix_bit(n, i - 1, is_signed && i - 1 == msb ? !bit : bit);
+    }
+  };
+
+  const BitVectorDomain& d = domain(node);
+  uint64_t size            = d.size();
+
+  switch (node.kind())
+  {
+    case Kind::NOT:
+    case Kind::BV_NOT:
+      for (uint64_t i = 0; i < size; ++i)
+      {
+        link(node[0], i, i, true);
+      }
+      break;
+
+    case Kind::AND:
+    case Kind::BV_AND:
+      for (uint64_t i = 0; i < size; ++i)
+      {
+        bool any_false       = false;
+        size_t num_not_true  = 0;
+        const Node* not_true = nullptr;
+        for (const Node& child : node)
+        {
+          const BitVectorDomain& dc = domain(child);
+          if (dc.is_fixed_bit_false(i))
+          {
+            any_false = true;
+          }
+          if (!dc.is_fixed_bit_true(i))
+          {
+            num_not_true += 1;
+            not_true = &child;
+          }
+        }
+        if (any_false)
+        {
+          fix_bit(node, i, false);
+        }
+        else if (num_not_true == 0)
+        {
+          fix_bit(node, i, true);
+        }
+        if (top_level && d.is_fixed_bit_true(i))
+        {
+          for (const Node& child : node)
+          {
+            fix_bit(child, i, true);
+          }
+        }
+        else if (top_level && d.is_fixed_bit_false(i) && num_not_true == 1)
+        {
+          fix_bit(*not_true, i, false);
+        }
+      }
+      break;
+
+    case Kind::BV_XOR: {
+      if (node.num_children() != 2)
+      {
+        break;
+      }
+      const BitVectorDomain& d0 = domain(node[0]);
+      const BitVectorDomain& d1 = domain(node[1]);
+      for (uint64_t i = 0; i < size; ++i)
+      {
+        if (d0.is_fixed_bit(i) && d1.is_fixed_bit(i))
+        {
+          fix_bit(node, i, d0.is_fixed_bit_true(i) != d1.is_fixed_bit_true(i));
+        }
+        else if (top_level && d.is_fixed_bit(i) && d0.is_fixed_bit(i))
+        {
+          fix_bit(
+              node[1], i, d.is_fixed_bit_true(i) != d0.is_fixed_bit_true(i));
+        }
+        else if (top_level && d.is_fixed_bit(i) && d1.is_fixed_bit(i))
+        {
+          fix_bit(
+              node[0], i, d.is_fixed_bit_true(i) != d1.is_fixed_bit_true(i));
+        }
+      }
+    }
+    break;
+
+    case Kind::EQUAL: {
+      const Type& ctype = node[0].type();
+      if (!ctype.is_bv() && !ctype.is_bool())
+      {
+        break;
+      }
+      const BitVectorDomain& d0 = domain(node[0]);
+      const BitVectorDomain& d1 = domain(node[1]);
+      uint64_t csize            = d0.size();
+      bool is_fixed             = true;
+      for (uint64_t i = 0; i < csize; ++i)
+      {
+        if (!d0.is_fixed_bit(i) || !d1.is_fixed_bit(i))
+        {
+          is_fixed = false;
+        }
+        else if (d0.is_fixed_bit_true(i) != d1.is_fixed_bit_true(i))
+        {
+          fix_bit(node, 0, false);
+          is_fixed = false;
+          break;
+        }
+      }
+      if (is_fixed)
+      {
+        fix_bit(node, 0, true);
+      }
+      if (!top_level)
+      {
+        break;
+      }
+      if (d.is_fixed_bit_true(0))
+      {
+        for (uint64_t i = 0; i < csize; ++i)
+        {
+          if (d0.is_fixed_bit(i))
+          {
+            fix_bit(node[1], i, d0.is_fixed_bit_true(i));
+          }
+          else if (d1.is_fixed_bit(i))
+          {
+            fix_bit(node[0], i, d1.is_fixed_bit_true(i));
+          }
+        }
+      }
+      else if (d.is_fixed_bit_false(0) && csize == 1)
+      {
+        if (d0.is_fixed_bit(0))
+        {
+          fix_bit(node[1], 0, !d0.is_fixed_bit_true(0));
+        }
+        else if (d1.is_fixed_bit(0))
+        {
+          fix_bit(node[0], 0, !d1.is_fixed_bit_true(0));
+        }
+      }
+    }
+    break;
+
+    case Kind::ITE: {
+      const BitVectorDomain& d0 = domain(node[0]);
+      if (d0.is_fixed_bit(0))
+      {
+        const Node& branch = d0.is_fixed_bit_true(0) ? node[1] : node[2];
+        for (uint64_t i = 0; i < size; ++i)
+        {
+          link(branch, i, i, false);
+        }
+        break;
+      }
+      const BitVectorDomain& d1 = domain(node[1]);
+      const BitVectorDomain& d2 = domain(node[2]);
+      for (uint64_t i = 0; i < size; ++i)
+      {
+        if (d1.is_fixed_bit(i) && d2.is_fixed_bit(i)
+            && d1.is_fixed_bit_true(i) == d2.is_fixed_bit_true(i))
+        {
+          fix_bit(node, i, d1.is_fixed_bit_true(i));
+        }
+        if (top_level && d.is_fixed_bit(i))
+        {
+          // The condition must select the branch that does not disagree.
+          if (d1.is_fixed_bit(i)
+              && d1.is_fixed_bit_true(i) != d.is_fixed_bit_true(i))
+          {
+            fix_bit(node[0], 0, false);
+          }
+          if (d2.is_fixed_bit(i)
+              && d2.is_fixed_bit_true(i) != d.is_fixed_bit_true(i))
+          {
+            fix_bit(node[0], 0, true);
+          }
+        }
+      }
+    }
+    break;
+
+    case Kind::BV_CONCAT: {
+      uint64_t lo = 0;
+      for (size_t j = node.num_children(); j > 0; --j)
+      {
+        const Node& child = node[j - 1];
+        uint64_t csize    = child.type().bv_size();
+        for (uint64_t i = 0; i < csize; ++i)
+        {
+          link(child, lo + i, i, false);
+        }
+        lo += csize;
+      }
+    }
+    break;
+
+    case Kind::BV_EXTRACT: {
+      uint64_t lo = node.index(1);
+      for (uint64_t i = 0; i < size; ++i)
+      {
+        link(node[0], i, lo + i, false);
+      }
+    }
+    break;
+
+    case Kind::BV_SHL:
+    case Kind::BV_SHR:
+    case Kind::BV_ASHR: {
+      const BitVectorDomain& d1 = domain(node[1]);
+      if (!d1.is_fixed())
+      {
+        break;
+      }
+      // Shift amounts >= size are normalized to size.
+      const BitVector& s = d1.lo();
+      uint64_t shift     = size;
+      if (s.size() <= 64 || s.count_leading_zeros() >= s.size() - 64)
+      {
+        shift = std::min(s.to_uint64(true), size);
+      }
+      for (uint64_t i = 0; i < size; ++i)
+      {
+        if (node.kind() == Kind::BV_SHL)
+        {
+          if (i < shift)
+          {
+            fix_bit(node, i, false);
+          }
+          else
+          {
+            link(node[0], i, i - shift, false);
+          }
+        }
+        else if (i + shift < size)
+        {
+          link(node[0], i, i + shift, false);
+        }
+        else if (node.kind() == Kind::BV_SHR)
+        {
+          fix_bit(node, i, false);
+        }
+        else
+        {
+          link(node[0], i, size - 1, false);
+        }
+      }
+    }
+    break;
+
+    case Kind::BV_ADD: {
+      if (node.num_children() != 2)
+      {
+        break;
+      }
+      const BitVectorDomain& d0 = domain(node[0]);
+      const BitVectorDomain& d1 = domain(node[1]);
+      // Propagate from the lsb as long as the carry is known.
+      bool carry = false;
+      for (uint64_t i = 0; i < size && res; ++i)
+      {
+        if (d0.is_fixed_bit(i) && d1.is_fixed_bit(i))
+        {
+          fix_bit(node,
+                  i,
+                  d0.is_fixed_bit_true(i) ^ d1.is_fixed_bit_true(i) ^ carry);
+        }
+        else if (top_level && d.is_fixed_bit(i) && d0.is_fixed_bit(i))
+        {
+          fix_bit(node[1],
+                  i,
+                  d.is_fixed_bit_true(i) ^ d0.is_fixed_bit_true(i) ^ carry);
+        }
+        else if (top_level && d.is_fixed_bit(i) && d1.is_fixed_bit(i))
+        {
+          fix_bit(node[0],
+                  i,
+                  d.is_fixed_bit_true(i) ^ d1.is_fixed_bit_true(i) ^ carry);
+        }
+        else
+        {
+          break;
+        }
+        bool a = d0.is_fixed_bit_true(i);
+        bool b = d1.is_fixed_bit_true(i);
+        carry  = (a && b) || (carry && (a != b));
+      }
+    }
+    break;
+
+    case Kind::BV_ULT:
+    case Kind::BV_SLT: {
+      bool is_signed    = node.kind() == Kind::BV_SLT;
+      BitVectorRange r0 = mk_range(domain(node[0]), is_signed);
+      BitVectorRange r1 = mk_range(domain(node[1]), is_signed);
+      if (r0.d_max.compare(r1.d_min) < 0)
+      {
+        fix_bit(node, 0, true);
+      }
+      else if (r0.d_min.compare(r1.d_max) >= 0)
+      {
+        fix_bit(node, 0, false);
+      }
+      if (!top_level || !d.is_fixed_bit(0))
+      {
+        break;
+      }
+      if (d.is_fixed_bit_true(0))
+      {
+        // node[0] < node[1]
+        if (r1.d_max.is_zero() || r0.d_min.is_ones())
+        {
+          res = false;
+          break;
+        }
+        BitVector max0 = r1.d_max.bvdec();
+        if (max0.compare(r0.d_max) < 0)
+        {
+          r0.d_max = max0;
+        }
+        BitVector min1 = r0.d_min.bvinc();
+        if (min1.compare(r1.d_min) > 0)
+        {
+          r1.d_min = min1;
+        }
+      }
+      else
+      {
+        // node[0] >= node[1]
+        if (r1.d_min.compare(r0.d_min) > 0)
+        {
+          r0.d_min = r1.d_min;
+        }
+        if (r0.d_max.compare(r1.d_max) < 0)
+        {
+          r1.d_max = r0.d_max;
+        }
+      }
+      fix_prefix(node[0], r0, is_signed);
+      fix_prefix(node[1], r1, is_signed);
+    }
+    break;
+
+    default: break;
+  }
+  return res;
+}
+
+bool
+PassKnownBits::fix(const Node& node, uint64_t idx, bool value)
+{
+  BitVectorDomain& d = domain(node);
+  if (!d.is_fixed_bit(idx))
+  {
+    d.fix_bit(idx, value);
+    d_changed.push_back(node);
+    return true;
+  }
+  return d.is_fixed_bit_true(idx) == value;
+}
+
+BitVectorDomain&
+PassKnownBits::domain(const Node& node)
+{
+  auto it = d_domains.find(node);
+  if (it == d_domains.end())
+  {
+    const Type& type = node.type();
+    assert(type.is_bv() || type.is_bool());
+    if (node.is_value())
+    {
+      BitVector value = type.is_bool() ? (node.value<bool>()
+                                              ? BitVector::mk_true()
+                                              : BitVector::mk_false())
+                                       : node.value<BitVector>();
+      it = d_domains.emplace(node, BitVectorDomain(value)).first;
+    }
+    else
+    {
+      uint64_t size = type.is_bool() ? 1 : type.bv_size();
+      it            = d_domains.emplace(node, BitVectorDomain(size)).first;
+    }
+  }
+  return it->second;
+}
+
+Node
+PassKnownBits::mk_substitution(const Node& node, const BitVectorDomain& domain)
+{
+  NodeManager& nm = d_env.nm();
+  if (node.type().is_bool())
+  {
+    assert(domain.is_fixed());
+    return nm.mk_value(domain.is_fixed_bit_true(0));
+  }
+  if (domain.is_fixed())
+  {
+    return nm.mk_value(domain.lo());
+  }
+  // Slices of known and unknown bits, starting from the msb.
+  std::vector<Node> slices;
+  for (uint64_t i = domain.size(); i > 0;)
+  {
+    uint64_t hi = i - 1;
+    uint64_t lo = hi;
+    bool fixed  = domain.is_fixed_bit(hi);
+    while (lo > 0 && domain.is_fixed_bit(lo - 1) == fixed)
+    {
+      lo -= 1;
+    }
+    if (fixed)
+    {
+      slices.push_back(nm.mk_value(domain.lo().bvextract(hi, lo)));
+    }
+    else
+    {
+      slices.push_back(nm.mk_const(nm.mk_bv_type(hi - lo + 1)));
+    }
+    i = lo;
+  }
+  return utils::mk_nary(nm, Kind::BV_CONCAT, slices);
+}
+
+Node
+PassKnownBits::simplify(const Node& assertion)
+{
+  NodeManager& nm = d_env.nm();
+  node_ref_vector visit{assertion};
+  do
+  {
+    const Node& cur     = visit.back();
+    auto [it, inserted] = d_cache.emplace(cur, Node());
+    if (inserted)
+    {
+      if (!is_binder(cur))
+      {
+        visit.insert(visit.end(), cur.begin(), cur.end());
+      }
+      continue;
+    }
+    else if (it->second.is_null())
+    {
+      auto itd = d_domains.find(cur);
+      if (!cur.is_value() && itd != d_domains.end() && itd->second.is_fixed())
+      {
+        const BitVectorDomain& d = itd->second;
+        it->second = cur.type().is_bool() ? nm.mk_value(d.is_fixed_bit_true(0))
+                                          : nm.mk_value(d.lo());
+        d_stats.num_simplified += 1;
+      }
+      else if (cur.num_children() == 0 || is_binder(cur))
+      {
+        it->second = cur;
+      }
+      else
+      {
+        it->second = utils::rebuild_node(nm, cur, d_cache);
+      }
+    }
+    visit.pop_back();
+  } while (!visit.empty());
+  return d_env.rewriter().rewrite(d_cache.at(assertion));
+}
+
+PassKnownBits::Statistics::Statistics(util::Statistics& stats,
+                                      const std::string& prefix)
+    : num_fixed_bits(
+          stats.new_stat<util::CounterStatistic>(prefix + "num_fixed_bits")),
+      num_substs(stats.new_stat<util::CounterStatistic>(prefix + "num_substs")),
+      num_simplified(
+          stats.new_stat<util::CounterStatistic>(prefix + "num_simplified"))
+{
+}
+
+}  // namespace bzla::preprocess::pass
@@ -0,0 +1,111 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_PREPROCESS_PASS_KNOWN_BITS_H_INCLUDED
+#define BZLA_PREPROCESS_PASS_KNOWN_BITS_H_INCLUDED
+
+#include <unordered_map>
+#include <vector>
+
+#include "bv/domain/bitvector_domain.h"
+#include "preprocess/preprocessing_pass.h"
+#include "util/statistics.h"
+
+namespace bzla::preprocess::pass {
+
+/**
+ * Preprocessing pass to simplify bit-vector terms based on known bits.
+ *
+ * Known bits (BitVectorDomain) are computed for all Boolean and bit-vector
+ * terms by propagating constant bits up from values and down from the
+ * assertions to a fixed point. Comparisons are additionally decided and
+ * their operands tightened based on the value ranges (BitVectorRange) of the
+ * operands. Known bits of constants are made explicit by adding assertions
+ * `c = t`, where `t` is a concatenation of the known bits and fresh
+ * constants for the unknown bits, which are then eliminated via variable
+ * substitution. This narrows `c` to its unknown bits.
+ *
+ * Terms whose value is fully determined by known bits propagated up from
+ * values only (i.e., independently of the assertions) are replaced by their
+ * value.
+ */
+class PassKnownBits : public PreprocessingPass
+{
+ public:
+  PassKnownBits(Env& env, backtrack::BacktrackManager* backtrack_mgr);
+
+  void apply(AssertionVector& assertions) override;
+
+ private:
+  /**
+   * Compute the known bits of all terms reachable from the assertions.
+   * @param assertions The current set of assertions.
+   * @param top_level  True to propagate known bits down from the assertions,
+   *                   false to only propagate up from values.
+   * @return False if a conflict was detected, i.e., if the assertions are
+   *         unsatisfiable.
+   */
+  bool compute(const AssertionVector& assertions, bool top_level);
+
+  /**
+   * Helper for compute(), derives known bits of given node from the known
+   * bits of its children and, if `top_level` is true, vice versa.
+   * @param node      The node.
+   * @param top_level True to also propagate known bits down to the children.
+   * @return False if a conflict was detected.
+   */
+  bool propagate(const Node& node, bool top_level);
+
+  /**
+   * Fix bit of the domain of given term at index `idx` to `value`. Records
+   * the term in `d_changed` if the bit was not fixed yet.
+   * @return False if the bit is already fixed to the opposite value.
+   */
+  bool fix(const Node& node, uint64_t idx, bool value);
+
+  /**
+   * Get the current domain of given Boolean or bit-vector term. Boolean terms
+   * are represented as domains of size one.
+   */
+  BitVectorDomain& domain(const Node& node);
+
+  /**
+   * Create the substitution for given constant with given known bits, a
+   * concatenation of values and fresh constants.
+   */
+  Node mk_substitution(const Node& node, const BitVectorDomain& domain);
+
+  /**
+   * Replace all terms in given assertion whose value is fully determined by
+   * the current known bits with their value.
+   */
+  Node simplify(const Node& assertion);
+
+  /** Maps terms to their known bits. */
+  std::unordered_map<Node, BitVectorDomain> d_domains;
+  /** Maps terms to their parents, only used for top-level propagation. */
+  std::unordered_map<Node, std::vector<Node>> d_parents;
+  /** The terms whose domain changed in the last call to propagate(). */
+  std::vector<Node> d_changed;
+  /** Cache for simplify(). */
+  std::unordered_map<Node, Node> d_cache;
+
+  struct Statistics
+  {
+    Statistics(util::Statistics& stats, const std::string& prefix);
+    util::CounterStatistic& num_fixed_bits;
+    util::CounterStatistic& num_substs;
+    util::CounterStatistic& num_simplified;
+  } d_stats;
+};
+
+}  // namespace bzla::preprocess::pass
+
+#endif
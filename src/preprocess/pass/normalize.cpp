@@ -1206,7 +1206,7 @@ PassNormalize::process(const Node& node)
 PassNormalize::Statistics::Statistics(util::Statistics& stats,
                                       const std::string& prefix)
     : num_normalizations(
-        stats.new_stat<uint64_t>(prefix + "num_normalizations"))
+        stats.new_stat<util::CounterStatistic>(prefix + "num_normalizations"))
 {
 }
 
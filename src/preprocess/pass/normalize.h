@@ -232,7 +232,7 @@ class PassNormalize : public PreprocessingPass
   struct Statistics
   {
     Statistics(util::Statistics& stats, const std::string& prefix);
-    uint64_t& num_normalizations;
+    util::CounterStatistic& num_normalizations;
   } d_stats;
 };
 
@@ -275,10 +275,13 @@ PassSkeletonPreproc::Statistics::Statistics(util::Statistics& stats,
     : time_sat(stats.new_stat<util::TimerStatistic>(prefix + "time_sat")),
       time_fixed(stats.new_stat<util::TimerStatistic>(prefix + "time_fixed")),
       time_encode(stats.new_stat<util::TimerStatistic>(prefix + "time_encode")),
-      num_new_assertions(stats.new_stat<uint64_t>(prefix + "new_assertions")),
-      num_resets(stats.new_stat<uint64_t>(prefix + "resets")),
-      num_cnf_lits(stats.new_stat<uint64_t>(prefix + "cnf::lits")),
-      num_cnf_clauses(stats.new_stat<uint64_t>(prefix + "cnf::clauses"))
+      num_new_assertions(
+          stats.new_stat<util::CounterStatistic>(prefix + "new_assertions")),
+      num_resets(stats.new_stat<util::CounterStatistic>(prefix + "resets")),
+      num_cnf_lits(
+          stats.new_stat<util::CounterStatistic>(prefix + "cnf::lits")),
+      num_cnf_clauses(
+          stats.new_stat<util::CounterStatistic>(prefix + "cnf::clauses"))
 {
 }
 
@@ -69,10 +69,10 @@ class PassSkeletonPreproc : public PreprocessingPass
     util::TimerStatistic& time_sat;
     util::TimerStatistic& time_fixed;
     util::TimerStatistic& time_encode;
-    uint64_t& num_new_assertions;
-    uint64_t& num_resets;
-    uint64_t& num_cnf_lits;
-    uint64_t& num_cnf_clauses;
+    util::CounterStatistic& num_new_assertions;
+    util::CounterStatistic& num_resets;
+    util::CounterStatistic& num_cnf_lits;
+    util::CounterStatistic& num_cnf_clauses;
   } d_stats;
 };
 
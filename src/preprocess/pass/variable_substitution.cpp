@@ -986,17 +986,22 @@ PassVariableSubstitution::Statistics::Statistics(util::Statistics& stats,
           stats.new_stat<util::TimerStatistic>(prefix + "time_find_vars")),
       time_find_substitution(stats.new_stat<util::TimerStatistic>(
           prefix + "time_find_substitution")),
-      num_substs(stats.new_stat<uint64_t>(prefix + "num_substs")),
+      num_substs(stats.new_stat<util::CounterStatistic>(prefix + "num_substs")),
       num_norm_eq_linear_eq(
-          stats.new_stat<uint64_t>(prefix + "normalize_eq::num_linear_eq")),
+          stats.new_stat<util::CounterStatistic>(
+              prefix + "normalize_eq::num_linear_eq")),
       num_norm_eq_gauss_elim(
-          stats.new_stat<uint64_t>(prefix + "normalize_eq::num_gauss_elim")),
+          stats.new_stat<util::CounterStatistic>(
+              prefix + "normalize_eq::num_gauss_elim")),
       num_norm_eq_bv_concat(
-          stats.new_stat<uint64_t>(prefix + "normalize_eq::num_bv_concat")),
+          stats.new_stat<util::CounterStatistic>(
+              prefix + "normalize_eq::num_bv_concat")),
       num_norm_bv_ult(
-          stats.new_stat<uint64_t>(prefix + "normalize_bv_ineq::num_ult")),
+          stats.new_stat<util::CounterStatistic>(
+              prefix + "normalize_bv_ineq::num_ult")),
       num_norm_bv_slt(
-          stats.new_stat<uint64_t>(prefix + "normalize_bv_ineq::num_slt"))
+          stats.new_stat<util::CounterStatistic>(
+              prefix + "normalize_bv_ineq::num_slt"))
 
 {
 }
@@ -124,12 +124,12 @@ class PassVariableSubstitution : public PreprocessingPass
     util::TimerStatistic& time_substitute;
     util::TimerStatistic& time_find_vars;
     util::TimerStatistic& time_find_substitution;
-    uint64_t& num_substs;
-    uint64_t& num_norm_eq_linear_eq;
-    uint64_t& num_norm_eq_gauss_elim;
-    uint64_t& num_norm_eq_bv_concat;
-    uint64_t& num_norm_bv_ult;
-    uint64_t& num_norm_bv_slt;
+    util::CounterStatistic& num_substs;
+    util::CounterStatistic& num_norm_eq_linear_eq;
+    util::CounterStatistic& num_norm_eq_gauss_elim;
+    util::CounterStatistic& num_norm_eq_bv_concat;
+    util::CounterStatistic& num_norm_bv_ult;
+    util::CounterStatistic& num_norm_bv_slt;
   } d_stats;
 };
 
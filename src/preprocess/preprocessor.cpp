@@ -14,6 +14,7 @@
 #include "solving_context.h"
 #include "util/logger.h"
 #include "util/resources.h"
+#include "util/trace.h"
 
 namespace bzla::preprocess {
 
@@ -56,8 +57,11 @@ Preprocessor::Preprocessor(SolvingContext& context)
       d_pass_skeleton_preproc(d_env, &d_backtrack_mgr),
       d_pass_normalize(d_env, &d_backtrack_mgr),
       d_pass_elim_extract(d_env, &d_backtrack_mgr),
+      d_pass_elim_arrays(d_env, &d_backtrack_mgr),
+      d_pass_known_bits(d_env, &d_backtrack_mgr),
       d_stats(d_env.statistics())
 {
+  d_env.register_memory_release([this]() { clear_cache(); });
 }
 
 Result
@@ -107,18 +111,7 @@ Preprocessor::preprocess()
     print_statistics("**");
   }
 
-  // Clear rewriter and preprocessing pass caches
-  d_env.rewriter().clear_cache();
-  d_pass_rewrite.clear_cache();
-  d_pass_contr_ands.clear_cache();
-  d_pass_elim_lambda.clear_cache();
-  d_pass_elim_uninterpreted.clear_cache();
-  d_pass_embedded_constraints.clear_cache();
-  d_pass_variable_substitution.clear_cache();
-  d_pass_flatten_and.clear_cache();
-  d_pass_skeleton_preproc.clear_cache();
-  d_pass_normalize.clear_cache();
-  d_pass_elim_extract.clear_cache();
+  clear_cache();
 
   if (d_assertions.is_inconsistent())
   {
@@ -134,9 +127,16 @@ Preprocessor::process(const Node& term)
   // TODO: add more passes
   Node processed = d_pass_rewrite.process(term);
   processed      = d_pass_variable_substitution.process(processed);
-  processed      = d_pass_elim_lambda.process(processed);
-  processed      = d_pass_embedded_constraints.process(processed);
-  processed      = d_pass_rewrite.process(processed);
+  if (d_env.options().pp_elim_arrays())
+  {
+    // Model substitutions of eliminated arrays contain fresh constants that
+    // may have been substituted by variable substitution.
+    processed = d_pass_elim_arrays.process(processed);
+    processed = d_pass_variable_substitution.process(processed);
+  }
+  processed = d_pass_elim_lambda.process(processed);
+  processed = d_pass_embedded_constraints.process(processed);
+  processed = d_pass_rewrite.process(processed);
   return processed;
 }
 
@@ -201,6 +201,24 @@ Preprocessor::substitutions() const
   return d_pass_variable_substitution.substitutions();
 }
 
+void
+Preprocessor::clear_cache()
+{
+  d_env.rewriter().clear_cache();
+  d_pass_rewrite.clear_cache();
+  d_pass_contr_ands.clear_cache();
+  d_pass_elim_lambda.clear_cache();
+  d_pass_elim_uninterpreted.clear_cache();
+  d_pass_embedded_constraints.clear_cache();
+  d_pass_variable_substitution.clear_cache();
+  d_pass_flatten_and.clear_cache();
+  d_pass_skeleton_preproc.clear_cache();
+  d_pass_normalize.clear_cache();
+  d_pass_elim_extract.clear_cache();
+  d_pass_elim_arrays.clear_cache();
+  d_pass_known_bits.clear_cache();
+}
+
 /* --- Preprocessor private ------------------------------------------------- */
 
 void
@@ -231,10 +249,14 @@ Preprocessor::apply(AssertionVector& assertions)
   // fixed-point passes
   do
   {
+    TraceScope("preprocessor::iteration");
     // Reset changed flag.
     assertions.reset_modified();
     ++d_stats.num_iterations;
 
+    // Caches are not in use between passes, release them if requested.
+    d_env.check_memory_pressure();
+
     size_t cnt;
     cnt = assertions.num_modified();
     d_pass_rewrite.apply(assertions);
@@ -320,6 +342,20 @@ Preprocessor::apply(AssertionVector& assertions)
       }
     }
 
+    if (options.pp_known_bits())
+    {
+      cnt = assertions.num_modified();
+      d_pass_known_bits.apply(assertions);
+      if (d_logger.is_msg_enabled(1))
+      {
+        print_statistics(d_pass_known_bits, assertions);
+      }
+      if (assertions.is_inconsistent())
+      {
+        break;
+      }
+    }
+
     cnt = assertions.num_modified();
     d_pass_elim_lambda.apply(assertions);
     if (d_logger.is_msg_enabled(1))
@@ -367,6 +403,20 @@ Preprocessor::apply(AssertionVector& assertions)
       }
     }
 
+    if (options.pp_elim_arrays())
+    {
+      cnt = assertions.num_modified();
+      d_pass_elim_arrays.apply(assertions);
+      if (d_logger.is_msg_enabled(1))
+      {
+        print_statistics(d_pass_elim_arrays, assertions);
+      }
+      if (d_assertions.is_inconsistent())
+      {
+        break;
+      }
+    }
+
   } while (assertions.modified() && !assertions.is_inconsistent()
            && !d_env.terminate());
 
@@ -499,7 +549,9 @@ Preprocessor::Statistics::Statistics(util::Statistics& stats)
         stats.new_stat<util::TimerStatistic>("preprocessor::time_preprocess")),
       time_process(
           stats.new_stat<util::TimerStatistic>("preprocessor::time_process")),
-      num_iterations(stats.new_stat<uint64_t>("preprocessor::num_iterations"))
+      num_iterations(
+          stats.new_stat<util::CounterStatistic>(
+              "preprocessor::num_iterations"))
 {
 }
 
@@ -15,11 +15,13 @@
 #include "backtrack/pop_callback.h"
 #include "preprocess/assertion_tracker.h"
 #include "preprocess/pass/contradicting_ands.h"
+#include "preprocess/pass/elim_arrays.h"
 #include "preprocess/pass/elim_extract.h"
 #include "preprocess/pass/elim_lambda.h"
 #include "preprocess/pass/elim_uninterpreted.h"
 #include "preprocess/pass/embedded_constraints.h"
 #include "preprocess/pass/flatten_and.h"
+#include "preprocess/pass/known_bits.h"
 #include "preprocess/pass/normalize.h"
 #include "preprocess/pass/rewrite.h"
 #include "preprocess/pass/skeleton_preproc.h"
@@ -61,6 +63,12 @@ class Preprocessor
   /** Get current map of active substitutions. */
   const std::unordered_map<Node, Node>& substitutions() const;
 
+  /**
+   * Clear rewriter and preprocessing pass caches. Registered with the
+   * environment to be called under memory pressure.
+   */
+  void clear_cache();
+
  private:
   /** Apply all preprocessing passes to assertions until fixed-point. */
   void apply(AssertionVector& assertions);
@@ -103,6 +111,8 @@ class Preprocessor
   pass::PassSkeletonPreproc d_pass_skeleton_preproc;
   pass::PassNormalize d_pass_normalize;
   pass::PassElimExtract d_pass_elim_extract;
+  pass::PassElimArrays d_pass_elim_arrays;
+  pass::PassKnownBits d_pass_known_bits;
 
   /** Counter for how often a statistics line was printed. */
   uint64_t d_num_printed_stats = 0;
@@ -112,7 +122,7 @@ class Preprocessor
     Statistics(util::Statistics& stats);
     util::TimerStatistic& time_preprocess;
     util::TimerStatistic& time_process;
-    uint64_t& num_iterations;
+    util::CounterStatistic& num_iterations;
   } d_stats;
 };
 
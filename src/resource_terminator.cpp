@@ -1,6 +1,6 @@
 #include "resource_terminator.h"
 
-#include <iostream>
+#include <algorithm>
 
 #include "util/resources.h"
 
@@ -8,32 +8,114 @@ namespace bzla {
 
 using namespace std::chrono_literals;
 
+ResourceTerminator::~ResourceTerminator() { stop(); }
+
 bool
 ResourceTerminator::terminate()
 {
-  return (d_time_limit > 0 && std::chrono::system_clock::now() >= d_deadline)
-         || (d_memory_limit > 0
-             && d_memory_limit <= util::current_memory_usage())
+  return d_limit_reached.load(std::memory_order_relaxed)
          || (d_terminator != nullptr && d_terminator->terminate());
 }
 
 void
 ResourceTerminator::set_terminator(Terminator* terminator)
 {
+  stop();
   d_terminator = terminator;
 }
 
 void
 ResourceTerminator::set_time_limit(uint64_t time_limit)
 {
+  stop();
   d_time_limit = time_limit;
-  d_deadline   = std::chrono::system_clock::now() + time_limit * 1ms;
 }
 
 void
 ResourceTerminator::set_memory_limit(uint64_t memory_limit)
 {
+  stop();
   d_memory_limit = memory_limit * 1024 * 1024;
 }
 
+void
+ResourceTerminator::set_check_interval(uint64_t interval)
+{
+  stop();
+  d_interval = std::max<uint64_t>(interval, 1) * 1ms;
+}
+
+void
+ResourceTerminator::set_memory_pressure_callback(
+    std::function<void()> callback)
+{
+  stop();
+  d_memory_pressure_callback = callback;
+}
+
+void
+ResourceTerminator::start()
+{
+  stop();
+  d_limit_reached.store(false, std::memory_order_relaxed);
+  if (d_time_limit == 0 && d_memory_limit == 0)
+  {
+    return;
+  }
+  d_deadline          = Clock::now() + d_time_limit * 1ms;
+  d_soft_memory_limit = d_memory_limit / 100 * s_soft_memory_limit_percent;
+  d_stop              = false;
+  d_watchdog = std::thread(&ResourceTerminator::watchdog, this);
+}
+
+void
+ResourceTerminator::stop()
+{
+  if (d_watchdog.joinable())
+  {
+    {
+      std::lock_guard<std::mutex> lock(d_mutex);
+      d_stop = true;
+    }
+    d_cv.notify_all();
+    d_watchdog.join();
+  }
+}
+
+void
+ResourceTerminator::watchdog()
+{
+  std::unique_lock<std::mutex> lock(d_mutex);
+  while (!d_stop)
+  {
+    auto now = Clock::now();
+    if (d_time_limit > 0 && now >= d_deadline)
+    {
+      d_limit_reached.store(true, std::memory_order_relaxed);
+      break;
+    }
+    if (d_memory_limit > 0)
+    {
+      uint64_t usage = util::current_memory_usage();
+      if (usage >= d_memory_limit)
+      {
+        d_limit_reached.store(true, std::memory_order_relaxed);
+        break;
+      }
+      if (usage >= d_soft_memory_limit && d_memory_pressure_callback)
+      {
+        d_soft_memory_limit = usage + (d_memory_limit - usage) / 2;
+        d_memory_pressure_callback();
+      }
+    }
+    // Do not sleep past the deadline.
+    auto timeout = now + d_interval;
+    if (d_time_limit > 0)
+    {
+      timeout = std::min(timeout, d_deadline);
+    }
+    d_cv.wait_until(lock, timeout, [this]() { return d_stop; });
+  }
+}
+
 }  // namespace bzla
@@ -11,15 +11,31 @@
 #ifndef BZLA_TIMEOUT_TERMINATOR_H_INCLUDED
 #define BZLA_TIMEOUT_TERMINATOR_H_INCLUDED
 
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
 
 #include "terminator.h"
 
 namespace bzla {
 
 /**
- * Timeout terminator class to enforce --time-limit-per option.
+ * Timeout terminator class to enforce --time-limit-per and --memory-limit
+ * options.
+ *
+ * Resource limits are checked asynchronously by a watchdog thread at a
+ * configurable interval, which raises a flag when a limit is reached. This
+ * keeps terminate(), which is polled very frequently by the SAT solvers,
+ * cheap.
+ *
+ * When memory usage exceeds the soft memory limit (a fraction of the memory
+ * limit), the configured memory pressure callback is called to request that
+ * reclaimable memory is released. Termination is only requested when the
+ * (hard) memory limit is reached.
  *
  * If a non-timeout terminator was already configured, the existing terminator
  * is wrapped and not overwritten, i.e., both terminators are active.
@@ -27,18 +43,58 @@ namespace bzla {
 class ResourceTerminator : public Terminator
 {
  public:
-  ~ResourceTerminator() override{};
+  ~ResourceTerminator() override;
   bool terminate() override;
 
   void set_terminator(Terminator* terminator);
   void set_time_limit(uint64_t time_limit);
   void set_memory_limit(uint64_t memory_limit);
+  /** Set the interval in milliseconds at which limits are checked. */
+  void set_check_interval(uint64_t interval);
+  /**
+   * Set the function to call when the soft memory limit is exceeded.
+   * @note The callback is called from the watchdog thread.
+   */
+  void set_memory_pressure_callback(std::function<void()> callback);
+
+  /**
+   * Start the watchdog thread. The time limit is relative to the time this
+   * function is called. Does nothing if no limit is configured.
+   */
+  void start();
+  /** Stop the watchdog thread if it is running. */
+  void stop();
 
  private:
-  std::chrono::system_clock::time_point d_deadline;
+  using Clock = std::chrono::steady_clock;
+
+  /** The soft memory limit in percent of the memory limit. */
+  static constexpr uint64_t s_soft_memory_limit_percent = 90;
+
+  /** The main loop of the watchdog thread. */
+  void watchdog();
+
+  Clock::time_point d_deadline;
   uint64_t d_time_limit    = 0;
   uint64_t d_memory_limit  = 0;
   Terminator* d_terminator = nullptr;  // Wraps already configured terminator.
+  /**
+   * The current soft memory limit. Raised halfway towards the memory limit
+   * each time it is exceeded, to avoid repeatedly releasing memory.
+   */
+  uint64_t d_soft_memory_limit = 0;
+  /** Called when the soft memory limit is exceeded. */
+  std::function<void()> d_memory_pressure_callback;
+
+  /** The interval at which the watchdog checks the resource limits. */
+  std::chrono::milliseconds d_interval{10};
+  /** True if a resource limit was reached, set by the watchdog. */
+  std::atomic<bool> d_limit_reached{false};
+  /** True if the watchdog thread was requested to stop. */
+  bool d_stop = false;
+  std::thread d_watchdog;
+  std::mutex d_mutex;
+  std::condition_variable d_cv;
 };
 
 }  // namespace bzla
@@ -21,6 +21,7 @@
 #include "rewrite/rewrites_bv.h"
 #include "rewrite/rewrites_fp.h"
 #include "util/logger.h"
+#include "util/trace.h"
 
 #define BZLA_APPLY_RW_RULE(rw_rule)                                \
   do                                                               \
@@ -92,12 +93,12 @@ diff(uint64_t max_id, const Node& rewritten)
 
 /* === Rewriter public ====================================================== */
 
-Rewriter::Rewriter(Env& env, uint8_t level)
+Rewriter::Rewriter(Env& env, uint8_t level, const std::string& id)
     : d_env(env),
       d_logger(env.logger()),
       d_level(level),
       d_stats_rewrites(env.statistics().new_stat<util::HistogramStatistic>(
-          "rewriter::rewrite"))
+          "rewriter::" + (id.empty() ? "" : id + "::") + "rewrite"))
 {
   assert(d_level <= option::Options::REWRITE_LEVEL_MAX);
   (void) d_env;  // only used in debug mode
@@ -106,6 +107,7 @@ Rewriter::Rewriter(Env& env, uint8_t level)
 const Node&
 Rewriter::rewrite(const Node& node)
 {
+  TraceScope("rewriter::rewrite");
   node::node_ref_vector visit{node};
   do
   {
@@ -38,8 +38,10 @@ class Rewriter
    * @param level The rewriting level; level 0 disables all rewrites
    *              except for operator elimination, level 1 enables one-level
    *              rewrites, level 2 multi-level rewrites.
+   * @param id    The identifier of this rewriter instance, used as prefix for
+   *              its statistics if multiple rewriters share an environment.
    */
-  Rewriter(Env& env, uint8_t level = 0);
+  Rewriter(Env& env, uint8_t level = 0, const std::string& id = "");
 
   /**
    * Rewrite given node.
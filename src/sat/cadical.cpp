@@ -10,8 +10,25 @@
 
 #include "sat/cadical.h"
 
+#include <algorithm>
+#include <limits>
+
 namespace bzla::sat {
 
+namespace {
+/**
+ * @return The given limit clamped to the range of CaDiCaL limits, -1 if the
+ *         limit is disabled.
+ */
+int32_t
+limit_value(int64_t limit)
+{
+  if (limit < 0) return -1;
+  return static_cast<int32_t>(
+      std::min<int64_t>(limit, std::numeric_limits<int32_t>::max()));
+}
+}  // namespace
+
 /* CadicalTerminator public ------------------------------------------------- */
 
 CadicalTerminator::CadicalTerminator(bzla::Terminator* terminator)
@@ -91,6 +108,53 @@ Cadical::configure_terminator(Terminator* terminator)
   }
 }
 
+void
+Cadical::phase(int32_t lit)
+{
+  d_solver->phase(lit);
+}
+
+void
+Cadical::unphase(int32_t lit)
+{
+  d_solver->unphase(lit);
+}
+
+void
+Cadical::freeze(int32_t lit)
+{
+  d_solver->freeze(lit);
+}
+
+void
+Cadical::melt(int32_t lit)
+{
+  d_solver->melt(lit);
+}
+
+void
+Cadical::set_conflict_limit(int64_t limit)
+{
+  // CaDiCaL limits only apply to the next call to solve().
+  d_solver->limit("conflicts", limit_value(limit));
+}
+
+void
+Cadical::set_decision_limit(int64_t limit)
+{
+  d_solver->limit("decisions", limit_value(limit));
+}
+
+bool
+Cadical::trace_proof(const std::string& filename, ProofFormat format)
+{
+  if (format == ProofFormat::LRAT && !d_solver->set("lrat", 1))
+  {
+    return false;
+  }
+  return d_solver->trace_proof(filename.c_str());
+}
+
 const char *
 Cadical::get_version() const
 {
@@ -42,6 +42,13 @@ class Cadical : public SatSolver
   int32_t fixed(int32_t lit) override;
   Result solve() override;
   void configure_terminator(Terminator* terminator) override;
+  void phase(int32_t lit) override;
+  void unphase(int32_t lit) override;
+  void freeze(int32_t lit) override;
+  void melt(int32_t lit) override;
+  void set_conflict_limit(int64_t limit) override;
+  void set_decision_limit(int64_t limit) override;
+  bool trace_proof(const std::string& filename, ProofFormat format) override;
   const char *get_name() const override { return "CaDiCaL"; }
   const char *get_version() const override;
 
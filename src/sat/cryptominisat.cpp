@@ -14,6 +14,8 @@
 
 #include "sat/cryptominisat.h"
 
+#include <limits>
+
 namespace bzla::sat {
 
 /* --- CryptoMiniSat public ------------------------------------------------- */
@@ -74,6 +76,8 @@ CryptoMiniSat::solve()
   reset();
   CMSat::lbool res = d_solver->solve(&d_assumptions);
   d_assumptions.clear();
+  // Conflict limits only apply to a single call.
+  d_solver->set_max_confl(std::numeric_limits<uint64_t>::max());
   if (res == CMSat::l_True) return Result::SAT;
   if (res == CMSat::l_False) return Result::UNSAT;
   return Result::UNKNOWN;
@@ -85,6 +89,13 @@ CryptoMiniSat::configure_terminator(Terminator *terminator)
   (void) terminator;
 }
 
+void
+CryptoMiniSat::set_conflict_limit(int64_t limit)
+{
+  d_solver->set_max_confl(limit < 0 ? std::numeric_limits<uint64_t>::max()
+                                    : static_cast<uint64_t>(limit));
+}
+
 const char *
 CryptoMiniSat::get_version() const
 {
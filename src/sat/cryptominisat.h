@@ -35,6 +35,7 @@ class CryptoMiniSat : public SatSolver
   int32_t fixed(int32_t lit) override;
   Result solve() override;
   void configure_terminator(Terminator *terminator) override;
+  void set_conflict_limit(int64_t limit) override;
   const char *get_name() const override { return "CryptoMiniSat"; }
   const char *get_version() const override;
 
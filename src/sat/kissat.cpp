@@ -14,7 +14,9 @@
 
 #include "sat/kissat.h"
 
+#include <algorithm>
 #include <cassert>
+#include <limits>
 
 /*------------------------------------------------------------------------*/
 
@@ -29,6 +31,18 @@ kissat_terminate_wrapper(void* state)
   bzla::Terminator* terminator = static_cast<bzla::Terminator*>(state);
   return terminator->terminate();
 }
+
+/**
+ * @return The given limit clamped to the range of Kissat limits, which are
+ *         disabled by setting the maximum value.
+ */
+unsigned
+kissat_limit_value(int64_t limit)
+{
+  constexpr unsigned max = std::numeric_limits<unsigned>::max();
+  if (limit < 0) return max;
+  return static_cast<unsigned>(std::min<int64_t>(limit, max));
+}
 }  // namespace
 
 /*------------------------------------------------------------------------*/
@@ -74,9 +88,9 @@ Kissat::failed(int32_t lit)
 int32_t
 Kissat::fixed(int32_t lit)
 {
+  // Kissat does not provide information about top-level assigned literals.
   (void) lit;
-  assert(false);
-  return false;
+  return 0;
 }
 
 Result
@@ -97,6 +111,18 @@ Kissat::configure_terminator(Terminator* terminator)
   }
 }
 
+void
+Kissat::set_conflict_limit(int64_t limit)
+{
+  kissat_set_conflict_limit(d_solver, kissat_limit_value(limit));
+}
+
+void
+Kissat::set_decision_limit(int64_t limit)
+{
+  kissat_set_decision_limit(d_solver, kissat_limit_value(limit));
+}
+
 const char *
 Kissat::get_version() const
 {
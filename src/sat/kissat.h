@@ -38,6 +38,8 @@ class Kissat : public SatSolver
   int32_t fixed(int32_t lit) override;
   Result solve() override;
   void configure_terminator(Terminator *terminator) override;
+  void set_conflict_limit(int64_t limit) override;
+  void set_decision_limit(int64_t limit) override;
   const char *get_name() const override { return "Kissat"; }
   const char *get_version() const override;
 
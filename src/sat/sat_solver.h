@@ -19,6 +19,13 @@
 
 namespace bzla::sat {
 
+/** Proof formats for proof tracing. */
+enum class ProofFormat
+{
+  DRAT,
+  LRAT,
+};
+
 class SatSolver
 {
  public:
@@ -70,6 +77,55 @@ class SatSolver
 
   // virtual int32_t repr(int32_t) = 0;
 
+  /**
+   * Set the preferred phase of the variable of given literal for subsequent
+   * decisions. This is only a hint and ignored by solvers that do not
+   * support it.
+   * @param lit The literal to prefer, i.e., its variable is decided to true
+   *            if the literal is positive and to false otherwise.
+   */
+  virtual void phase(int32_t lit) { (void) lit; }
+  /**
+   * Reset the preferred phase of the variable of given literal.
+   * @param lit The literal.
+   */
+  virtual void unphase(int32_t lit) { (void) lit; }
+  /**
+   * Freeze the variable of given literal, i.e., prevent that it is
+   * eliminated by inprocessing. Freezing is reference counted and must be
+   * matched by a call to melt().
+   * @param lit The literal.
+   */
+  virtual void freeze(int32_t lit) { (void) lit; }
+  /**
+   * Melt the variable of given (frozen) literal, i.e., allow that it is
+   * eliminated once all freeze() calls have been matched.
+   * @param lit The literal.
+   */
+  virtual void melt(int32_t lit) { (void) lit; }
+  /**
+   * Limit the number of conflicts for the next call to solve().
+   * @param limit The conflict limit, a negative value disables the limit.
+   */
+  virtual void set_conflict_limit(int64_t limit) { (void) limit; }
+  /**
+   * Limit the number of decisions for the next call to solve().
+   * @param limit The decision limit, a negative value disables the limit.
+   */
+  virtual void set_decision_limit(int64_t limit) { (void) limit; }
+  /**
+   * Trace proof to given file. Must be called before any clause is added.
+   * @param filename The name of the proof file.
+   * @param format The proof format.
+   * @return True if proof tracing is supported and was enabled.
+   */
+  virtual bool trace_proof(const std::string &filename, ProofFormat format)
+  {
+    (void) filename;
+    (void) format;
+    return false;
+  }
+
   /**
    * Get the name of this SAT solver.
    * @return The name of this SAT solver.
@@ -873,11 +873,13 @@ ArraySolver::KeyEqualPair::operator()(const std::pair<Node, Node>& p1,
 
 ArraySolver::Statistics::Statistics(util::Statistics& stats,
                                     const std::string& prefix)
-    : num_checks(stats.new_stat<uint64_t>(prefix + "num_checks")),
-      num_propagations(stats.new_stat<uint64_t>(prefix + "propagations")),
-      num_propagations_up(stats.new_stat<uint64_t>(prefix + "propagations_up")),
+    : num_checks(stats.new_stat<util::CounterStatistic>(prefix + "num_checks")),
+      num_propagations(
+          stats.new_stat<util::CounterStatistic>(prefix + "propagations")),
+      num_propagations_up(
+          stats.new_stat<util::CounterStatistic>(prefix + "propagations_up")),
       num_propagations_down(
-          stats.new_stat<uint64_t>(prefix + "propagations_down")),
+          stats.new_stat<util::CounterStatistic>(prefix + "propagations_down")),
       num_lemma_size(
           stats.new_stat<util::HistogramStatistic>(prefix + "lemma_size")),
       time_check(stats.new_stat<util::TimerStatistic>(prefix + "time_check"))
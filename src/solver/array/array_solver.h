@@ -237,10 +237,10 @@ class ArraySolver : public Solver
   struct Statistics
   {
     Statistics(util::Statistics& stats, const std::string& prefix);
-    uint64_t& num_checks;
-    uint64_t& num_propagations;
-    uint64_t& num_propagations_up;
-    uint64_t& num_propagations_down;
+    util::CounterStatistic& num_checks;
+    util::CounterStatistic& num_propagations;
+    util::CounterStatistic& num_propagations_up;
+    util::CounterStatistic& num_propagations_down;
     util::HistogramStatistic& num_lemma_size;
     util::TimerStatistic& time_check;
   } d_stats;
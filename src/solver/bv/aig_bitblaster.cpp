@@ -129,8 +129,18 @@ AigBitblaster::bitblast(const Node& t)
           break;
 
         case Kind::BV_MUL:
+        case Kind::BV_UDIV:
+        case Kind::BV_UREM:
           assert(type.is_bv());
-          it->second = d_bitblaster.bv_mul(bits(cur[0]), bits(cur[1]));
+          if (d_abstraction && is_expensive(cur))
+          {
+            it->second = d_bitblaster.bv_constant(type.bv_size());
+            d_abstractions.push_back(cur);
+          }
+          else
+          {
+            it->second = bitblast_mul_div(cur);
+          }
           break;
 
         case Kind::BV_ULT:
@@ -158,16 +168,6 @@ AigBitblaster::bitblast(const Node& t)
           it->second = d_bitblaster.bv_ashr(bits(cur[0]), bits(cur[1]));
           break;
 
-        case Kind::BV_UDIV:
-          assert(type.is_bv());
-          it->second = d_bitblaster.bv_udiv(bits(cur[0]), bits(cur[1]));
-          break;
-
-        case Kind::BV_UREM:
-          assert(type.is_bv());
-          it->second = d_bitblaster.bv_urem(bits(cur[0]), bits(cur[1]));
-          break;
-
         case Kind::BV_CONCAT:
           assert(type.is_bv());
           it->second = d_bitblaster.bv_concat(bits(cur[0]), bits(cur[1]));
@@ -197,6 +197,13 @@ AigBitblaster::bits(const Node& term) const
   return d_bitblaster_cache.at(term);
 }
 
+bitblast::AigNode
+AigBitblaster::refine(const Node& term)
+{
+  assert(is_expensive(term));
+  return d_bitblaster.bv_eq(bits(term), bitblast_mul_div(term))[0];
+}
+
 uint64_t
 AigBitblaster::count_aig_ands(const Node& term, AigNodeRefSet& cache)
 {
@@ -226,4 +233,33 @@ AigBitblaster::count_aig_ands(const Node& term, AigNodeRefSet& cache)
   return res;
 }
 
+bool
+AigBitblaster::is_expensive(const Node& term)
+{
+  switch (term.kind())
+  {
+    case node::Kind::BV_MUL:
+      // Multiplication with a value is cheap.
+      return !term[0].is_value() && !term[1].is_value();
+    case node::Kind::BV_UDIV:
+    case node::Kind::BV_UREM: return true;
+    default: return false;
+  }
+}
+
+bitblast::AigBitblaster::Bits
+AigBitblaster::bitblast_mul_div(const Node& term)
+{
+  const auto& a = bits(term[0]);
+  const auto& b = bits(term[1]);
+  switch (term.kind())
+  {
+    case node::Kind::BV_MUL: return d_bitblaster.bv_mul(a, b);
+    case node::Kind::BV_UDIV: return d_bitblaster.bv_udiv(a, b);
+    default:
+      assert(term.kind() == node::Kind::BV_UREM);
+      return d_bitblaster.bv_urem(a, b);
+  }
+}
+
 }  // namespace bzla::bv
@@ -13,6 +13,7 @@
 
 #include <unordered_set>
 #include <unordered_map>
+#include <vector>
 
 #include "bitblast/aig_bitblaster.h"
 #include "node/node.h"
@@ -26,6 +27,33 @@ class AigBitblaster
       std::unordered_set<std::reference_wrapper<const bitblast::AigNode>,
                          std::hash<bitblast::AigNode>>;
 
+  /** Configure the encoding for bit-vector multiplication. */
+  void set_mul_encoding(bitblast::MulEncoding encoding)
+  {
+    d_bitblaster.set_mul_encoding(encoding);
+  }
+
+  /**
+   * Configure abstraction of expensive operators. If enabled, multiplication
+   * (without value operands), unsigned division and remainder are not
+   * bit-blasted eagerly but abstracted as fresh bits.
+   */
+  void set_abstraction(bool enabled) { d_abstraction = enabled; }
+
+  /** @return The terms that were abstracted as fresh bits. */
+  const std::vector<Node>& abstractions() const { return d_abstractions; }
+
+  /**
+   * Bit-blast the operator of an abstracted term.
+   * @param term The abstracted term.
+   * @return The bit that encodes the equality between the abstraction and
+   *         the bit-blasted operator.
+   */
+  bitblast::AigNode refine(const Node& term);
+
+  /** @return A fresh bit that does not represent any term. */
+  bitblast::AigNode mk_bit() { return d_bitblaster.bv_constant(1)[0]; }
+
   /** Recursively bit-blast `term`. */
   void bitblast(const Node& term);
 
@@ -40,8 +68,22 @@ class AigBitblaster
   uint64_t num_aig_shared() const { return d_bitblaster.num_aig_shared(); }
 
  private:
+  /** Determine if given term is abstracted if abstraction is enabled. */
+  static bool is_expensive(const Node& term);
+
+  /**
+   * Bit-blast multiplication, unsigned division or remainder term over the
+   * bits of its children.
+   */
+  bitblast::AigBitblaster::Bits bitblast_mul_div(const Node& term);
+
   bitblast::AigBitblaster::Bits d_empty;
 
+  /** True if expensive operators are abstracted. */
+  bool d_abstraction = false;
+  /** The abstracted terms. */
+  std::vector<Node> d_abstractions;
+
   /** AIG bit-blaster. */
   bitblast::AigBitblaster d_bitblaster;
   /** Cached to store bit-blasted terms and their encoded bits. */
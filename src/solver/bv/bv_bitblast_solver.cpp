@@ -45,6 +45,8 @@ class BvBitblastSolver::BitblastSatSolver : public bitblast::SatInterface
     return d_solver.value(lit) == 1 ? true : false;
   }
 
+  int32_t fixed(int64_t lit) override { return d_solver.fixed(lit); }
+
  private:
   sat::SatSolver& d_solver;
 };
@@ -55,12 +57,41 @@ BvBitblastSolver::BvBitblastSolver(Env& env, SolverState& state)
     : Solver(env, state),
       d_assertions(state.backtrack_mgr()),
       d_assumptions(state.backtrack_mgr()),
+      d_scoped_assertions(state.backtrack_mgr()),
+      d_scoped_assertions_index(state.backtrack_mgr()),
+      d_activation_lits(state.backtrack_mgr()),
       d_last_result(Result::UNKNOWN),
       d_stats(env.statistics(), "solver::bv::bitblast::")
 {
   d_sat_solver.reset(sat::new_sat_solver(env.options().sat_solver()));
+  // Proof tracing must be enabled before any clause is added.
+  const std::string& proof_file = env.options().sat_proof_file();
+  if (!proof_file.empty())
+  {
+    sat::ProofFormat format =
+        env.options().sat_proof_format() == option::SatProofFormat::LRAT
+            ? sat::ProofFormat::LRAT
+            : sat::ProofFormat::DRAT;
+    bool traced = d_sat_solver->trace_proof(proof_file, format);
+    Warn(!traced) << "proof tracing not supported by "
+                  << d_sat_solver->get_name();
+  }
   d_bitblast_sat_solver.reset(new BitblastSatSolver(*d_sat_solver));
   d_cnf_encoder.reset(new bitblast::AigCnfEncoder(*d_bitblast_sat_solver));
+  d_bitblaster.set_abstraction(env.options().bv_abstraction());
+
+  switch (env.options().bv_mul_encoding())
+  {
+    case option::BvMulEncoding::SHIFT_ADD:
+      d_bitblaster.set_mul_encoding(bitblast::MulEncoding::SHIFT_ADD);
+      break;
+    case option::BvMulEncoding::DADDA:
+      d_bitblaster.set_mul_encoding(bitblast::MulEncoding::DADDA);
+      break;
+    case option::BvMulEncoding::KARATSUBA:
+      d_bitblaster.set_mul_encoding(bitblast::MulEncoding::KARATSUBA);
+      break;
+  }
 }
 
 BvBitblastSolver::~BvBitblastSolver() {}
@@ -82,20 +113,45 @@ BvBitblastSolver::solve()
     d_assertions.clear();
   }
 
-  for (const Node& assumption : d_assumptions)
+  compact();
+  encode_scoped_assertions();
+  encode_abstractions();
+
+  // No registered caches are in use between encoding and solving, release
+  // them if requested before the SAT solver allocates more memory.
+  d_env.check_memory_pressure();
+
+  do
   {
-    const auto& bits = d_bitblaster.bits(assumption);
-    assert(!bits.empty());
-    util::Timer timer(d_stats.time_encode);
-    d_cnf_encoder->encode(bits[0], false);
-    d_sat_solver->assume(bits[0].get_id());
-  }
+    for (size_t idx : d_activation_lits)
+    {
+      d_sat_solver->assume(d_activation_bits[idx].get_id());
+    }
+    for (const Node& assumption : d_assumptions)
+    {
+      const auto& bits = d_bitblaster.bits(assumption);
+      assert(!bits.empty());
+      util::Timer timer(d_stats.time_encode);
+      d_cnf_encoder->encode(bits[0], false);
+      d_sat_solver->assume(bits[0].get_id());
+    }
 
-  // Update CNF statistics
-  update_statistics();
+    // Update CNF statistics
+    update_statistics();
+
+    if (d_conflict_limit)
+    {
+      d_sat_solver->set_conflict_limit(d_conflict_limit);
+    }
+    if (d_env.options().sat_decision_limit())
+    {
+      d_sat_solver->set_decision_limit(d_env.options().sat_decision_limit());
+    }
 
-  util::Timer timer(d_stats.time_sat);
-  d_last_result = d_sat_solver->solve();
+    util::Timer timer(d_stats.time_sat);
+    d_last_result = d_sat_solver->solve();
+  } while (d_last_result == Result::SAT && refine_abstractions());
+  d_conflict_limit = 0;
   return d_last_result;
 }
 
@@ -110,13 +166,17 @@ BvBitblastSolver::register_assertion(const Node& assertion,
     top_level = false;
   }
 
-  if (!top_level)
+  if (top_level)
+  {
+    d_assertions.push_back(assertion);
+  }
+  else if (d_env.options().produce_unsat_cores())
   {
     d_assumptions.push_back(assertion);
   }
   else
   {
-    d_assertions.push_back(assertion);
+    d_scoped_assertions.emplace_back(assertion, activation_literal());
   }
 
   {
@@ -148,13 +208,78 @@ BvBitblastSolver::value(const Node& term)
   {
     return nm.mk_value(d_cnf_encoder->value(bits[0]) == 1);
   }
+  return nm.mk_value(value(bits));
+}
+
+int32_t
+BvBitblastSolver::fixed(const Node& term)
+{
+  assert(term.type().is_bool());
 
-  BitVector val(type.bv_size());
+  const auto& bits = d_bitblaster.bits(term);
+  // Not bit-blasted, nothing known about this term.
+  if (bits.empty())
+  {
+    return 0;
+  }
+  return d_cnf_encoder->fixed(bits[0]);
+}
+
+int32_t
+BvBitblastSolver::fixed(const bitblast::AigNode& bit)
+{
+  return d_cnf_encoder->fixed(bit);
+}
+
+void
+BvBitblastSolver::compact()
+{
+  std::vector<bool> active(d_activation_bits.size(), false);
+  for (size_t idx : d_activation_lits)
+  {
+    active[idx] = true;
+  }
+  for (size_t i = 0, size = d_activation_bits.size(); i < size; ++i)
+  {
+    if (!active[i] && !d_activation_retired[i])
+    {
+      d_sat_solver->add(-d_activation_bits[i].get_id());
+      d_sat_solver->add(0);
+      d_sat_solver->melt(d_activation_bits[i].get_id());
+      d_activation_retired[i] = true;
+      ++d_stats.num_activation_lits_retired;
+    }
+  }
+}
+
+void
+BvBitblastSolver::phase(const Node& term, const BitVector& value)
+{
+  const auto& bits = d_bitblaster.bits(term);
+  assert(bits.empty() || bits.size() == value.size());
   for (size_t i = 0, size = bits.size(); i < size; ++i)
   {
-    val.set_bit(size - 1 - i, d_cnf_encoder->value(bits[i]) == 1);
+    const bitblast::AigNode& bit = bits[i];
+    if (bit.is_true() || bit.is_false())
+    {
+      continue;
+    }
+    int64_t id = bit.get_id();
+    d_sat_solver->phase(value.bit(size - 1 - i) ? id : -id);
+    ++d_stats.num_phases;
+  }
+}
+
+void
+BvBitblastSolver::unphase(const Node& term)
+{
+  for (const bitblast::AigNode& bit : d_bitblaster.bits(term))
+  {
+    if (!bit.is_true() && !bit.is_false())
+    {
+      d_sat_solver->unphase(bit.get_id());
+    }
   }
-  return nm.mk_value(val);
 }
 
 void
@@ -188,6 +313,141 @@ BvBitblastSolver::update_statistics()
   d_stats.num_cnf_literals = cnf_stats.num_literals;
 }
 
+size_t
+BvBitblastSolver::activation_literal()
+{
+  size_t level = d_solver_state.backtrack_mgr()->num_levels();
+  assert(level > 0);
+  while (d_activation_lits.size() < level)
+  {
+    d_activation_lits.push_back(d_activation_bits.size());
+    d_activation_bits.push_back(d_bitblaster.mk_bit());
+    d_activation_retired.push_back(false);
+    // Activation literals are assumed in every call, prevent that they are
+    // eliminated until they are retired.
+    d_sat_solver->freeze(d_activation_bits.back().get_id());
+    ++d_stats.num_activation_lits;
+  }
+  return d_activation_lits[level - 1];
+}
+
+void
+BvBitblastSolver::encode_scoped_assertions()
+{
+  size_t size = d_scoped_assertions.size();
+  if (d_scoped_assertions_index.get() == size)
+  {
+    return;
+  }
+
+  util::Timer timer(d_stats.time_encode);
+  for (size_t i = d_scoped_assertions_index.get(); i < size; ++i)
+  {
+    const auto [assertion, idx] = d_scoped_assertions[i];
+    const auto& bits            = d_bitblaster.bits(assertion);
+    assert(!bits.empty());
+    // Encoding of assertions is retained on pop, re-asserting an assertion
+    // only adds a new guard clause.
+    d_cnf_encoder->encode(bits[0], false);
+    d_sat_solver->add(-d_activation_bits[idx].get_id());
+    d_sat_solver->add(bits[0].get_id());
+    d_sat_solver->add(0);
+  }
+  d_scoped_assertions_index = size;
+}
+
+BitVector
+BvBitblastSolver::value(const bitblast::AigBitblaster::Bits& bits)
+{
+  // Collect the bits limb-wise instead of setting them one by one, bits are
+  // stored from most to least significant bit.
+  size_t size = bits.size();
+  std::vector<uint64_t> limbs((size + 63) / 64, 0);
+  for (size_t i = 0; i < size; ++i)
+  {
+    if (d_cnf_encoder->value(bits[size - 1 - i]) == 1)
+    {
+      limbs[i / 64] |= uint64_t{1} << (i % 64);
+    }
+  }
+  return BitVector::from_limbs(size, limbs);
+}
+
+void
+BvBitblastSolver::encode_abstractions()
+{
+  const auto& abstractions = d_bitblaster.abstractions();
+  if (d_num_encoded_abstractions == abstractions.size())
+  {
+    return;
+  }
+
+  util::Timer timer(d_stats.time_encode);
+  for (size_t i = d_num_encoded_abstractions, size = abstractions.size();
+       i < size;
+       ++i)
+  {
+    const Node& term = abstractions[i];
+    for (const Node& t : {term, term[0], term[1]})
+    {
+      for (const auto& bit : d_bitblaster.bits(t))
+      {
+        d_cnf_encoder->encode(bit, false);
+      }
+    }
+    d_abstractions.push_back(term);
+    ++d_stats.num_abstractions;
+  }
+  d_num_encoded_abstractions = abstractions.size();
+}
+
+bool
+BvBitblastSolver::refine_abstractions()
+{
+  bool refined = false;
+  for (size_t i = 0; i < d_abstractions.size();)
+  {
+    const Node& term = d_abstractions[i];
+    BitVector a      = value(d_bitblaster.bits(term[0]));
+    BitVector b      = value(d_bitblaster.bits(term[1]));
+    BitVector val;
+    switch (term.kind())
+    {
+      case Kind::BV_MUL: val = a.bvmul(b); break;
+      case Kind::BV_UDIV: val = a.bvudiv(b); break;
+      default:
+        assert(term.kind() == Kind::BV_UREM);
+        val = a.bvurem(b);
+    }
+    if (val == value(d_bitblaster.bits(term)))
+    {
+      ++i;
+      continue;
+    }
+
+    Log(2) << "refine abstraction: " << term;
+    bitblast::AigNode eq;
+    {
+      util::Timer timer(d_stats.time_bitblast);
+      eq = d_bitblaster.refine(term);
+    }
+    {
+      util::Timer timer(d_stats.time_encode);
+      d_cnf_encoder->encode(eq, true);
+    }
+    ++d_stats.num_refinements;
+    refined = true;
+
+    d_abstractions[i] = d_abstractions.back();
+    d_abstractions.pop_back();
+  }
+  if (refined)
+  {
+    update_statistics();
+  }
+  return refined;
+}
+
 BvBitblastSolver::Statistics::Statistics(util::Statistics& stats,
                                          const std::string& prefix)
     : time_sat(
@@ -196,12 +456,29 @@ BvBitblastSolver::Statistics::Statistics(util::Statistics& stats,
           stats.new_stat<util::TimerStatistic>(prefix + "aig::time_bitblast")),
       time_encode(
           stats.new_stat<util::TimerStatistic>(prefix + "cnf::time_encode")),
-      num_aig_ands(stats.new_stat<uint64_t>(prefix + "aig::num_ands")),
-      num_aig_consts(stats.new_stat<uint64_t>(prefix + "aig::num_consts")),
-      num_aig_shared(stats.new_stat<uint64_t>(prefix + "aig::num_shared")),
-      num_cnf_vars(stats.new_stat<uint64_t>(prefix + "cnf::num_vars")),
-      num_cnf_clauses(stats.new_stat<uint64_t>(prefix + "cnf::num_clauses")),
-      num_cnf_literals(stats.new_stat<uint64_t>(prefix + "cnf::num_literals"))
+      num_aig_ands(
+          stats.new_stat<util::CounterStatistic>(prefix + "aig::num_ands")),
+      num_aig_consts(
+          stats.new_stat<util::CounterStatistic>(prefix + "aig::num_consts")),
+      num_aig_shared(
+          stats.new_stat<util::CounterStatistic>(prefix + "aig::num_shared")),
+      num_cnf_vars(
+          stats.new_stat<util::CounterStatistic>(prefix + "cnf::num_vars")),
+      num_cnf_clauses(
+          stats.new_stat<util::CounterStatistic>(prefix + "cnf::num_clauses")),
+      num_cnf_literals(
+          stats.new_stat<util::CounterStatistic>(prefix + "cnf::num_literals")),
+      num_activation_lits(
+          stats.new_stat<util::CounterStatistic>(
+              prefix + "cnf::num_activation_lits")),
+      num_activation_lits_retired(stats.new_stat<util::CounterStatistic>(
+          prefix + "cnf::num_activation_lits_retired")),
+      num_abstractions(
+          stats.new_stat<util::CounterStatistic>(prefix + "num_abstractions")),
+      num_refinements(
+          stats.new_stat<util::CounterStatistic>(prefix + "num_refinements")),
+      num_phases(
+          stats.new_stat<util::CounterStatistic>(prefix + "sat::num_phases"))
 {
 }
 
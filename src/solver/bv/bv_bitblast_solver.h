@@ -14,6 +14,7 @@
 #include <unordered_map>
 
 #include "backtrack/assertion_stack.h"
+#include "backtrack/object.h"
 #include "backtrack/vector.h"
 #include "bitblast/aig/aig_cnf.h"
 #include "sat/sat_solver.h"
@@ -41,6 +42,57 @@ class BvBitblastSolver : public Solver, public BvSolverInterface
   /** Query value of leaf node. */
   Node value(const Node& term) override;
 
+  /**
+   * Determine if given Boolean term is fixed at the top level of the SAT
+   * solver, i.e., if it is implied by the permanently asserted clauses.
+   * @param term The term to query.
+   * @return 1 if it is implied, -1 if its negation is implied and 0 if
+   *         unknown (or the term was not bit-blasted or encoded yet).
+   */
+  int32_t fixed(const Node& term);
+
+  /**
+   * Determine if given bit is fixed at the top level of the SAT solver.
+   * @param bit The bit to query.
+   * @return 1 if it is implied, -1 if its negation is implied and 0 if
+   *         unknown (or the bit was not encoded yet).
+   */
+  int32_t fixed(const bitblast::AigNode& bit);
+
+  /**
+   * Permanently deactivate the activation literals of popped scope levels.
+   *
+   * Assertions registered in non-zero scope levels are guarded by the
+   * activation literal of their level. After a pop, their CNF encoding is
+   * retained such that re-asserting them only requires to add a new guard
+   * clause. Compaction asserts the negation of the activation literals of
+   * popped levels, which allows the SAT solver to garbage collect the guard
+   * clauses.
+   */
+  void compact();
+
+  /**
+   * Set the preferred phases of the SAT variables of the bits of given
+   * bit-blasted term to given value.
+   * @param term The term.
+   * @param value The preferred value of the term.
+   */
+  void phase(const Node& term, const BitVector& value);
+
+  /**
+   * Reset the preferred phases of the SAT variables of the bits of given
+   * bit-blasted term.
+   * @param term The term.
+   */
+  void unphase(const Node& term);
+
+  /**
+   * Limit the number of conflicts of each SAT solver call of the next
+   * solve() call.
+   * @param limit The conflict limit, 0 for no limit.
+   */
+  void set_conflict_limit(uint64_t limit) { d_conflict_limit = limit; }
+
   /** Get unsat core of last solve() call. */
   void unsat_core(std::vector<Node>& core) const override;
 
@@ -54,6 +106,32 @@ class BvBitblastSolver : public Solver, public BvSolverInterface
   /** Update AIG and CNF statistics. */
   void update_statistics();
 
+  /**
+   * Get the activation literal of the current scope level, created on
+   * demand.
+   * @return The index of the activation literal in d_activation_bits.
+   */
+  size_t activation_literal();
+
+  /** Encode new scoped assertions guarded by their activation literal. */
+  void encode_scoped_assertions();
+
+  /** @return The value of given bits in the current SAT model. */
+  BitVector value(const bitblast::AigBitblaster::Bits& bits);
+
+  /**
+   * Encode the bits of new abstractions and their operands to CNF such that
+   * their values are consistent with the values of the leaves.
+   */
+  void encode_abstractions();
+
+  /**
+   * Check the abstracted operators against their concrete semantics under
+   * the current SAT model and refine inconsistent abstractions.
+   * @return True if at least one abstraction was refined.
+   */
+  bool refine_abstractions();
+
   /** Sat interface used for d_cnf_encoder. */
   class BitblastSatSolver;
 
@@ -61,6 +139,26 @@ class BvBitblastSolver : public Solver, public BvSolverInterface
   backtrack::vector<Node> d_assertions;
   /** The current set of assumptions. */
   backtrack::vector<Node> d_assumptions;
+  /**
+   * The current set of assertions of non-zero scope levels if unsat cores
+   * are disabled, paired with the index of the activation literal of their
+   * level.
+   */
+  backtrack::vector<std::pair<Node, size_t>> d_scoped_assertions;
+  /** Index in d_scoped_assertions to mark already encoded assertions. */
+  backtrack::object<size_t> d_scoped_assertions_index;
+  /**
+   * The activation literals of the current scope levels (as indices in
+   * d_activation_bits), the literal of level i is at position i - 1.
+   */
+  backtrack::vector<size_t> d_activation_lits;
+  /**
+   * All activation literals ever created. Bits are kept alive, since their
+   * ids are used as variables in the SAT solver.
+   */
+  std::vector<bitblast::AigNode> d_activation_bits;
+  /** Marks the activation literals of popped levels that were compacted. */
+  std::vector<bool> d_activation_retired;
 
   /** AIG bit-blaster. */
   AigBitblaster d_bitblaster;
@@ -73,6 +171,13 @@ class BvBitblastSolver : public Solver, public BvSolverInterface
   std::unique_ptr<BitblastSatSolver> d_bitblast_sat_solver;
   /** Result of last solve() call. */
   Result d_last_result;
+  /** The conflict limit for the next solve() call, 0 for no limit. */
+  uint64_t d_conflict_limit = 0;
+
+  /** Number of abstractions of d_bitblaster that were already encoded. */
+  size_t d_num_encoded_abstractions = 0;
+  /** The encoded abstractions that were not refined yet. */
+  std::vector<Node> d_abstractions;
 
   struct Statistics
   {
@@ -80,12 +185,17 @@ class BvBitblastSolver : public Solver, public BvSolverInterface
     util::TimerStatistic& time_sat;
     util::TimerStatistic& time_bitblast;
     util::TimerStatistic& time_encode;
-    uint64_t& num_aig_ands;
-    uint64_t& num_aig_consts;
-    uint64_t& num_aig_shared;
-    uint64_t& num_cnf_vars;
-    uint64_t& num_cnf_clauses;
-    uint64_t& num_cnf_literals;
+    util::CounterStatistic& num_aig_ands;
+    util::CounterStatistic& num_aig_consts;
+    util::CounterStatistic& num_aig_shared;
+    util::CounterStatistic& num_cnf_vars;
+    util::CounterStatistic& num_cnf_clauses;
+    util::CounterStatistic& num_cnf_literals;
+    util::CounterStatistic& num_activation_lits;
+    util::CounterStatistic& num_activation_lits_retired;
+    util::CounterStatistic& num_abstractions;
+    util::CounterStatistic& num_refinements;
+    util::CounterStatistic& num_phases;
   } d_stats;
 };
 
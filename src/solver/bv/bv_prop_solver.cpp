@@ -53,6 +53,10 @@ BvPropSolver::BvPropSolver(Env& env,
 
   d_ls->d_options.prob_pick_ess_input =
       1000 - options.prop_prob_pick_random_input();
+  d_ls->d_options.num_cand_moves = options.prop_cand_moves();
+  d_ls->d_options.restart_base   = options.prop_restarts();
+  d_ls->d_options.prob_perturb   = options.prop_prob_perturb();
+  d_ls->d_options.tabu_tenure    = options.prop_tabu();
 
   d_ls->init();
 
@@ -60,6 +64,8 @@ BvPropSolver::BvPropSolver(Env& env,
 
   d_use_sext       = options.prop_sext();
   d_use_const_bits = options.prop_const_bits();
+  d_track_best     = options.bv_solver() == option::BvSolver::PREPROP
+                     && options.prop_sat_phases();
 }
 
 BvPropSolver::~BvPropSolver() {}
@@ -85,6 +91,11 @@ BvPropSolver::solve()
     d_ls->normalize();
   }
 
+  if (d_env.options().prop_fixpoint())
+  {
+    d_ls->propagate_fixpoint();
+  }
+
   // incremental: increase limit by given nprops/nupdates
   if (nprops)
   {
@@ -100,6 +111,11 @@ BvPropSolver::solve()
   d_ls->set_max_nupdates(nupdates);
   Log(1) << "set cone update limit to " << nupdates;
 
+  if (d_track_best)
+  {
+    update_best_assignment(true);
+  }
+
   for (uint32_t j = 0;; ++j)
   {
     if (d_env.terminate() || (nprops && d_ls->num_props() >= nprops)
@@ -130,6 +146,11 @@ BvPropSolver::solve()
     {
       goto SAT;
     }
+
+    if (d_track_best)
+    {
+      update_best_assignment();
+    }
   }
 
 SAT:
@@ -183,7 +204,13 @@ BvPropSolver::register_assertion(const Node& assertion,
     else if (it->second)
     {
       it->second      = false;
-      d_node_map[cur] = mk_node(cur);
+      uint64_t id     = mk_node(cur);
+      d_node_map[cur] = id;
+      if (BvSolver::is_leaf(cur) && !cur.is_value())
+      {
+        d_leaf_index.emplace(id, d_leaves.size());
+        d_leaves.push_back(cur);
+      }
       visit.pop_back();
     }
   } while (!visit.empty());
@@ -222,6 +249,58 @@ BvPropSolver::unsat_core(std::vector<Node>& core) const
   core.push_back(it->second);
 }
 
+void
+BvPropSolver::seed_phases()
+{
+  assert(d_best_assignment.size() <= d_leaves.size());
+  for (size_t i = 0, size = d_best_assignment.size(); i < size; ++i)
+  {
+    d_bb_solver.phase(d_leaves[i], d_best_assignment[i]);
+  }
+  d_num_phased = d_best_assignment.size();
+}
+
+void
+BvPropSolver::clear_phases()
+{
+  for (size_t i = 0; i < d_num_phased; ++i)
+  {
+    d_bb_solver.unphase(d_leaves[i]);
+  }
+  d_num_phased = 0;
+}
+
+void
+BvPropSolver::fix_bits()
+{
+  for (const Node& leaf : d_leaves)
+  {
+    const auto& bits = d_bb_solver.bitblaster().bits(leaf);
+    if (bits.empty())
+    {
+      continue;
+    }
+
+    uint64_t size = bits.size();
+    BitVectorDomain domain(size);
+    bool has_fixed = false;
+    for (uint64_t i = 0; i < size; ++i)
+    {
+      int32_t val = d_bb_solver.fixed(bits[i]);
+      if (val)
+      {
+        domain.fix_bit(size - 1 - i, val > 0);
+        has_fixed = true;
+      }
+    }
+    if (has_fixed)
+    {
+      d_stats.num_bits_fixed_sat +=
+          d_ls->fix_bits(d_node_map.at(leaf), domain);
+    }
+  }
+}
+
 uint64_t
 BvPropSolver::mk_node(const Node& node)
 {
@@ -466,12 +545,52 @@ BvPropSolver::print_progress() const
   }
 }
 
+void
+BvPropSolver::update_best_assignment(bool init)
+{
+  uint64_t num_roots_unsat = d_ls->get_num_roots_unsat();
+  if (init)
+  {
+    d_best_assignment.clear();
+    for (const Node& leaf : d_leaves)
+    {
+      d_best_assignment.push_back(d_ls->get_assignment(d_node_map.at(leaf)));
+    }
+  }
+  else
+  {
+    if (num_roots_unsat >= d_best_num_roots_unsat)
+    {
+      return;
+    }
+    for (uint64_t id : d_ls->get_updated_inputs())
+    {
+      auto it = d_leaf_index.find(id);
+      if (it != d_leaf_index.end())
+      {
+        d_best_assignment[it->second] = d_ls->get_assignment(id);
+      }
+    }
+  }
+  d_ls->clear_updated_inputs();
+  d_best_num_roots_unsat = num_roots_unsat;
+  ++d_stats.num_best_updates;
+}
+
 BvPropSolver::Statistics::Statistics(util::Statistics& stats,
                                      const std::string& prefix)
-    : num_checks(stats.new_stat<uint64_t>(prefix + "num_checks")),
-      num_assertions(stats.new_stat<uint64_t>(prefix + "num_assertions")),
-      num_bits_fixed(stats.new_stat<uint64_t>(prefix + "num_bits_fixed")),
-      num_bits_total(stats.new_stat<uint64_t>(prefix + "num_bits_total")),
+    : num_checks(stats.new_stat<util::CounterStatistic>(prefix + "num_checks")),
+      num_assertions(
+          stats.new_stat<util::CounterStatistic>(prefix + "num_assertions")),
+      num_bits_fixed(
+          stats.new_stat<util::CounterStatistic>(prefix + "num_bits_fixed")),
+      num_bits_total(
+          stats.new_stat<util::CounterStatistic>(prefix + "num_bits_total")),
+      num_bits_fixed_sat(
+          stats.new_stat<util::CounterStatistic>(
+              prefix + "num_bits_fixed_sat")),
+      num_best_updates(
+          stats.new_stat<util::CounterStatistic>(prefix + "num_best_updates")),
       time_mk_node(
           stats.new_stat<util::TimerStatistic>(prefix + "time_mk_node")),
       time_check(stats.new_stat<util::TimerStatistic>(prefix + "time_check"))
@@ -42,6 +42,27 @@ class BvPropSolver : public Solver, public BvSolverInterface
   /** Get unsat core of last solve() call. */
   void unsat_core(std::vector<Node>& core) const override;
 
+  /**
+   * Seed the phases of the SAT solver of the associated bit-blasting solver
+   * with the assignment of the leaves with the fewest unsatisfied roots
+   * found in the last solve() call.
+   */
+  void seed_phases();
+
+  /**
+   * Reset the phases seeded by seed_phases(). Must be called once the
+   * SAT solver call they were seeded for is done, since the next solve()
+   * call records a new assignment.
+   */
+  void clear_phases();
+
+  /**
+   * Fix the domain bits of the leaves to the values of their bits that are
+   * fixed at the top level of the SAT solver of the associated bit-blasting
+   * solver.
+   */
+  void fix_bits();
+
  private:
   /** Backtrack manager to sync push/pop with local search engine. */
   class LsBacktrack : public backtrack::Backtrackable
@@ -69,6 +90,15 @@ class BvPropSolver : public Solver, public BvSolverInterface
    */
   void print_progress() const;
 
+  /**
+   * Record the current assignment of the leaves if it has fewer unsatisfied
+   * roots than the best assignment of the current solve() call. Only the
+   * leaves updated since the last recorded assignment are copied.
+   * @param init True to record the current assignment of all leaves at the
+   *             beginning of a solve() call.
+   */
+  void update_best_assignment(bool init = false);
+
   /**
    * The associated bit-blasting solver, for bit-blasting to determine
    * constant bits information. We utilize the bit-blaster of the BB solver
@@ -83,6 +113,21 @@ class BvPropSolver : public Solver, public BvSolverInterface
   std::unordered_map<Node, uint64_t> d_node_map;
   /** Map LocalSearchBV root id to Bitwuzla node for unsat cores. */
   std::unordered_map<uint64_t, Node> d_root_id_node_map;
+  /** The leaves registered with the local search engine. */
+  std::vector<Node> d_leaves;
+  /** Map LocalSearchBV node id of leaf to its index in d_leaves. */
+  std::unordered_map<uint64_t, size_t> d_leaf_index;
+  /**
+   * The assignment of the leaves (in the order of d_leaves) with the fewest
+   * unsatisfied roots found in the last solve() call.
+   */
+  std::vector<BitVector> d_best_assignment;
+  /** The number of unsatisfied roots of d_best_assignment. */
+  uint64_t d_best_num_roots_unsat = 0;
+  /** The number of leaves (prefix of d_leaves) with seeded phases. */
+  size_t d_num_phased = 0;
+  /** True to record the best assignment for seeding SAT phases. */
+  bool d_track_best = false;
   /** True to enable constant bits propagation. */
   bool d_use_const_bits = false;
   /** True to use sign_extend nodes for concats that represent sign_extends. */
@@ -91,10 +136,12 @@ class BvPropSolver : public Solver, public BvSolverInterface
   struct Statistics
   {
     Statistics(util::Statistics& stats, const std::string& prefix);
-    uint64_t& num_checks;
-    uint64_t& num_assertions;
-    uint64_t& num_bits_fixed;
-    uint64_t& num_bits_total;
+    util::CounterStatistic& num_checks;
+    util::CounterStatistic& num_assertions;
+    util::CounterStatistic& num_bits_fixed;
+    util::CounterStatistic& num_bits_total;
+    util::CounterStatistic& num_bits_fixed_sat;
+    util::CounterStatistic& num_best_updates;
     util::TimerStatistic& time_mk_node;
     util::TimerStatistic& time_check;
   } d_stats;
@@ -103,12 +103,38 @@ BvSolver::solve()
       d_sat_state = d_prop_solver.solve();
       break;
     case option::BvSolver::PREPROP:
-      d_cur_solver = option::BvSolver::PROP;
-      d_sat_state  = d_prop_solver.solve();
-      if (d_sat_state == Result::UNKNOWN)
+      // Alternate between local search and bit-blasting with a doubling
+      // conflict limit if slicing is enabled, else fall back to a single
+      // unbounded SAT solver call.
+      for (uint64_t slice = d_env.options().prop_sat_slice();;)
       {
+        if (d_env.options().prop_sat_fixed())
+        {
+          d_prop_solver.fix_bits();
+        }
+        d_cur_solver = option::BvSolver::PROP;
+        d_sat_state  = d_prop_solver.solve();
+        if (d_sat_state != Result::UNKNOWN)
+        {
+          break;
+        }
         d_cur_solver = option::BvSolver::BITBLAST;
+        if (d_env.options().prop_sat_phases())
+        {
+          d_prop_solver.seed_phases();
+        }
+        d_bitblast_solver.set_conflict_limit(slice);
         d_sat_state = d_bitblast_solver.solve();
+        ++d_stats.num_sat_slices;
+        if (d_env.options().prop_sat_phases())
+        {
+          d_prop_solver.clear_phases();
+        }
+        if (d_sat_state != Result::UNKNOWN || slice == 0 || d_env.terminate())
+        {
+          break;
+        }
+        slice = slice > UINT64_MAX / 2 ? UINT64_MAX : slice * 2;
       }
       break;
   }
@@ -139,11 +165,25 @@ BvSolver::unsat_core(std::vector<Node>& core) const
   return d_prop_solver.unsat_core(core);
 }
 
+int32_t
+BvSolver::fixed(const Node& term)
+{
+  if (d_cur_solver == option::BvSolver::BITBLAST)
+  {
+    return d_bitblast_solver.fixed(term);
+  }
+  return 0;
+}
+
 /* --- BvBitblastSolver private --------------------------------------------- */
 
 BvSolver::Statistics::Statistics(util::Statistics& stats)
-    : num_checks(stats.new_stat<uint64_t>("solver::bv::num_checks")),
-      num_assertions(stats.new_stat<uint64_t>("solver::bv::num_assertions")),
+    : num_checks(
+          stats.new_stat<util::CounterStatistic>("solver::bv::num_checks")),
+      num_assertions(
+          stats.new_stat<util::CounterStatistic>("solver::bv::num_assertions")),
+      num_sat_slices(
+          stats.new_stat<util::CounterStatistic>("solver::bv::num_sat_slices")),
       time_check(stats.new_stat<util::TimerStatistic>("solver::bv::time_check"))
 {
 }
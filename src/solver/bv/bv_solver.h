@@ -47,6 +47,19 @@ class BvSolver : public Solver, public BvSolverInterface
   /** Get unsat core of last solve() call. */
   void unsat_core(std::vector<Node>& core) const override;
 
+  /**
+   * Determine if given Boolean term is implied by the current set of
+   * top-level assertions and lemmas.
+   *
+   * @note This information is only available if the bit-blasting subsolver
+   *       is active.
+   *
+   * @param term The term to query.
+   * @return 1 if it is implied, -1 if its negation is implied and 0 if
+   *         unknown.
+   */
+  int32_t fixed(const Node& term);
+
   /** Get overall BV solver statistics. */
   const auto& statistics() const { return d_stats; }
 
@@ -81,8 +94,9 @@ class BvSolver : public Solver, public BvSolverInterface
   struct Statistics
   {
     Statistics(util::Statistics& stats);
-    uint64_t& num_checks;
-    uint64_t& num_assertions;
+    util::CounterStatistic& num_checks;
+    util::CounterStatistic& num_assertions;
+    util::CounterStatistic& num_sat_slices;
     util::TimerStatistic& time_check;
   } d_stats;
 };
@@ -10,7 +10,13 @@
 
 #include "solver/fp/floating_point.h"
 
+#include <cfenv>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
 #include <gmpxx.h>
+#include <limits>
+#include <optional>
 #include <symfpu/core/add.h>
 #include <symfpu/core/classify.h>
 #include <symfpu/core/compare.h>
@@ -30,9 +36,224 @@
 template <bool T>
 class SymFpuSymBV;
 
+/**
+ * Use host IEEE-754 arithmetic for concrete binary32 and binary64 operations
+ * if the host evaluates floating-point expressions in the precision of their
+ * type (no excess precision, e.g., x87), supports all directed rounding
+ * modes, and we can disable flush-to-zero and denormals-are-zero modes
+ * (SSE2 and AArch64). Never use it with -ffast-math, which does not preserve
+ * IEEE-754 semantics.
+ */
+#if !defined(__FAST_MATH__) && defined(FLT_EVAL_METHOD) \
+    && FLT_EVAL_METHOD == 0 && defined(FE_TONEAREST) && defined(FE_UPWARD) \
+    && defined(FE_DOWNWARD) && defined(FE_TOWARDZERO) \
+    && (defined(__SSE2__) || defined(__aarch64__))
+#define BZLA_FP_NATIVE 1
+#else
+#define BZLA_FP_NATIVE 0
+#endif
+
+#if BZLA_FP_NATIVE
+#if defined(__SSE2__)
+#include <xmmintrin.h>
+#endif
+/* GCC ignores FENV_ACCESS, this file is compiled with -frounding-math. */
+#if defined(__clang__)
+#pragma STDC FENV_ACCESS ON
+#endif
+#endif
+
 namespace bzla {
 using namespace node;
 
+namespace {
+
+/* --- Native floating-point fast path -------------------------------------- */
+
+template <typename T>
+struct NativeFormat;
+
+template <>
+struct NativeFormat<float>
+{
+  using Bits                         = uint32_t;
+  static constexpr uint32_t exp_size = 8;
+  static constexpr uint32_t sig_size = 24;
+};
+
+template <>
+struct NativeFormat<double>
+{
+  using Bits                         = uint64_t;
+  static constexpr uint32_t exp_size = 11;
+  static constexpr uint32_t sig_size = 53;
+};
+
+/**
+ * @return True if floating-points of given format can be represented by
+ *         native type T.
+ */
+template <typename T>
+bool
+is_native(const FloatingPointTypeInfo &size)
+{
+  return std::numeric_limits<T>::is_iec559
+         && size.exponentWidth() == NativeFormat<T>::exp_size
+         && size.significandWidth() == NativeFormat<T>::sig_size;
+}
+
+/** Convert floating-point to native type T. */
+template <typename T>
+T
+to_native(const FloatingPoint &fp)
+{
+  typename NativeFormat<T>::Bits bits =
+      static_cast<typename NativeFormat<T>::Bits>(fp.as_bv().to_uint64());
+  T res;
+  std::memcpy(&res, &bits, sizeof(T));
+  return res;
+}
+
+/** Convert native value of type T to a floating-point of given format. */
+template <typename T>
+FloatingPoint
+from_native(const FloatingPointTypeInfo &size, T val)
+{
+  typename NativeFormat<T>::Bits bits;
+  std::memcpy(&bits, &val, sizeof(T));
+  FloatingPoint res(size);
+  res.set_unpacked(symfpu::unpack<fp::SymFpuTraits>(
+      size, BitVector::from_ui(size.packedWidth(), bits)));
+  return res;
+}
+
+/**
+ * @return The host rounding mode corresponding to given rounding mode, or -1
+ *         if the host does not support it (roundNearestTiesToAway).
+ */
+int
+native_rounding_mode(RoundingMode rm)
+{
+#if BZLA_FP_NATIVE
+  switch (rm)
+  {
+    case RoundingMode::RNE: return FE_TONEAREST;
+    case RoundingMode::RTN: return FE_DOWNWARD;
+    case RoundingMode::RTP: return FE_UPWARD;
+    case RoundingMode::RTZ: return FE_TOWARDZERO;
+    default: break;
+  }
+#else
+  (void) rm;
+#endif
+  return -1;
+}
+
+#if BZLA_FP_NATIVE
+/**
+ * Scoped IEEE-754 conforming host floating-point environment.
+ *
+ * Saves the floating-point environment of the host, clears its exception
+ * flags, and disables flush-to-zero and denormals-are-zero modes. The saved
+ * environment (including exception flags, rounding mode and FTZ/DAZ modes) is
+ * restored on destruction.
+ */
+class NativeEnv
+{
+ public:
+  NativeEnv()
+  {
+    std::feholdexcept(&d_env);
+#if defined(__SSE2__)
+    d_csr = _mm_getcsr();
+    _mm_setcsr(d_csr & ~(s_ftz | s_daz));
+#else
+    __asm__ __volatile__("mrs %0, fpcr" : "=r"(d_csr));
+    __asm__ __volatile__("msr fpcr, %0" : : "r"(d_csr & ~s_fz));
+#endif
+  }
+  ~NativeEnv()
+  {
+#if defined(__SSE2__)
+    _mm_setcsr(d_csr);
+#else
+    __asm__ __volatile__("msr fpcr, %0" : : "r"(d_csr));
+#endif
+    std::fesetenv(&d_env);
+  }
+
+ private:
+#if defined(__SSE2__)
+  /** MXCSR flush-to-zero bit. */
+  static constexpr uint32_t s_ftz = 0x8000;
+  /** MXCSR denormals-are-zero bit. */
+  static constexpr uint32_t s_daz = 0x0040;
+  uint32_t d_csr;
+#else
+  /** FPCR flush-to-zero bit. */
+  static constexpr uint64_t s_fz = uint64_t{1} << 24;
+  uint64_t d_csr;
+#endif
+  std::fenv_t d_env;
+};
+#endif
+
+/**
+ * Evaluate an operation with host arithmetic under given rounding mode.
+ *
+ * The operation is evaluated in a scoped IEEE-754 conforming environment,
+ * the floating-point environment of the host is left untouched.
+ *
+ * @param size The format of the operands and the result.
+ * @param rm The host rounding mode, see native_rounding_mode().
+ * @param op The operation, a generic callable that is called with a value of
+ *           the native type to select the overload.
+ * @return The result, or std::nullopt if the format or the rounding mode is
+ *         not supported natively.
+ */
+template <typename Op>
+std::optional<FloatingPoint>
+native_op(const FloatingPointTypeInfo &size, int rm, Op op)
+{
+#if BZLA_FP_NATIVE
+  if (rm >= 0)
+  {
+    bool is_float = is_native<float>(size);
+    if (is_float || is_native<double>(size))
+    {
+      // Note: GCC does not fully implement FENV_ACCESS and may still move
+      //       arithmetic across the environment changes below even with
+      //       -frounding-math (GCC PR 34678). Storing the result to a
+      //       volatile while the environment is active prevents this.
+      if (is_float)
+      {
+        volatile float val;
+        {
+          NativeEnv env;
+          if (std::fesetround(rm) != 0) return std::nullopt;
+          val = op(float{});
+        }
+        return from_native<float>(size, val);
+      }
+      volatile double val;
+      {
+        NativeEnv env;
+        if (std::fesetround(rm) != 0) return std::nullopt;
+        val = op(double{});
+      }
+      return from_native<double>(size, val);
+    }
+  }
+#else
+  (void) size;
+  (void) rm;
+  (void) op;
+#endif
+  return std::nullopt;
+}
+
+}  // namespace
+
 /* --- FloatingPoint public static ------------------------------------------ */
 
 void
@@ -395,6 +616,13 @@ FloatingPoint::fpneg() const
 FloatingPoint
 FloatingPoint::fpsqrt(const RoundingMode rm) const
 {
+  auto nres = native_op(*d_size, native_rounding_mode(rm), [this](auto t) {
+    return std::sqrt(to_native<decltype(t)>(*this));
+  });
+  if (nres)
+  {
+    return *nres;
+  }
   FloatingPoint res(*d_size);
   res.d_uf.reset(new UnpackedFloat(
       symfpu::sqrt<fp::SymFpuTraits>(*res.size(), rm, *d_uf)));
@@ -404,6 +632,26 @@ FloatingPoint::fpsqrt(const RoundingMode rm) const
 FloatingPoint
 FloatingPoint::fprti(const RoundingMode rm) const
 {
+  std::optional<FloatingPoint> nres;
+  if (rm == RoundingMode::RNA)
+  {
+    // std::round() rounds to nearest with ties away from zero independent of
+    // the current rounding mode.
+    nres = native_op(
+        *d_size, native_rounding_mode(RoundingMode::RNE), [this](auto t) {
+          return std::round(to_native<decltype(t)>(*this));
+        });
+  }
+  else
+  {
+    nres = native_op(*d_size, native_rounding_mode(rm), [this](auto t) {
+      return std::nearbyint(to_native<decltype(t)>(*this));
+    });
+  }
+  if (nres)
+  {
+    return *nres;
+  }
   FloatingPoint res(*d_size);
   res.d_uf.reset(new UnpackedFloat(
       symfpu::roundToIntegral<fp::SymFpuTraits>(*res.size(), rm, *d_uf)));
@@ -413,6 +661,16 @@ FloatingPoint::fprti(const RoundingMode rm) const
 FloatingPoint
 FloatingPoint::fprem(const FloatingPoint &fp) const
 {
+  // The remainder is exact, hence independent of the rounding mode.
+  auto nres = native_op(
+      *d_size, native_rounding_mode(RoundingMode::RNE), [&](auto t) {
+        using T = decltype(t);
+        return std::remainder(to_native<T>(*this), to_native<T>(fp));
+      });
+  if (nres)
+  {
+    return *nres;
+  }
   FloatingPoint res(*d_size);
   res.d_uf.reset(new UnpackedFloat(
       symfpu::remainder<fp::SymFpuTraits>(*res.size(), *d_uf, *fp.unpacked())));
@@ -422,6 +680,14 @@ FloatingPoint::fprem(const FloatingPoint &fp) const
 FloatingPoint
 FloatingPoint::fpadd(const RoundingMode rm, const FloatingPoint &fp) const
 {
+  auto nres = native_op(*d_size, native_rounding_mode(rm), [&](auto t) {
+    using T = decltype(t);
+    return to_native<T>(*this) + to_native<T>(fp);
+  });
+  if (nres)
+  {
+    return *nres;
+  }
   FloatingPoint res(*d_size);
   res.d_uf.reset(new UnpackedFloat(symfpu::add<fp::SymFpuTraits>(
       *res.size(), rm, *d_uf, *fp.unpacked(), true)));
@@ -431,6 +697,14 @@ FloatingPoint::fpadd(const RoundingMode rm, const FloatingPoint &fp) const
 FloatingPoint
 FloatingPoint::fpmul(const RoundingMode rm, const FloatingPoint &fp) const
 {
+  auto nres = native_op(*d_size, native_rounding_mode(rm), [&](auto t) {
+    using T = decltype(t);
+    return to_native<T>(*this) * to_native<T>(fp);
+  });
+  if (nres)
+  {
+    return *nres;
+  }
   FloatingPoint res(*d_size);
   res.d_uf.reset(new UnpackedFloat(symfpu::multiply<fp::SymFpuTraits>(
       *res.size(), rm, *d_uf, *fp.unpacked())));
@@ -440,6 +714,14 @@ FloatingPoint::fpmul(const RoundingMode rm, const FloatingPoint &fp) const
 FloatingPoint
 FloatingPoint::fpdiv(const RoundingMode rm, const FloatingPoint &fp) const
 {
+  auto nres = native_op(*d_size, native_rounding_mode(rm), [&](auto t) {
+    using T = decltype(t);
+    return to_native<T>(*this) / to_native<T>(fp);
+  });
+  if (nres)
+  {
+    return *nres;
+  }
   FloatingPoint res(*d_size);
   res.d_uf.reset(new UnpackedFloat(symfpu::divide<fp::SymFpuTraits>(
       *res.size(), rm, *d_uf, *fp.unpacked())));
@@ -451,6 +733,14 @@ FloatingPoint::fpfma(const RoundingMode rm,
                      const FloatingPoint &fp0,
                      const FloatingPoint &fp1) const
 {
+  auto nres = native_op(*d_size, native_rounding_mode(rm), [&](auto t) {
+    using T = decltype(t);
+    return std::fma(to_native<T>(*this), to_native<T>(fp0), to_native<T>(fp1));
+  });
+  if (nres)
+  {
+    return *nres;
+  }
   FloatingPoint res(*d_size);
   res.d_uf.reset(new UnpackedFloat(symfpu::fma<fp::SymFpuTraits>(
       *res.size(), rm, *d_uf, *fp0.unpacked(), *fp1.unpacked())));
@@ -16,12 +16,14 @@
 #include "node/node_ref_vector.h"
 #include "node/node_utils.h"
 #include "node/unordered_node_ref_map.h"
+#include "rewrite/evaluator.h"
 #include "rewrite/rewriter.h"
 #include "solver/array/array_solver.h"
 #include "solver/fp/floating_point.h"
 #include "solver/fp/rounding_mode.h"
 #include "solver/fun/fun_solver.h"
 #include "solver/quant/quant_solver.h"
+#include "util/trace.h"
 
 namespace bzla::fp {
 
@@ -53,20 +55,24 @@ FpSolver::~FpSolver() {}
 bool
 FpSolver::check()
 {
+  TraceScope("solver::fp::check");
   Log(1);
   Log(1) << "*** check fp";
 
   reset_cached_values();
-  NodeManager& nm = d_env.nm();
+  NodeManager& nm   = d_env.nm();
+  bool word_blasted = false;
   for (size_t i = d_word_blast_index.get(), size = d_word_blast_queue.size();
        i < size;
        ++i)
   {
     const Node& node = d_word_blast_queue[i];
     Node wb = d_word_blaster.word_blast(node);
+    d_word_blaster.activate_abstractions(node);
 
     if (wb == node) continue;
 
+    word_blasted = true;
     if (node.type().is_bool())
     {
       assert(wb.type().is_bv() && wb.type().bv_size() == 1);
@@ -80,6 +86,13 @@ FpSolver::check()
     }
   }
   d_word_blast_index = d_word_blast_queue.size();
+
+  // Only check abstractions if no new terms were word-blasted, the current
+  // model is not final otherwise.
+  if (!word_blasted && d_env.options().fp_abstraction())
+  {
+    check_abstractions();
+  }
   return true;
 }
 
@@ -100,23 +113,54 @@ FpSolver::value(const Node& term)
       || term.kind() == node::Kind::FP_TO_UBV
       || term.kind() == node::Kind::FP_MIN || term.kind() == node::Kind::FP_MAX)
   {
-    Node wb         = d_env.rewriter().rewrite(d_word_blaster.word_blast(term));
-    Node value      = d_solver_state.value(wb);
-    assert(value.type().is_bv());
-    if (term.type().is_bv())
+    return word_blasted_value(term);
+  }
+  return node::utils::mk_default_value(nm, term.type());
+}
+
+Node
+FpSolver::word_blasted_value(const Node& term)
+{
+  NodeManager& nm = d_env.nm();
+  Node wb         = d_env.rewriter().rewrite(d_word_blaster.word_blast(term));
+  Node value      = d_solver_state.value(wb);
+  assert(value.type().is_bv());
+  if (term.type().is_bv())
+  {
+    return value;
+  }
+  const BitVector& bv = value.value<BitVector>();
+  if (term.type().is_rm())
+  {
+    uint64_t rm = bv.to_uint64();
+    return nm.mk_value(static_cast<RoundingMode>(rm));
+  }
+  assert(term.type().is_fp());
+  return nm.mk_value(FloatingPoint(term.type(), bv));
+}
+
+void
+FpSolver::check_abstractions()
+{
+  NodeManager& nm = d_env.nm();
+  for (const Node& node : d_word_blaster.abstractions())
+  {
+    if (d_word_blaster.is_refined(node))
     {
-      return value;
+      continue;
     }
-    const BitVector& bv = value.value<BitVector>();
-    if (term.type().is_rm())
+    std::vector<Node> values;
+    for (const Node& child : node)
     {
-      uint64_t rm = bv.to_uint64();
-      return nm.mk_value(static_cast<RoundingMode>(rm));
+      values.push_back(word_blasted_value(child));
+    }
+    Node expected = Evaluator::evaluate(nm, node.kind(), values);
+    if (expected != word_blasted_value(node))
+    {
+      Log(2) << "refine abstraction: " << node;
+      d_solver_state.lemma(d_word_blaster.refine(node));
     }
-    assert(term.type().is_fp());
-    return nm.mk_value(FloatingPoint(term.type(), bv));
   }
-  return node::utils::mk_default_value(nm, term.type());
 }
 
 void
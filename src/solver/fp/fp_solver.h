@@ -38,6 +38,20 @@ class FpSolver : public Solver
   void register_term(const Node& term) override;
 
  private:
+  /**
+   * Compute the value of a term based on its word-blasted bit-vector
+   * structure.
+   * @param term The term.
+   * @return The value of the term.
+   */
+  Node word_blasted_value(const Node& term);
+
+  /**
+   * Check abstracted floating-point operations against their concrete
+   * semantics under the current model and refine violated abstractions.
+   */
+  void check_abstractions();
+
   /** The word blaster. */
   WordBlaster d_word_blaster;
   /** The current queue of nodes to word-blast on the next check() call. */
@@ -20,12 +20,15 @@
 #include <symfpu/core/sqrt.h>
 #include <symfpu/core/unpackedFloat.h>
 
+#include <optional>
 #include <sstream>
 
 #include "env.h"
 #include "node/node_ref_vector.h"
 #include "node/node_utils.h"
 #include "node/unordered_node_ref_map.h"
+#include "rewrite/evaluator.h"
+#include "rewrite/rewriter.h"
 #include "solver/array/array_solver.h"
 #include "solver/fp/fp_solver.h"
 #include "solver/fp/symfpu_wrapper.h"
@@ -59,8 +62,152 @@ is_leaf(const Node& node)
          || fun::FunSolver::is_theory_leaf(node)
          || quant::QuantSolver::is_theory_leaf(node);
 }
+
+/**
+ * Determine if given kind is an expensive floating-point operation that is
+ * word-blasted via operator templates.
+ * @param kind The kind to query.
+ */
+bool
+is_template_kind(node::Kind kind)
+{
+  return kind == node::Kind::FP_ADD || kind == node::Kind::FP_MUL
+         || kind == node::Kind::FP_DIV || kind == node::Kind::FP_FMA
+         || kind == node::Kind::FP_SQRT || kind == node::Kind::FP_REM
+         || kind == node::Kind::FP_RTI || kind == node::Kind::FP_TO_FP_FROM_FP
+         || kind == node::Kind::FP_TO_FP_FROM_SBV
+         || kind == node::Kind::FP_TO_FP_FROM_UBV;
+}
+
+/**
+ * Determine if given kind is an expensive floating-point operation that is
+ * abstracted if lazy floating-point abstraction is enabled.
+ * @param kind The kind to query.
+ */
+bool
+is_abstraction_kind(node::Kind kind)
+{
+  return kind == node::Kind::FP_MUL || kind == node::Kind::FP_DIV
+         || kind == node::Kind::FP_FMA || kind == node::Kind::FP_SQRT
+         || kind == node::Kind::FP_REM;
+}
+
+/**
+ * Determine if nodes of given kind can be folded on the word level if all of
+ * their operands are values.
+ * @param kind The kind to query.
+ */
+bool
+is_foldable_kind(node::Kind kind)
+{
+  return is_template_kind(kind) || kind == node::Kind::FP_IS_INF
+         || kind == node::Kind::FP_IS_NAN || kind == node::Kind::FP_IS_NEG
+         || kind == node::Kind::FP_IS_NORMAL || kind == node::Kind::FP_IS_POS
+         || kind == node::Kind::FP_IS_SUBNORMAL
+         || kind == node::Kind::FP_IS_ZERO || kind == node::Kind::FP_LEQ
+         || kind == node::Kind::FP_LT;
+}
+
+/**
+ * Substitute nodes in given node.
+ * @param nm The associated node manager.
+ * @param node The node to substitute.
+ * @param substs The substitution map.
+ * @param cache The substitution cache.
+ * @return The substituted node.
+ */
+Node
+substitute(NodeManager& nm,
+           const Node& node,
+           const std::unordered_map<Node, Node>& substs,
+           std::unordered_map<Node, Node>& cache)
+{
+  node::node_ref_vector visit{node};
+  do
+  {
+    const Node& cur     = visit.back();
+    auto [it, inserted] = cache.emplace(cur, Node());
+    if (inserted)
+    {
+      auto its = substs.find(cur);
+      if (its != substs.end())
+      {
+        it->second = its->second;
+      }
+      else
+      {
+        visit.insert(visit.end(), cur.begin(), cur.end());
+        continue;
+      }
+    }
+    else if (it->second.is_null())
+    {
+      std::vector<Node> children;
+      for (const Node& child : cur)
+      {
+        auto itc = cache.find(child);
+        assert(itc != cache.end());
+        assert(!itc->second.is_null());
+        children.push_back(itc->second);
+      }
+      it->second = node::utils::rebuild_node(nm, cur, children);
+    }
+    visit.pop_back();
+  } while (!visit.empty());
+  return cache.at(node);
+}
 }  // namespace
 
+/**
+ * Key for operator templates. Non-value operands are represented by a null
+ * node in `d_values`.
+ */
+struct OpTemplateKey
+{
+  node::Kind d_kind;
+  Type d_type;
+  std::vector<Type> d_types;
+  std::vector<Node> d_values;
+
+  bool operator==(const OpTemplateKey& other) const
+  {
+    return d_kind == other.d_kind && d_type == other.d_type
+           && d_types == other.d_types && d_values == other.d_values;
+  }
+};
+
+struct OpTemplateKeyHash
+{
+  size_t operator()(const OpTemplateKey& key) const
+  {
+    size_t hash = static_cast<size_t>(key.d_kind);
+    hash        = hash * 31 + std::hash<Type>{}(key.d_type);
+    for (size_t i = 0, size = key.d_types.size(); i < size; ++i)
+    {
+      hash = hash * 31 + std::hash<Type>{}(key.d_types[i]);
+      hash = hash * 31 + std::hash<Node>{}(key.d_values[i]);
+    }
+    return hash;
+  }
+};
+
+/** Word-blasted circuit of an operator over placeholder operands. */
+struct OpTemplate
+{
+  /**
+   * The placeholders of the non-value operands in operand order. Rounding
+   * modes and bit-vectors are represented by one placeholder, floating-points
+   * by the placeholders for the nan, inf, zero, sign, exponent and
+   * significand components of the unpacked float.
+   */
+  std::vector<Node> d_placeholders;
+  /**
+   * The nan, inf, zero, sign, exponent and significand components of the
+   * resulting unpacked float.
+   */
+  std::vector<Node> d_components;
+};
+
 struct WordBlaster::Internal
 {
   SymFpuSymRMMap d_rm_map;
@@ -69,12 +216,18 @@ struct WordBlaster::Internal
   SymSBVMap d_sbv_map;
   UnpackedFloatMap d_unpacked_float_map;
   PackedFloatMap d_packed_float_map;
+  std::unordered_map<OpTemplateKey, OpTemplate, OpTemplateKeyHash> d_templates;
 };
 
 /* --- WordBlaster public --------------------------------------------------- */
 
 WordBlaster::WordBlaster(Env& env, SolverState& state)
-    : d_env(env), d_solver_state(state)
+    : d_abstractions(state.backtrack_mgr()),
+      d_abstractions_cache(state.backtrack_mgr()),
+      d_refined(state.backtrack_mgr()),
+      d_env(env),
+      d_solver_state(state),
+      d_stats(env.statistics(), "solver::fp::word_blaster::")
 {
   d_internal.reset(new Internal());
 }
@@ -201,7 +354,21 @@ WordBlaster::_word_blast(const Node& node)
     else if (!visited.at(cur))
     {
       const Type& type = cur.type();
-      if (kind == node::Kind::ITE && cur[1].type().is_rm())
+      if (is_foldable_kind(kind) && fold(cur))
+      {
+        // Folded on the word level.
+      }
+      else if (d_env.options().fp_abstraction() && is_abstraction_kind(kind))
+      {
+        abstract(cur);
+      }
+      else if (is_template_kind(kind))
+      {
+        std::vector<Node> c = instantiate_template(cur);
+        d_internal->d_unpacked_float_map.emplace(
+            cur, SymUnpackedFloat(c[0], c[1], c[2], c[3], c[4], c[5]));
+      }
+      else if (kind == node::Kind::ITE && cur[1].type().is_rm())
       {
         assert(d_internal->d_rm_map.find(cur[1]) != d_internal->d_rm_map.end());
         assert(d_internal->d_rm_map.find(cur[2]) != d_internal->d_rm_map.end());
@@ -264,25 +431,7 @@ WordBlaster::_word_blast(const Node& node)
       }
       else if (type.is_fp() && (cur.is_const() || is_leaf(cur)))
       {
-        Node inf =
-            nm.mk_const(nm.mk_bv_type(1), create_component_symbol(cur, "inf"));
-        Node nan =
-            nm.mk_const(nm.mk_bv_type(1), create_component_symbol(cur, "nan"));
-        Node sign =
-            nm.mk_const(nm.mk_bv_type(1), create_component_symbol(cur, "sign"));
-        Node zero =
-            nm.mk_const(nm.mk_bv_type(1), create_component_symbol(cur, "zero"));
-        Node exp =
-            nm.mk_const(nm.mk_bv_type(SymUnpackedFloat::exponentWidth(type)),
-                        create_component_symbol(cur, "exp"));
-        Node sig =
-            nm.mk_const(nm.mk_bv_type(SymUnpackedFloat::significandWidth(type)),
-                        create_component_symbol(cur, "sig"));
-
-        SymUnpackedFloat uf(nan, inf, zero, sign, exp, sig);
-        d_internal->d_unpacked_float_map.emplace(cur, uf);
-        d_solver_state.lemma(
-            node::utils::bv1_to_bool(nm, uf.valid(type).getNode()));
+        mk_unpacked_var(cur);
       }
       else if (kind == node::Kind::EQUAL && cur[0].type().is_fp())
       {
@@ -452,107 +601,6 @@ WordBlaster::_word_blast(const Node& node)
                   apply));
         }
       }
-      else if (kind == node::Kind::FP_REM)
-      {
-        assert(d_internal->d_unpacked_float_map.find(cur[0])
-               != d_internal->d_unpacked_float_map.end());
-        assert(d_internal->d_unpacked_float_map.find(cur[1])
-               != d_internal->d_unpacked_float_map.end());
-        d_internal->d_unpacked_float_map.emplace(
-            cur,
-            symfpu::remainder<SymFpuSymTraits>(
-                type,
-                d_internal->d_unpacked_float_map.at(cur[0]),
-                d_internal->d_unpacked_float_map.at(cur[1])));
-      }
-      else if (kind == node::Kind::FP_SQRT)
-      {
-        assert(d_internal->d_rm_map.find(cur[0]) != d_internal->d_rm_map.end());
-        assert(d_internal->d_unpacked_float_map.find(cur[1])
-               != d_internal->d_unpacked_float_map.end());
-        d_internal->d_unpacked_float_map.emplace(
-            cur,
-            symfpu::sqrt<SymFpuSymTraits>(
-                type,
-                d_internal->d_rm_map.at(cur[0]),
-                d_internal->d_unpacked_float_map.at(cur[1])));
-      }
-      else if (kind == node::Kind::FP_RTI)
-      {
-        assert(d_internal->d_rm_map.find(cur[0]) != d_internal->d_rm_map.end());
-        assert(d_internal->d_unpacked_float_map.find(cur[1])
-               != d_internal->d_unpacked_float_map.end());
-        d_internal->d_unpacked_float_map.emplace(
-            cur,
-            symfpu::roundToIntegral<SymFpuSymTraits>(
-                type,
-                d_internal->d_rm_map.at(cur[0]),
-                d_internal->d_unpacked_float_map.at(cur[1])));
-      }
-      else if (kind == node::Kind::FP_ADD)
-      {
-        assert(d_internal->d_rm_map.find(cur[0]) != d_internal->d_rm_map.end());
-        assert(d_internal->d_unpacked_float_map.find(cur[1])
-               != d_internal->d_unpacked_float_map.end());
-        assert(d_internal->d_unpacked_float_map.find(cur[2])
-               != d_internal->d_unpacked_float_map.end());
-        d_internal->d_unpacked_float_map.emplace(
-            cur,
-            symfpu::add<SymFpuSymTraits>(
-                type,
-                d_internal->d_rm_map.at(cur[0]),
-                d_internal->d_unpacked_float_map.at(cur[1]),
-                d_internal->d_unpacked_float_map.at(cur[2]),
-                SymFpuSymProp(true)));
-      }
-      else if (kind == node::Kind::FP_MUL)
-      {
-        assert(d_internal->d_rm_map.find(cur[0]) != d_internal->d_rm_map.end());
-        assert(d_internal->d_unpacked_float_map.find(cur[1])
-               != d_internal->d_unpacked_float_map.end());
-        assert(d_internal->d_unpacked_float_map.find(cur[2])
-               != d_internal->d_unpacked_float_map.end());
-        d_internal->d_unpacked_float_map.emplace(
-            cur,
-            symfpu::multiply<SymFpuSymTraits>(
-                type,
-                d_internal->d_rm_map.at(cur[0]),
-                d_internal->d_unpacked_float_map.at(cur[1]),
-                d_internal->d_unpacked_float_map.at(cur[2])));
-      }
-      else if (kind == node::Kind::FP_DIV)
-      {
-        assert(d_internal->d_rm_map.find(cur[0]) != d_internal->d_rm_map.end());
-        assert(d_internal->d_unpacked_float_map.find(cur[1])
-               != d_internal->d_unpacked_float_map.end());
-        assert(d_internal->d_unpacked_float_map.find(cur[2])
-               != d_internal->d_unpacked_float_map.end());
-        d_internal->d_unpacked_float_map.emplace(
-            cur,
-            symfpu::divide<SymFpuSymTraits>(
-                type,
-                d_internal->d_rm_map.at(cur[0]),
-                d_internal->d_unpacked_float_map.at(cur[1]),
-                d_internal->d_unpacked_float_map.at(cur[2])));
-      }
-      else if (kind == node::Kind::FP_FMA)
-      {
-        assert(d_internal->d_rm_map.find(cur[0]) != d_internal->d_rm_map.end());
-        assert(d_internal->d_unpacked_float_map.find(cur[1])
-               != d_internal->d_unpacked_float_map.end());
-        assert(d_internal->d_unpacked_float_map.find(cur[2])
-               != d_internal->d_unpacked_float_map.end());
-        assert(d_internal->d_unpacked_float_map.find(cur[3])
-               != d_internal->d_unpacked_float_map.end());
-        d_internal->d_unpacked_float_map.emplace(
-            cur,
-            symfpu::fma<SymFpuSymTraits>(
-                type,
-                d_internal->d_rm_map.at(cur[0]),
-                d_internal->d_unpacked_float_map.at(cur[1]),
-                d_internal->d_unpacked_float_map.at(cur[2]),
-                d_internal->d_unpacked_float_map.at(cur[3])));
-      }
       else if (kind == node::Kind::FP_TO_SBV || kind == node::Kind::FP_TO_UBV)
       {
         assert(d_internal->d_rm_map.find(cur[0]) != d_internal->d_rm_map.end());
@@ -591,41 +639,6 @@ WordBlaster::_word_blast(const Node& node)
             cur,
             symfpu::unpack<SymFpuSymTraits>(type, SymFpuSymBV<false>(cur[0])));
       }
-      else if (kind == node::Kind::FP_TO_FP_FROM_FP)
-      {
-        assert(d_internal->d_rm_map.find(cur[0]) != d_internal->d_rm_map.end());
-        assert(d_internal->d_unpacked_float_map.find(cur[1])
-               != d_internal->d_unpacked_float_map.end());
-        d_internal->d_unpacked_float_map.emplace(
-            cur,
-            symfpu::convertFloatToFloat<SymFpuSymTraits>(
-                cur[1].type(),
-                type,
-                d_internal->d_rm_map.at(cur[0]),
-                d_internal->d_unpacked_float_map.at(cur[1])));
-      }
-      else if (kind == node::Kind::FP_TO_FP_FROM_SBV)
-      {
-        assert(d_internal->d_rm_map.find(cur[0]) != d_internal->d_rm_map.end());
-        assert(cur[1].type().is_bv());
-        d_internal->d_unpacked_float_map.emplace(
-            cur,
-            symfpu::convertSBVToFloat<SymFpuSymTraits>(
-                type,
-                d_internal->d_rm_map.at(cur[0]),
-                SymFpuSymBV<true>(cur[1])));
-      }
-      else if (kind == node::Kind::FP_TO_FP_FROM_UBV)
-      {
-        assert(d_internal->d_rm_map.find(cur[0]) != d_internal->d_rm_map.end());
-        assert(cur[1].type().is_bv());
-        d_internal->d_unpacked_float_map.emplace(
-            cur,
-            symfpu::convertUBVToFloat<SymFpuSymTraits>(
-                type,
-                d_internal->d_rm_map.at(cur[0]),
-                SymFpuSymBV<false>(cur[1])));
-      }
       visited.at(cur) = 1;
     }
     else
@@ -668,6 +681,422 @@ WordBlaster::_word_blast(const Node& node)
   return res;
 }
 
+void
+WordBlaster::mk_unpacked_var(const Node& node)
+{
+  NodeManager& nm  = d_env.nm();
+  const Type& type = node.type();
+
+  Node inf =
+      nm.mk_const(nm.mk_bv_type(1), create_component_symbol(node, "inf"));
+  Node nan =
+      nm.mk_const(nm.mk_bv_type(1), create_component_symbol(node, "nan"));
+  Node sign =
+      nm.mk_const(nm.mk_bv_type(1), create_component_symbol(node, "sign"));
+  Node zero =
+      nm.mk_const(nm.mk_bv_type(1), create_component_symbol(node, "zero"));
+  Node exp = nm.mk_const(nm.mk_bv_type(SymUnpackedFloat::exponentWidth(type)),
+                         create_component_symbol(node, "exp"));
+  Node sig =
+      nm.mk_const(nm.mk_bv_type(SymUnpackedFloat::significandWidth(type)),
+                  create_component_symbol(node, "sig"));
+
+  SymUnpackedFloat uf(nan, inf, zero, sign, exp, sig);
+  d_internal->d_unpacked_float_map.emplace(node, uf);
+  d_solver_state.lemma(node::utils::bv1_to_bool(nm, uf.valid(type).getNode()));
+}
+
+void
+WordBlaster::abstract(const Node& node)
+{
+  assert(is_abstraction_kind(node.kind()));
+
+  NodeManager& nm = d_env.nm();
+  node::Kind kind = node.kind();
+
+  mk_unpacked_var(node);
+  d_abstracted.insert(node);
+  ++d_stats.num_abstractions;
+
+  auto nan = [&nm](const SymUnpackedFloat& uf) {
+    return node::utils::bv1_to_bool(nm, uf.getNaN().getNode());
+  };
+  auto inf = [&nm](const SymUnpackedFloat& uf) {
+    return node::utils::bv1_to_bool(nm, uf.getInf().getNode());
+  };
+  auto zero = [&nm](const SymUnpackedFloat& uf) {
+    return node::utils::bv1_to_bool(nm, uf.getZero().getNode());
+  };
+  auto neg = [&nm](const SymUnpackedFloat& uf) {
+    return node::utils::bv1_to_bool(nm, uf.getSign().getNode());
+  };
+  auto mk_and = [&nm](const Node& a, const Node& b) {
+    return nm.mk_node(node::Kind::AND, {a, b});
+  };
+  auto mk_or = [&nm](const Node& a, const Node& b) {
+    return nm.mk_node(node::Kind::OR, {a, b});
+  };
+  auto mk_not = [&nm](const Node& a) {
+    return nm.mk_node(node::Kind::NOT, {a});
+  };
+  auto mk_implies = [&nm](const Node& a, const Node& b) {
+    return nm.mk_node(node::Kind::IMPLIES, {a, b});
+  };
+  auto mk_equal = [&nm](const Node& a, const Node& b) {
+    return nm.mk_node(node::Kind::EQUAL, {a, b});
+  };
+
+  // Cheap constraints on special values and signs that hold for the
+  // concrete semantics of the operation.
+  const SymUnpackedFloat& r = d_internal->d_unpacked_float_map.at(node);
+  std::vector<Node> lemmas;
+  if (kind == node::Kind::FP_MUL || kind == node::Kind::FP_DIV)
+  {
+    const SymUnpackedFloat& x = d_internal->d_unpacked_float_map.at(node[1]);
+    const SymUnpackedFloat& y = d_internal->d_unpacked_float_map.at(node[2]);
+    Node invalid;
+    if (kind == node::Kind::FP_MUL)
+    {
+      invalid = mk_or(mk_and(zero(x), inf(y)), mk_and(inf(x), zero(y)));
+    }
+    else
+    {
+      invalid = mk_or(mk_and(zero(x), zero(y)), mk_and(inf(x), inf(y)));
+    }
+    Node res_nan = mk_or(mk_or(nan(x), nan(y)), invalid);
+    Node not_nan = mk_not(nan(r));
+    lemmas.push_back(mk_equal(nan(r), res_nan));
+    lemmas.push_back(mk_implies(
+        not_nan,
+        mk_equal(neg(r), nm.mk_node(node::Kind::XOR, {neg(x), neg(y)}))));
+    if (kind == node::Kind::FP_MUL)
+    {
+      lemmas.push_back(
+          mk_implies(mk_and(not_nan, mk_or(inf(x), inf(y))), inf(r)));
+      lemmas.push_back(
+          mk_implies(mk_and(not_nan, mk_or(zero(x), zero(y))), zero(r)));
+    }
+    else
+    {
+      lemmas.push_back(
+          mk_implies(mk_and(not_nan, mk_or(inf(x), zero(y))), inf(r)));
+      lemmas.push_back(
+          mk_implies(mk_and(not_nan, mk_or(zero(x), inf(y))), zero(r)));
+    }
+  }
+  else if (kind == node::Kind::FP_FMA)
+  {
+    const SymUnpackedFloat& x = d_internal->d_unpacked_float_map.at(node[1]);
+    const SymUnpackedFloat& y = d_internal->d_unpacked_float_map.at(node[2]);
+    const SymUnpackedFloat& z = d_internal->d_unpacked_float_map.at(node[3]);
+    lemmas.push_back(mk_implies(
+        mk_or(mk_or(mk_or(nan(x), nan(y)), nan(z)),
+              mk_or(mk_and(zero(x), inf(y)), mk_and(inf(x), zero(y)))),
+        nan(r)));
+  }
+  else if (kind == node::Kind::FP_SQRT)
+  {
+    const SymUnpackedFloat& x = d_internal->d_unpacked_float_map.at(node[1]);
+    lemmas.push_back(
+        mk_equal(nan(r), mk_or(nan(x), mk_and(neg(x), mk_not(zero(x))))));
+    lemmas.push_back(
+        mk_implies(zero(x), mk_and(zero(r), mk_equal(neg(r), neg(x)))));
+    lemmas.push_back(mk_implies(mk_and(inf(x), mk_not(neg(x))),
+                                mk_and(inf(r), mk_not(neg(r)))));
+    lemmas.push_back(
+        mk_implies(mk_and(mk_not(nan(x)), mk_not(neg(x))), mk_not(neg(r))));
+    lemmas.push_back(mk_implies(mk_not(zero(x)), mk_not(zero(r))));
+  }
+  else
+  {
+    assert(kind == node::Kind::FP_REM);
+    const SymUnpackedFloat& x = d_internal->d_unpacked_float_map.at(node[0]);
+    const SymUnpackedFloat& y = d_internal->d_unpacked_float_map.at(node[1]);
+    lemmas.push_back(mk_equal(
+        nan(r), mk_or(mk_or(nan(x), nan(y)), mk_or(inf(x), zero(y)))));
+    // rem(x, inf) = x for finite x, rem(0, y) = 0 with the sign of x
+    std::vector<Node> eq_x{
+        mk_equal(r.getNaN().getNode(), x.getNaN().getNode()),
+        mk_equal(r.getInf().getNode(), x.getInf().getNode()),
+        mk_equal(r.getZero().getNode(), x.getZero().getNode()),
+        mk_equal(r.getSign().getNode(), x.getSign().getNode()),
+        mk_equal(r.getExponent().getNode(), x.getExponent().getNode()),
+        mk_equal(r.getSignificand().getNode(), x.getSignificand().getNode())};
+    lemmas.push_back(
+        mk_implies(mk_and(mk_not(nan(r)), mk_or(inf(y), zero(x))),
+                   node::utils::mk_nary(nm, node::Kind::AND, eq_x)));
+  }
+  // Operands that are values may simplify lemmas to true, e.g., zero(x) for
+  // a constant operand x that is not zero.
+  std::unordered_set<Node> cache;
+  for (const Node& lemma : lemmas)
+  {
+    Node rewritten = d_env.rewriter().rewrite(lemma);
+    if (rewritten.is_value() && rewritten.value<bool>())
+    {
+      continue;
+    }
+    if (cache.insert(rewritten).second)
+    {
+      d_solver_state.lemma(lemma);
+    }
+  }
+}
+
+void
+WordBlaster::activate_abstractions(const Node& node)
+{
+  if (d_abstracted.empty())
+  {
+    return;
+  }
+  node::node_ref_vector visit{node};
+  do
+  {
+    const Node& cur = visit.back();
+    visit.pop_back();
+    if (d_abstractions_cache.insert(cur).second)
+    {
+      if (d_abstracted.find(cur) != d_abstracted.end())
+      {
+        d_abstractions.push_back(cur);
+      }
+      visit.insert(visit.end(), cur.begin(), cur.end());
+    }
+  } while (!visit.empty());
+}
+
+bool
+WordBlaster::is_refined(const Node& node) const
+{
+  return d_refined.find(node) != d_refined.end();
+}
+
+Node
+WordBlaster::refine(const Node& node)
+{
+  assert(is_abstraction_kind(node.kind()));
+  assert(!is_refined(node));
+  d_refined.insert(node);
+  ++d_stats.num_refinements;
+
+  std::vector<Node> c = instantiate_template(node);
+  SymUnpackedFloat full(c[0], c[1], c[2], c[3], c[4], c[5]);
+  const SymUnpackedFloat& abstr = d_internal->d_unpacked_float_map.at(node);
+  return d_env.nm().mk_node(
+      node::Kind::EQUAL,
+      {symfpu::pack(node.type(), abstr).getNode(),
+       symfpu::pack(node.type(), full).getNode()});
+}
+
+bool
+WordBlaster::fold(const Node& node)
+{
+  for (const Node& child : node)
+  {
+    if (!child.is_value())
+    {
+      return false;
+    }
+  }
+
+  std::vector<Node> values(node.begin(), node.end());
+  Node value =
+      Evaluator::evaluate(d_env.nm(), node.kind(), values, node.indices());
+  assert(value.is_value());
+  if (value.type().is_bool())
+  {
+    d_internal->d_prop_map.emplace(node, SymFpuSymProp(value.value<bool>()));
+  }
+  else
+  {
+    assert(value.type().is_fp());
+    d_internal->d_unpacked_float_map.emplace(
+        node, *value.value<FloatingPoint>().unpacked());
+  }
+  ++d_stats.num_folded;
+  return true;
+}
+
+std::vector<Node>
+WordBlaster::instantiate_template(const Node& node)
+{
+  assert(is_template_kind(node.kind()));
+
+  NodeManager& nm  = d_env.nm();
+  node::Kind kind  = node.kind();
+  const Type& type = node.type();
+
+  OpTemplateKey key{kind, type, {}, {}};
+  for (const Node& child : node)
+  {
+    key.d_types.push_back(child.type());
+    key.d_values.push_back(child.is_value() ? child : Node());
+  }
+
+  auto it = d_internal->d_templates.find(key);
+  if (it == d_internal->d_templates.end())
+  {
+    // Build template over placeholders for all non-value operands. Value
+    // operands are word-blasted into the template, which specializes the
+    // circuit for constant rounding modes and floating-point operands.
+    OpTemplate tpl;
+    std::vector<SymFpuSymRM> rms;
+    std::vector<SymUnpackedFloat> fps;
+    std::vector<Node> bvs;
+    for (const Node& child : node)
+    {
+      const Type& ctype = child.type();
+      if (ctype.is_rm())
+      {
+        assert(d_internal->d_rm_map.find(child) != d_internal->d_rm_map.end());
+        if (child.is_value())
+        {
+          rms.push_back(d_internal->d_rm_map.at(child));
+        }
+        else
+        {
+          Node rm = nm.mk_const(nm.mk_bv_type(BZLA_RM_BV_SIZE));
+          tpl.d_placeholders.push_back(rm);
+          rms.emplace_back(rm);
+        }
+      }
+      else if (ctype.is_fp())
+      {
+        assert(d_internal->d_unpacked_float_map.find(child)
+               != d_internal->d_unpacked_float_map.end());
+        if (child.is_value())
+        {
+          fps.push_back(d_internal->d_unpacked_float_map.at(child));
+        }
+        else
+        {
+          Type bv1  = nm.mk_bv_type(1);
+          Node nan  = nm.mk_const(bv1);
+          Node inf  = nm.mk_const(bv1);
+          Node zero = nm.mk_const(bv1);
+          Node sign = nm.mk_const(bv1);
+          Node exp  = nm.mk_const(
+              nm.mk_bv_type(SymUnpackedFloat::exponentWidth(ctype)));
+          Node sig  = nm.mk_const(
+              nm.mk_bv_type(SymUnpackedFloat::significandWidth(ctype)));
+          tpl.d_placeholders.insert(tpl.d_placeholders.end(),
+                                    {nan, inf, zero, sign, exp, sig});
+          fps.emplace_back(nan, inf, zero, sign, exp, sig);
+        }
+      }
+      else
+      {
+        assert(ctype.is_bv());
+        if (child.is_value())
+        {
+          bvs.push_back(child);
+        }
+        else
+        {
+          Node bv = nm.mk_const(ctype);
+          tpl.d_placeholders.push_back(bv);
+          bvs.push_back(bv);
+        }
+      }
+    }
+
+    std::optional<SymUnpackedFloat> res;
+    switch (kind)
+    {
+      case node::Kind::FP_ADD:
+        res.emplace(symfpu::add<SymFpuSymTraits>(
+            type, rms[0], fps[0], fps[1], SymFpuSymProp(true)));
+        break;
+      case node::Kind::FP_MUL:
+        res.emplace(
+            symfpu::multiply<SymFpuSymTraits>(type, rms[0], fps[0], fps[1]));
+        break;
+      case node::Kind::FP_DIV:
+        res.emplace(
+            symfpu::divide<SymFpuSymTraits>(type, rms[0], fps[0], fps[1]));
+        break;
+      case node::Kind::FP_FMA:
+        res.emplace(symfpu::fma<SymFpuSymTraits>(
+            type, rms[0], fps[0], fps[1], fps[2]));
+        break;
+      case node::Kind::FP_SQRT:
+        res.emplace(symfpu::sqrt<SymFpuSymTraits>(type, rms[0], fps[0]));
+        break;
+      case node::Kind::FP_RTI:
+        res.emplace(
+            symfpu::roundToIntegral<SymFpuSymTraits>(type, rms[0], fps[0]));
+        break;
+      case node::Kind::FP_REM:
+        res.emplace(
+            symfpu::remainder<SymFpuSymTraits>(type, fps[0], fps[1]));
+        break;
+      case node::Kind::FP_TO_FP_FROM_FP:
+        res.emplace(symfpu::convertFloatToFloat<SymFpuSymTraits>(
+            node[1].type(), type, rms[0], fps[0]));
+        break;
+      case node::Kind::FP_TO_FP_FROM_SBV:
+        res.emplace(symfpu::convertSBVToFloat<SymFpuSymTraits>(
+            type, rms[0], SymFpuSymBV<true>(bvs[0])));
+        break;
+      default:
+        assert(kind == node::Kind::FP_TO_FP_FROM_UBV);
+        res.emplace(symfpu::convertUBVToFloat<SymFpuSymTraits>(
+            type, rms[0], SymFpuSymBV<false>(bvs[0])));
+    }
+    tpl.d_components = {res->getNaN().getNode(),
+                        res->getInf().getNode(),
+                        res->getZero().getNode(),
+                        res->getSign().getNode(),
+                        res->getExponent().getNode(),
+                        res->getSignificand().getNode()};
+    it = d_internal->d_templates.emplace(std::move(key), std::move(tpl)).first;
+    ++d_stats.num_templates;
+  }
+
+  // Instantiate template with the word-blasted operands.
+  const OpTemplate& tpl = it->second;
+  std::unordered_map<Node, Node> substs;
+  size_t i = 0;
+  for (const Node& child : node)
+  {
+    if (child.is_value())
+    {
+      continue;
+    }
+    const Type& ctype = child.type();
+    if (ctype.is_rm())
+    {
+      substs.emplace(tpl.d_placeholders[i++],
+                     d_internal->d_rm_map.at(child).getNode());
+    }
+    else if (ctype.is_fp())
+    {
+      const SymUnpackedFloat& uf = d_internal->d_unpacked_float_map.at(child);
+      substs.emplace(tpl.d_placeholders[i++], uf.getNaN().getNode());
+      substs.emplace(tpl.d_placeholders[i++], uf.getInf().getNode());
+      substs.emplace(tpl.d_placeholders[i++], uf.getZero().getNode());
+      substs.emplace(tpl.d_placeholders[i++], uf.getSign().getNode());
+      substs.emplace(tpl.d_placeholders[i++], uf.getExponent().getNode());
+      substs.emplace(tpl.d_placeholders[i++], uf.getSignificand().getNode());
+    }
+    else
+    {
+      substs.emplace(tpl.d_placeholders[i++], child);
+    }
+  }
+  assert(i == tpl.d_placeholders.size());
+
+  std::unordered_map<Node, Node> cache;
+  std::vector<Node> components;
+  for (const Node& c : tpl.d_components)
+  {
+    components.push_back(substitute(nm, c, substs, cache));
+  }
+  ++d_stats.num_template_instances;
+  return components;
+}
+
 const Node&
 WordBlaster::min_max_uf(const Node& node)
 {
@@ -723,6 +1152,21 @@ WordBlaster::sbv_ubv_uf(const Node& node)
   return iit->second;
 }
 
+WordBlaster::Statistics::Statistics(util::Statistics& stats,
+                                   const std::string& prefix)
+    : num_folded(stats.new_stat<util::CounterStatistic>(prefix + "num_folded")),
+      num_templates(
+          stats.new_stat<util::CounterStatistic>(prefix + "num_templates")),
+      num_template_instances(
+          stats.new_stat<util::CounterStatistic>(
+              prefix + "num_template_instances")),
+      num_abstractions(
+          stats.new_stat<util::CounterStatistic>(prefix + "num_abstractions")),
+      num_refinements(
+          stats.new_stat<util::CounterStatistic>(prefix + "num_refinements"))
+{
+}
+
 /* -------------------------------------------------------------------------- */
 }  // namespace fp
 }  // namespace bzla
@@ -12,12 +12,16 @@
 #define BZLA_SOLVER_FP_WORD_BLASTER_H_INCLUDED
 
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
+#include "backtrack/unordered_set.h"
+#include "backtrack/vector.h"
 #include "env.h"
 #include "node/node.h"
 #include "node/node_ref_vector.h"
 #include "solver/fp/floating_point.h"
+#include "util/statistics.h"
 
 /* -------------------------------------------------------------------------- */
 
@@ -56,6 +60,43 @@ class WordBlaster
    */
   bool is_word_blasted(const Node& node) const;
 
+  /**
+   * Activate the abstracted operations in given (already word-blasted) term
+   * for the current scope.
+   *
+   * @note Word-blasting is cached across scopes, abstractions of terms that
+   *       were word-blasted in a popped scope are re-activated via this
+   *       function when the term is registered again.
+   *
+   * @param node The word-blasted term.
+   */
+  void activate_abstractions(const Node& node);
+
+  /**
+   * Get the floating-point operations that were abstracted instead of
+   * word-blasted if lazy floating-point abstraction is enabled, and that
+   * occur in terms registered in the current scope.
+   * @return The active abstracted operations.
+   */
+  const backtrack::vector<Node>& abstractions() const
+  {
+    return d_abstractions;
+  }
+
+  /**
+   * Determine whether the abstraction of given node was already refined.
+   * @param node The abstracted node.
+   */
+  bool is_refined(const Node& node) const;
+
+  /**
+   * Refine the abstraction of given node by word-blasting the operation.
+   * @param node The abstracted node.
+   * @return The refinement lemma, equates the abstraction with the
+   *         word-blasted operation.
+   */
+  Node refine(const Node& node);
+
  private:
   using SymUnpackedFloat = ::symfpu::unpackedFloat<SymFpuSymTraits>;
   using UnpackedFloatMap = std::unordered_map<Node, SymUnpackedFloat>;
@@ -74,6 +115,46 @@ class WordBlaster
    */
   Node _word_blast(const Node& node);
 
+  /**
+   * Word-level constant folding of floating-point operations with only value
+   * operands.
+   * @param node The node to fold.
+   * @return True if the node was folded.
+   */
+  bool fold(const Node& node);
+
+  /**
+   * Create fresh components for the unpacked float of a floating-point term
+   * and add its validity lemma.
+   * @param node The floating-point term.
+   */
+  void mk_unpacked_var(const Node& node);
+
+  /**
+   * Abstract given expensive floating-point operation by fresh components
+   * constrained by lemmas on special values and signs.
+   * @param node The operation to abstract.
+   */
+  void abstract(const Node& node);
+
+  /**
+   * Instantiate the circuit template for the operator of an expensive
+   * floating-point operation.
+   *
+   * Templates are built once per operator kind, type and value operands
+   * (constant rounding modes and floating-point values are specialized in the
+   * template) over placeholder components for all non-value operands, and
+   * instantiated by substituting the word-blasted operands for the
+   * placeholders.
+   *
+   * @note Templates are cached in `d_internal->d_templates`.
+   *
+   * @param node The node to word-blast.
+   * @return The nan, inf, zero, sign, exponent and significand components of
+   *         the resulting unpacked float.
+   */
+  std::vector<Node> instantiate_template(const Node& node);
+
   /**
    * Construct (if not already constructed) and get an UF of type
    * (bv_[n], ..., bv_[n]) ->bv_[1] to encode undefined values for a given
@@ -114,10 +195,29 @@ class WordBlaster
 
   std::vector<Node> d_additional_assertions;
 
+  /** All floating-point operations abstracted via abstract(). */
+  std::unordered_set<Node> d_abstracted;
+  /** The abstracted operations active in the current scope. */
+  backtrack::vector<Node> d_abstractions;
+  /** Terms visited by activate_abstractions() in the current scope. */
+  backtrack::unordered_set<Node> d_abstractions_cache;
+  /** The abstracted operations that were refined in the current scope. */
+  backtrack::unordered_set<Node> d_refined;
+
   /** The associated environment. */
   Env& d_env;
   /** The associated solver state. */
   SolverState& d_solver_state;
+
+  struct Statistics
+  {
+    Statistics(util::Statistics& stats, const std::string& prefix);
+    util::CounterStatistic& num_folded;
+    util::CounterStatistic& num_templates;
+    util::CounterStatistic& num_template_instances;
+    util::CounterStatistic& num_abstractions;
+    util::CounterStatistic& num_refinements;
+  } d_stats;
 };
 
 /* -------------------------------------------------------------------------- */
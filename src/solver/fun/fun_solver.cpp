@@ -14,6 +14,7 @@
 #include "node/node_manager.h"
 #include "node/node_utils.h"
 #include "util/logger.h"
+#include "util/trace.h"
 
 namespace bzla::fun {
 
@@ -54,6 +55,7 @@ FunSolver::~FunSolver() {}
 bool
 FunSolver::check()
 {
+  TraceScope("solver::fun::check");
   Log(1);
   Log(1) << "*** check functions";
 
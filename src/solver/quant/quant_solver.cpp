@@ -447,8 +447,9 @@ QuantSolver::mbqi_lemma(const Node& q)
 
 QuantSolver::Statistics::Statistics(util::Statistics& stats,
                                     const std::string& prefix)
-    : mbqi_checks(stats.new_stat<uint64_t>(prefix + "mbqi_checks")),
-      num_lemmas(stats.new_stat<uint64_t>(prefix + "num_lemmas")),
+    : mbqi_checks(
+          stats.new_stat<util::CounterStatistic>(prefix + "mbqi_checks")),
+      num_lemmas(stats.new_stat<util::CounterStatistic>(prefix + "num_lemmas")),
       lemmas(stats.new_stat<util::HistogramStatistic>(prefix + "lemmas")),
       time_check(stats.new_stat<util::TimerStatistic>(prefix + "time_check")),
       time_process(
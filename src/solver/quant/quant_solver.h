@@ -95,8 +95,8 @@ class QuantSolver : public Solver
   {
     Statistics(util::Statistics& stats, const std::string& prefix);
 
-    uint64_t& mbqi_checks;
-    uint64_t& num_lemmas;
+    util::CounterStatistic& mbqi_checks;
+    util::CounterStatistic& num_lemmas;
     util::HistogramStatistic& lemmas;
 
     util::TimerStatistic& time_check;
@@ -11,10 +11,12 @@
 #include "solver/solver_engine.h"
 
 #include "env.h"
+#include "node/node_utils.h"
 #include "printer/printer.h"
 #include "rewrite/evaluator.h"
 #include "solving_context.h"
 #include "util/resources.h"
+#include "util/trace.h"
 
 namespace bzla {
 
@@ -29,6 +31,7 @@ SolverEngine::SolverEngine(SolvingContext& context)
       d_register_assertion_cache(&d_backtrack_mgr),
       d_register_term_cache(&d_backtrack_mgr),
       d_lemma_cache(&d_backtrack_mgr),
+      d_min_lemma_cache(&d_backtrack_mgr),
       d_sat_state(Result::UNKNOWN),
       d_in_solving_mode(false),
       d_stats(context.env().statistics(), "solver::engine::"),
@@ -60,6 +63,9 @@ SolverEngine::solve()
   d_in_solving_mode = true;
   do
   {
+    TraceScope("solver_engine::round");
+    // Caches are not in use between rounds, release them if requested.
+    d_env.check_memory_pressure();
     // Reset model cache
     d_value_cache.clear();
     // Reset term registration flag
@@ -153,8 +159,9 @@ SolverEngine::lemma(const Node& lemma)
   // There can be duplicates if we add more than one lemma per round.
   if (inserted)
   {
-    ++d_stats.num_lemmas;
-    d_lemmas.push_back(rewritten);
+    // Queue the original lemma, minimize_lemma() expects the premise to be
+    // explicit.
+    d_lemmas.push_back(lemma);
   }
 }
 
@@ -313,11 +320,116 @@ SolverEngine::registered(const Node& term) const
 void
 SolverEngine::process_lemmas()
 {
+  if (d_lemmas.empty())
+  {
+    return;
+  }
+
+  // Minimize, rewrite and de-duplicate all lemmas of the current round first.
+  std::vector<Node> lemmas;
+  std::unordered_set<Node> cache;
   for (const Node& lemma : d_lemmas)
   {
-    process_assertion(lemma, true, true);
+    Node rewritten = d_env.rewriter().rewrite(minimize_lemma(lemma));
+    // Lemmas should never simplify to true
+    assert(!rewritten.is_value() || !rewritten.value<bool>());
+    // Lemmas of the current round may become identical after minimization.
+    if (!cache.insert(rewritten).second)
+    {
+      Log(2) << "duplicate lemma: " << rewritten;
+      ++d_stats.num_lemmas_duplicates;
+      continue;
+    }
+    // A minimized lemma is at least as strong as the original lemma, a lemma
+    // registered in a previous round can thus not be violated again.
+    auto [it, inserted] = d_min_lemma_cache.insert(rewritten);
+    assert(inserted);
+    if (inserted)
+    {
+      ++d_stats.num_lemmas;
+      lemmas.push_back(rewritten);
+    }
   }
   d_lemmas.clear();
+  assert(!lemmas.empty());
+
+  // Register batch of lemmas, the bit-vector solver encodes all of them at
+  // once in the next solve() call.
+  for (const Node& lemma : lemmas)
+  {
+    process_assertion(lemma, true, true);
+  }
+}
+
+Node
+SolverEngine::minimize_lemma(const Node& lemma)
+{
+  if (lemma.kind() != Kind::IMPLIES)
+  {
+    return lemma;
+  }
+
+  bool minimized = false;
+  std::vector<Node> premises;
+  std::unordered_set<Node> cache;
+  node_ref_vector visit{lemma[0]};
+  do
+  {
+    Node cur = visit.back();
+    visit.pop_back();
+
+    auto [it, inserted] = cache.insert(cur);
+    if (!inserted)
+    {
+      minimized = true;
+      continue;
+    }
+
+    if (cur.kind() == Kind::AND)
+    {
+      visit.push_back(cur[1]);
+      visit.push_back(cur[0]);
+    }
+    else if (is_implied(cur))
+    {
+      Log(3) << "drop implied premise: " << cur;
+      ++d_stats.num_lemmas_premises_dropped;
+      minimized = true;
+    }
+    else
+    {
+      premises.push_back(cur);
+    }
+  } while (!visit.empty());
+
+  if (!minimized)
+  {
+    return lemma;
+  }
+
+  if (premises.empty())
+  {
+    return lemma[1];
+  }
+  NodeManager& nm = d_env.nm();
+  return nm.mk_node(Kind::IMPLIES,
+                    {utils::mk_nary(nm, Kind::AND, premises), lemma[1]});
+}
+
+bool
+SolverEngine::is_implied(const Node& term)
+{
+  assert(term.type().is_bool());
+
+  if (term.is_value())
+  {
+    return term.value<bool>();
+  }
+  if (term.kind() == Kind::NOT)
+  {
+    return d_bv_solver.fixed(term[0]) < 0;
+  }
+  return d_bv_solver.fixed(term) > 0;
 }
 
 Node
@@ -756,11 +868,20 @@ SolverEngine::print_statistics()
 
 SolverEngine::Statistics::Statistics(util::Statistics& stats,
                                      const std::string& prefix)
-    : num_lemmas(stats.new_stat<uint64_t>(prefix + "lemmas")),
-      num_lemmas_array(stats.new_stat<uint64_t>(prefix + "lemmas_array")),
-      num_lemmas_fp(stats.new_stat<uint64_t>(prefix + "lemmas_fp")),
-      num_lemmas_fun(stats.new_stat<uint64_t>(prefix + "lemmas_fun")),
-      num_lemmas_quant(stats.new_stat<uint64_t>(prefix + "lemmas_quant")),
+    : num_lemmas(stats.new_stat<util::CounterStatistic>(prefix + "lemmas")),
+      num_lemmas_array(
+          stats.new_stat<util::CounterStatistic>(prefix + "lemmas_array")),
+      num_lemmas_fp(
+          stats.new_stat<util::CounterStatistic>(prefix + "lemmas_fp")),
+      num_lemmas_fun(
+          stats.new_stat<util::CounterStatistic>(prefix + "lemmas_fun")),
+      num_lemmas_quant(
+          stats.new_stat<util::CounterStatistic>(prefix + "lemmas_quant")),
+      num_lemmas_duplicates(
+          stats.new_stat<util::CounterStatistic>(prefix + "lemmas_duplicates")),
+      num_lemmas_premises_dropped(
+          stats.new_stat<util::CounterStatistic>(
+              prefix + "lemmas_premises_dropped")),
       time_register_term(
           stats.new_stat<util::TimerStatistic>(prefix + "time_register_term")),
       time_solve(stats.new_stat<util::TimerStatistic>(prefix + "time_solve"))
@@ -65,7 +65,9 @@ class SolverEngine
 
   /** Add a lemma.
    *
-   * @note: A solver is not allowed to send duplicate lemmas.
+   * @note: A solver is not allowed to send duplicate lemmas. Lemmas are
+   *        queued and processed in batches via process_lemmas() at the
+   *        beginning of the next solving round.
    */
   void lemma(const Node& lemma);
 
@@ -96,9 +98,38 @@ class SolverEngine
   /** Returns true if term was registered to the corresponding theory solver. */
   bool registered(const Node& term) const;
 
-  /** Process lemmas added via lemma(). */
+  /**
+   * Process lemmas added via lemma().
+   *
+   * All lemmas queued in the current round are first minimized via
+   * minimize_lemma(), rewritten and de-duplicated, and then registered as one
+   * batch to the theory solvers.
+   *
+   * @note Lemmas are violated by the current model and a minimized lemma is
+   *       at least as strong as the original lemma. Hence, each non-empty
+   *       batch contains at least one new lemma and refines the current
+   *       abstraction.
+   */
   void process_lemmas();
 
+  /**
+   * Minimize the premise of a lemma of the form `premise => conclusion`.
+   *
+   * Flattens the premise conjunction and removes duplicate conjuncts as well
+   * as conjuncts that are already implied by the top-level assertions and
+   * lemmas (i.e., fixed at the top level in the bit-vector solver).
+   *
+   * @param lemma The lemma to minimize.
+   * @return The minimized lemma.
+   */
+  Node minimize_lemma(const Node& lemma);
+
+  /**
+   * Determine if given Boolean term is implied by the top-level assertions
+   * and lemmas.
+   */
+  bool is_implied(const Node& term);
+
   /** Compute value for given term. */
   Node _value(const Node& term);
 
@@ -135,8 +166,10 @@ class SolverEngine
   std::vector<Node> d_lemmas;
   /** Indicates whether new terms were registered while solving. */
   bool d_new_terms_registered = false;
-  /** Lemma cache. */
+  /** Lemma cache, the rewritten lemmas as sent by the theory solvers. */
   backtrack::unordered_set<Node> d_lemma_cache;
+  /** Cache of minimized lemmas registered via process_lemmas(). */
+  backtrack::unordered_set<Node> d_min_lemma_cache;
 
   /** Result of latest solve() call. */
   Result d_sat_state;
@@ -152,11 +185,13 @@ class SolverEngine
   struct Statistics
   {
     Statistics(util::Statistics& stats, const std::string& prefix);
-    uint64_t& num_lemmas;
-    uint64_t& num_lemmas_array;
-    uint64_t& num_lemmas_fp;
-    uint64_t& num_lemmas_fun;
-    uint64_t& num_lemmas_quant;
+    util::CounterStatistic& num_lemmas;
+    util::CounterStatistic& num_lemmas_array;
+    util::CounterStatistic& num_lemmas_fp;
+    util::CounterStatistic& num_lemmas_fun;
+    util::CounterStatistic& num_lemmas_quant;
+    util::CounterStatistic& num_lemmas_duplicates;
+    util::CounterStatistic& num_lemmas_premises_dropped;
     util::TimerStatistic& time_register_term;
     util::TimerStatistic& time_solve;
   } d_stats;
@@ -10,11 +10,13 @@
 
 #include "solving_context.h"
 
+#include <algorithm>
 #include <cassert>
 
 #include "check/check_model.h"
 #include "check/check_unsat_core.h"
 #include "node/node_ref_vector.h"
+#include "node/node_utils.h"
 #include "node/unordered_node_ref_set.h"
 #include "resource_terminator.h"
 #include "solver/fp/symfpu_nm.h"  // Temporary for setting SymFpuNM
@@ -35,8 +37,10 @@ SolvingContext::SolvingContext(NodeManager& nm,
       d_original_assertions(&d_backtrack_mgr),
       d_preprocessor(*this),
       d_solver_engine(*this),
+      d_snapshot_rewriter(d_env, 1, "snapshot"),
       d_stats(d_env.statistics())
 {
+  d_env.register_memory_release([this]() { release_memory(); });
 }
 
 SolvingContext::~SolvingContext() {}
@@ -50,14 +54,31 @@ SolvingContext::solve()
 #ifndef NDEBUG
   check_no_free_variables();
 #endif
-  d_sat_state = preprocess();
-
-  if (d_sat_state == Result::UNKNOWN)
+  d_snapshot_ctx.reset();
+  // If the model snapshot still satisfies all assertions, we keep it and
+  // skip preprocessing and solving. New assertions are processed in the next
+  // call that cannot reuse the model.
+  bool reused =
+      d_has_model_snapshot && options().model_reuse() && reuse_model();
+  d_model_reused = reused;
+  if (reused)
   {
-    d_sat_state = d_solver_engine.solve();
+    ++d_stats.num_model_reuses;
+    d_sat_state = Result::SAT;
   }
+  else
+  {
+    d_sat_state = preprocess();
 
-  if (d_sat_state == Result::SAT
+    if (d_sat_state == Result::UNKNOWN)
+    {
+      d_sat_state = d_solver_engine.solve();
+    }
+  }
+
+  // Not required if the model was reused, snapshots are only taken for
+  // quantifier-free assertions.
+  if (!reused && d_sat_state == Result::SAT
       && (options().produce_models() || options().dbg_check_model()))
   {
     ensure_model();
@@ -78,6 +99,16 @@ SolvingContext::solve()
     Warn(!res) << "unsat core check failed";
   }
 
+  if (d_resource_terminator)
+  {
+    d_resource_terminator->stop();
+  }
+
+  if (!reused && d_sat_state == Result::SAT && options().model_reuse())
+  {
+    snapshot_model();
+  }
+
   d_stats.max_memory = util::maximum_memory_usage();
   return d_sat_state;
 }
@@ -113,19 +144,26 @@ SolvingContext::get_value(const Node& term)
 {
   assert(d_sat_state == Result::SAT);
   fp::SymFpuNM snm(d_env.nm());
-  try
+  if (d_model_reused)
   {
-    return d_solver_engine.value(d_preprocessor.process(term));
+    return compute_snapshot_value(term);
   }
-  catch (const ComputeValueException& e)
+  return compute_value(term);
+}
+
+std::vector<Node>
+SolvingContext::get_values(const std::vector<Node>& terms)
+{
+  assert(d_sat_state == Result::SAT);
+  fp::SymFpuNM snm(d_env.nm());
+  std::vector<Node> res;
+  res.reserve(terms.size());
+  for (const Node& term : terms)
   {
-    // This only happens if we encounter a quantifier that was not registered
-    // and therefore cannot we cannot determine its value without calling
-    // solve() again. We instead return the original term.
-    Log(2) << "encountered unregistered term while computing value: "
-           << e.node();
-    return term;
+    res.push_back(d_model_reused ? compute_snapshot_value(term)
+                                 : compute_value(term));
   }
+  return res;
 }
 
 std::vector<Node>
@@ -160,6 +198,10 @@ void
 SolvingContext::pop()
 {
   d_backtrack_mgr.pop();
+  // The model snapshot does not depend on the solvers and stays valid, but
+  // only the remaining prefix of the checked assertions is still satisfied.
+  d_num_model_assertions =
+      std::min(d_num_model_assertions, d_original_assertions.size());
 }
 
 const option::Options&
@@ -325,6 +367,213 @@ SolvingContext::ensure_model()
   }
 }
 
+void
+SolvingContext::snapshot_model()
+{
+  d_model_snapshot.clear();
+  d_has_model_snapshot = false;
+  d_num_model_assertions = 0;
+
+  std::unordered_set<Node> cache;
+  std::vector<Node> visit, consts;
+  for (const Node& assertion : d_original_assertions)
+  {
+    visit.push_back(assertion);
+    do
+    {
+      Node cur = visit.back();
+      visit.pop_back();
+      if (cache.insert(cur).second)
+      {
+        if (cur.kind() == Kind::FORALL || cur.kind() == Kind::EXISTS
+            || cur.kind() == Kind::LAMBDA)
+        {
+          return;
+        }
+        if (cur.is_const())
+        {
+          const Type& type = cur.type();
+          if (!type.is_bool() && !type.is_bv() && !type.is_fp()
+              && !type.is_rm())
+          {
+            return;
+          }
+          consts.push_back(cur);
+        }
+        visit.insert(visit.end(), cur.begin(), cur.end());
+      }
+    } while (!visit.empty());
+  }
+
+  for (const Node& c : consts)
+  {
+    Node value = compute_value(c);
+    assert(value.is_value());
+    d_model_snapshot.emplace(c, value);
+  }
+  d_has_model_snapshot   = true;
+  d_num_model_assertions = d_original_assertions.size();
+}
+
+bool
+SolvingContext::reuse_model()
+{
+  assert(d_has_model_snapshot);
+  assert(d_num_model_assertions <= d_original_assertions.size());
+  Node true_value = d_env.nm().mk_value(true);
+  for (size_t size = d_original_assertions.size();
+       d_num_model_assertions < size;
+       ++d_num_model_assertions)
+  {
+    const Node& assertion = d_original_assertions[d_num_model_assertions];
+    if (evaluate_snapshot(assertion) != true_value)
+    {
+      Log(1) << "model not reused, assertion not satisfied: " << assertion;
+      return false;
+    }
+  }
+  Log(1) << "reuse model";
+  return true;
+}
+
+Node
+SolvingContext::evaluate_snapshot(const Node& term)
+{
+  NodeManager& nm = d_env.nm();
+  std::unordered_map<Node, Node> cache;
+  std::vector<Node> visit{term};
+  do
+  {
+    const Node& cur = visit.back();
+    auto [it, inserted] = cache.emplace(cur, Node());
+    if (inserted)
+    {
+      auto its = d_model_snapshot.find(cur);
+      if (its != d_model_snapshot.end())
+      {
+        it->second = its->second;
+      }
+      else if (cur.is_const() || cur.is_value() || cur.num_children() == 0)
+      {
+        continue;
+      }
+      else
+      {
+        visit.insert(visit.end(), cur.begin(), cur.end());
+        continue;
+      }
+    }
+    else if (it->second.is_null())
+    {
+      if (cur.is_const())
+      {
+        const Type& type = cur.type();
+        if (type.is_bool() || type.is_bv() || type.is_fp() || type.is_rm())
+        {
+          it->second = utils::mk_default_value(nm, type);
+          d_model_snapshot.emplace(cur, it->second);
+        }
+        else
+        {
+          it->second = cur;
+        }
+      }
+      else if (cur.num_children() == 0)
+      {
+        it->second = cur;
+      }
+      else
+      {
+        std::vector<Node> children;
+        for (const Node& child : cur)
+        {
+          auto itc = cache.find(child);
+          assert(itc != cache.end());
+          assert(!itc->second.is_null());
+          children.push_back(itc->second);
+        }
+        it->second = d_snapshot_rewriter.mk_node(
+            cur.kind(), children, cur.indices());
+      }
+    }
+    visit.pop_back();
+  } while (!visit.empty());
+  return cache.at(term);
+}
+
+Node
+SolvingContext::compute_snapshot_value(const Node& term)
+{
+  assert(d_model_reused);
+  Node value = evaluate_snapshot(term);
+  if (value.is_value())
+  {
+    return value;
+  }
+
+  // Fall back to solving with all snapshot values fixed. The context is
+  // kept until the next solve() call to get consistent values.
+  NodeManager& nm = d_env.nm();
+  if (!d_snapshot_ctx)
+  {
+    option::Options opts;
+    opts.produce_models.set(true);
+    d_snapshot_ctx.reset(new SolvingContext(nm, opts, "snapshot"));
+    for (const Node& assertion : d_original_assertions)
+    {
+      d_snapshot_ctx->assert_formula(assertion);
+    }
+    for (const auto& [c, v] : d_model_snapshot)
+    {
+      d_snapshot_ctx->assert_formula(nm.mk_node(Kind::EQUAL, {c, v}));
+    }
+    [[maybe_unused]] Result res = d_snapshot_ctx->solve();
+    assert(res == Result::SAT);
+  }
+  value = d_snapshot_ctx->get_value(term);
+  // Record the values of new constants, the values of later queries that are
+  // evaluated under the snapshot must agree with them.
+  std::unordered_set<Node> cache;
+  std::vector<Node> visit{term};
+  do
+  {
+    Node cur = visit.back();
+    visit.pop_back();
+    if (cache.insert(cur).second)
+    {
+      if (cur.is_const())
+      {
+        const Type& type = cur.type();
+        if ((type.is_bool() || type.is_bv() || type.is_fp() || type.is_rm())
+            && d_model_snapshot.find(cur) == d_model_snapshot.end())
+        {
+          d_model_snapshot.emplace(cur, d_snapshot_ctx->get_value(cur));
+        }
+      }
+      visit.insert(visit.end(), cur.begin(), cur.end());
+    }
+  } while (!visit.empty());
+  return value;
+}
+
+Node
+SolvingContext::compute_value(const Node& term)
+{
+  try
+  {
+    return d_solver_engine.value(d_preprocessor.process(term));
+  }
+  catch (const ComputeValueException& e)
+  {
+    // This only happens if we encounter a quantifier that was not registered
+    // and therefore cannot we cannot determine its value without calling
+    // solve() again. We instead return the original term.
+    Log(2) << "encountered unregistered term while computing value: "
+           << e.node();
+    return term;
+  }
+}
+
 void
 SolvingContext::set_resource_limits()
 {
@@ -346,16 +595,37 @@ SolvingContext::set_resource_limits()
       d_resource_terminator->set_terminator(terminator);
       d_env.configure_terminator(d_resource_terminator.get());
     }
-    // Set resource limits.
+    // Set resource limits and start checking them.
     d_resource_terminator->set_time_limit(time_limit);
     d_resource_terminator->set_memory_limit(memory_limit);
+    d_resource_terminator->set_check_interval(
+        d_env.options().resource_check_interval());
+    d_resource_terminator->set_memory_pressure_callback(
+        [this]() { d_env.raise_memory_pressure(); });
+    d_resource_terminator->start();
   }
 }
 
+void
+SolvingContext::release_memory()
+{
+  Log(1) << "Memory usage exceeds soft limit, releasing caches";
+  ++d_stats.num_memory_releases;
+  d_snapshot_rewriter.clear_cache();
+}
+
 SolvingContext::Statistics::Statistics(util::Statistics& stats)
     : time_solve(
         stats.new_stat<util::TimerStatistic>("solving_context::time_solve")),
-      max_memory(stats.new_stat<uint64_t>("solving_context::max_memory")),
+      max_memory(
+          stats.new_stat<util::CounterStatistic>(
+              "solving_context::max_memory")),
+      num_memory_releases(
+          stats.new_stat<util::CounterStatistic>(
+              "solving_context::num_memory_releases")),
+      num_model_reuses(
+          stats.new_stat<util::CounterStatistic>(
+              "solving_context::num_model_reuses")),
       formula_kinds_pre(
           stats.new_stat<util::HistogramStatistic>("formula::pre::node")),
       formula_kinds_post(
@@ -11,6 +11,8 @@
 #ifndef BZLA_SOLVING_CONTEXT_H_INCLUDED
 #define BZLA_SOLVING_CONTEXT_H_INCLUDED
 
+#include <memory>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -53,6 +55,19 @@ class SolvingContext
    */
   Node get_value(const Node& term);
 
+  /**
+   * Get the values of `terms`.
+   *
+   * Equivalent to calling get_value() for each term, but shares the setup
+   * and the model value cache of the solver engine across all terms.
+   *
+   * @note: Only valid if last solve() call returned Result::SAT.
+   *
+   * @param terms The terms to compute the values for.
+   * @return The values of `terms` in the current model.
+   */
+  std::vector<Node> get_values(const std::vector<Node>& terms);
+
   /** @return Unsat core of previous check_sat() call. */
   std::vector<Node> get_unsat_core();
   // bool is_in_unsat_core(const Node& term) const;
@@ -88,9 +103,61 @@ class SolvingContext
 
   void ensure_model();
 
+  /**
+   * Record the values of the constants in the original assertions after a
+   * satisfiable solve() call in the model snapshot.
+   *
+   * @note No snapshot is taken if the assertions contain quantifiers or
+   *       constants of array, function or uninterpreted sort.
+   */
+  void snapshot_model();
+
+  /**
+   * Determine whether the original assertions that were not yet checked
+   * against the model snapshot are satisfied by it.
+   * @return True if the model snapshot can be reused.
+   */
+  bool reuse_model();
+
+  /**
+   * Evaluate given term under the model snapshot by substituting the recorded
+   * values and rewriting. Constants that do not occur in the snapshot are
+   * unconstrained by the assertions checked so far, they are assigned a
+   * default value which is then recorded in the snapshot.
+   * @param term The term to evaluate.
+   * @return The value of `term`, or a non-value term if it cannot be
+   *         evaluated by rewriting.
+   */
+  Node evaluate_snapshot(const Node& term);
+
+  /**
+   * Helper for get_value() and get_values() if the model snapshot was reused
+   * in the last solve() call, expects a SymFpuNM to be in scope.
+   *
+   * Terms that cannot be evaluated under the snapshot (e.g., underspecified
+   * floating-point operators, arrays, functions) are evaluated in a separate
+   * solving context with all recorded snapshot values fixed.
+   */
+  Node compute_snapshot_value(const Node& term);
+
+  /**
+   * Helper for get_value() and get_values() to compute the value of given
+   * term, expects a SymFpuNM to be in scope.
+   */
+  Node compute_value(const Node& term);
+
   /** Set resource terminator. */
   void set_resource_limits();
 
+  /**
+   * Release reclaimable memory of this solving context under memory
+   * pressure, i.e., the cache of the model snapshot rewriter.
+   *
+   * @note The rewriter and preprocessing pass caches are released by the
+   *       preprocessor, which registers itself with the environment.
+   */
+  void release_memory();
+
   /** Solving context environment. */
   Env d_env;
   /** Logger instance. */
@@ -114,6 +181,31 @@ class SolvingContext
   /** Result of last solve() call. */
   Result d_sat_state = Result::UNKNOWN;
 
+  /** Rewriter used to evaluate terms under the model snapshot. */
+  Rewriter d_snapshot_rewriter;
+  /**
+   * Values of the constants in the original assertions of the last
+   * satisfiable solve() call (plus values assigned by evaluate_snapshot()).
+   * The snapshot does not depend on the state of the solvers and stays valid
+   * across pop(): entries are only added, never changed, until the next
+   * satisfiable solve() call replaces the snapshot.
+   */
+  std::unordered_map<Node, Node> d_model_snapshot;
+  /** True if d_model_snapshot holds a model snapshot. */
+  bool d_has_model_snapshot = false;
+  /**
+   * The number of original assertions (a prefix of d_original_assertions)
+   * known to be satisfied by the model snapshot.
+   */
+  size_t d_num_model_assertions = 0;
+  /** True if the last solve() call returned sat by reusing the snapshot. */
+  bool d_model_reused = false;
+  /**
+   * Solving context with the snapshot values fixed, for terms that
+   * compute_snapshot_value() cannot evaluate under the snapshot.
+   */
+  std::unique_ptr<SolvingContext> d_snapshot_ctx;
+
   /** Terminator used for timeout per solve() call. */
   std::unique_ptr<ResourceTerminator> d_resource_terminator;
 
@@ -121,7 +213,9 @@ class SolvingContext
   {
     Statistics(util::Statistics& stats);
     util::TimerStatistic& time_solve;
-    uint64_t& max_memory;
+    util::CounterStatistic& max_memory;
+    util::CounterStatistic& num_memory_releases;
+    util::CounterStatistic& num_model_reuses;
     util::HistogramStatistic& formula_kinds_pre;
     util::HistogramStatistic& formula_kinds_post;
   } d_stats;
@@ -10,46 +10,227 @@
 
 #include "util/statistics.h"
 
+#include <cctype>
+#include <iomanip>
 #include <iostream>
 
+#include "util/trace.h"
+
 namespace bzla::util {
 
-/* --- TimerStatistic public ------------------------------------------------ */
+namespace {
 
-TimerStatistic::TimerStatistic() : d_elapsed(0), d_running(false) {}
+/** Print given string as JSON string literal. */
+void
+print_json_string(std::ostream& out, const std::string& str)
+{
+  out << '"';
+  for (char c : str)
+  {
+    switch (c)
+    {
+      case '"': out << "\\\""; break;
+      case '\\': out << "\\\\"; break;
+      case '\n': out << "\\n"; break;
+      case '\t': out << "\\t"; break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20)
+        {
+          out << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+              << static_cast<int>(c) << std::dec << std::setfill(' ');
+        }
+        else
+        {
+          out << c;
+        }
+    }
+  }
+  out << '"';
+}
+
+/**
+ * @return The Prometheus metric name of given statistic. Sequences of
+ *         characters that are not allowed in metric names (e.g., '::') are
+ *         replaced by a single '_'.
+ */
+std::string
+prometheus_name(const std::string& prefix, const std::string& name)
+{
+  std::string res = prefix.empty() ? "" : prefix + "_";
+  for (char c : name)
+  {
+    if (!std::isalnum(static_cast<unsigned char>(c)))
+    {
+      c = '_';
+    }
+    if (c != '_' || res.empty() || res.back() != '_')
+    {
+      res.push_back(c);
+    }
+  }
+  return res;
+}
+
+/** Print given string as Prometheus label value. */
+void
+print_prometheus_label(std::ostream& out, const std::string& str)
+{
+  out << '"';
+  for (char c : str)
+  {
+    switch (c)
+    {
+      case '"': out << "\\\""; break;
+      case '\\': out << "\\\\"; break;
+      case '\n': out << "\\n"; break;
+      default: out << c;
+    }
+  }
+  out << '"';
+}
+
+}  // namespace
+
+/* --- StatisticsSnapshot public -------------------------------------------- */
+
+void
+StatisticsSnapshot::print_json(std::ostream& out) const
+{
+  auto print_map = [&out](const std::map<std::string, uint64_t>& map) {
+    out << "{";
+    bool first = true;
+    for (const auto& [name, val] : map)
+    {
+      out << (first ? "" : ",");
+      print_json_string(out, name);
+      out << ":" << val;
+      first = false;
+    }
+    out << "}";
+  };
+
+  out << "{\"counters\":";
+  print_map(counters);
+  out << ",\"timers_ms\":";
+  print_map(timers);
+  out << ",\"histograms\":{";
+  bool first = true;
+  for (const auto& [name, values] : histograms)
+  {
+    out << (first ? "" : ",");
+    print_json_string(out, name);
+    out << ":";
+    print_map(values);
+    first = false;
+  }
+  out << "}}" << std::endl;
+}
+
+void
+StatisticsSnapshot::print_prometheus(std::ostream& out,
+                                     const std::string& prefix) const
+{
+  for (const auto& [name, val] : counters)
+  {
+    std::string pname = prometheus_name(prefix, name);
+    out << "# TYPE " << pname << " gauge" << std::endl;
+    out << pname << " " << val << std::endl;
+  }
+  for (const auto& [name, val] : timers)
+  {
+    std::string pname = prometheus_name(prefix, name) + "_seconds";
+    out << "# TYPE " << pname << " counter" << std::endl;
+    out << pname << " " << val / 1000 << "." << std::setw(3)
+        << std::setfill('0') << val % 1000 << std::setfill(' ') << std::endl;
+  }
+  for (const auto& [name, values] : histograms)
+  {
+    std::string pname = prometheus_name(prefix, name);
+    out << "# TYPE " << pname << " counter" << std::endl;
+    for (const auto& [key, val] : values)
+    {
+      out << pname << "{value=";
+      print_prometheus_label(out, key);
+      out << "} " << val << std::endl;
+    }
+  }
+}
+
+/* --- HistogramStatistic public -------------------------------------------- */
+
+std::vector<uint64_t>
+HistogramStatistic::values() const
+{
+  return std::vector<uint64_t>(d_values.begin(), d_values.end());
+}
+
+/* --- TimerStatistic public ------------------------------------------------ */
 
 uint64_t
 TimerStatistic::elapsed() const
 {
-  auto elapsed = d_elapsed;
-  if (d_running)
+  clock::rep elapsed, start;
+  bool running;
+  uint64_t seq;
+  do
   {
-    elapsed += std::chrono::steady_clock::now() - d_start;
+    seq     = d_seq.load(std::memory_order_acquire);
+    elapsed = d_elapsed.load(std::memory_order_relaxed);
+    start   = d_start.load(std::memory_order_relaxed);
+    running = d_running.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+  } while ((seq & 1) || seq != d_seq.load(std::memory_order_relaxed));
+
+  clock::duration res(elapsed);
+  if (running)
+  {
+    res += clock::now().time_since_epoch() - clock::duration(start);
   }
   return static_cast<uint64_t>(
-      std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count());
+      std::chrono::duration_cast<std::chrono::milliseconds>(res).count());
 }
 
 void
 TimerStatistic::start()
 {
-  assert(!d_running);
-  d_start   = std::chrono::steady_clock::now();
-  d_running = true;
+  assert(!running());
+  uint64_t seq = d_seq.load(std::memory_order_relaxed);
+  d_seq.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  d_start.store(clock::now().time_since_epoch().count(),
+                std::memory_order_relaxed);
+  d_running.store(true, std::memory_order_relaxed);
+  d_seq.store(seq + 2, std::memory_order_release);
 }
 
 void
 TimerStatistic::stop()
 {
-  assert(d_running);
-  d_elapsed += std::chrono::steady_clock::now() - d_start;
-  d_running = false;
+  assert(running());
+  clock::rep elapsed = d_elapsed.load(std::memory_order_relaxed)
+                       + clock::now().time_since_epoch().count()
+                       - d_start.load(std::memory_order_relaxed);
+  uint64_t seq = d_seq.load(std::memory_order_relaxed);
+  d_seq.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  d_elapsed.store(elapsed, std::memory_order_relaxed);
+  d_running.store(false, std::memory_order_relaxed);
+  d_seq.store(seq + 2, std::memory_order_release);
 }
 
 bool
 TimerStatistic::running() const
 {
-  return d_running;
+  return d_running.load(std::memory_order_relaxed);
+}
+
+/* --- TimerStatistic private ----------------------------------------------- */
+
+TimerStatistic::clock::time_point
+TimerStatistic::start_time() const
+{
+  return clock::time_point(
+      clock::duration(d_start.load(std::memory_order_relaxed)));
 }
 
 /* --- Timer public --------------------------------------------------------- */
@@ -66,6 +247,13 @@ Timer::~Timer()
 {
   if (d_stat.running())
   {
+#ifdef BZLA_USE_TRACE
+    if (d_stat.d_name != nullptr)
+    {
+      Tracer::get().add(
+          *d_stat.d_name, d_stat.start_time(), TimerStatistic::clock::now());
+    }
+#endif
     d_stat.stop();
   }
 }
@@ -75,11 +263,14 @@ Timer::~Timer()
 void
 Statistics::print() const
 {
+  std::lock_guard<std::mutex> lock(d_mutex);
   for (auto& [name, val] : d_stats)
   {
-    if (std::holds_alternative<uint64_t>(val))
+    if (std::holds_alternative<CounterStatistic>(val))
     {
-      std::cout << name << ": " << std::get<uint64_t>(val) << std::endl;
+      std::cout << name << ": "
+                << static_cast<uint64_t>(std::get<CounterStatistic>(val))
+                << std::endl;
     }
     else if (std::holds_alternative<TimerStatistic>(val))
     {
@@ -90,12 +281,13 @@ Statistics::print() const
     {
       assert(std::holds_alternative<HistogramStatistic>(val));
       auto& histo = std::get<HistogramStatistic>(val);
-      for (size_t i = 0, size = histo.values().size(); i < size; ++i)
+      auto values = histo.values();
+      for (size_t i = 0, size = values.size(); i < size; ++i)
       {
-        if (histo.values()[i] > 0)
+        if (values[i] > 0)
         {
           std::cout << name << "::" << histo.names()[i] << ": "
-                    << histo.values()[i] << std::endl;
+                    << values[i] << std::endl;
         }
       }
     }
@@ -105,12 +297,15 @@ Statistics::print() const
 std::map<std::string, std::string>
 Statistics::get() const
 {
+  std::lock_guard<std::mutex> lock(d_mutex);
   std::map<std::string, std::string> res;
   for (auto& [name, val] : d_stats)
   {
-    if (std::holds_alternative<uint64_t>(val))
+    if (std::holds_alternative<CounterStatistic>(val))
     {
-      res.emplace(name, std::to_string(std::get<uint64_t>(val)));
+      res.emplace(name,
+                  std::to_string(
+                      static_cast<uint64_t>(std::get<CounterStatistic>(val))));
     }
     else if (std::holds_alternative<TimerStatistic>(val))
     {
@@ -121,12 +316,46 @@ Statistics::get() const
     {
       assert(std::holds_alternative<HistogramStatistic>(val));
       auto& histo = std::get<HistogramStatistic>(val);
-      for (size_t i = 0, size = histo.values().size(); i < size; ++i)
+      auto values = histo.values();
+      for (size_t i = 0, size = values.size(); i < size; ++i)
       {
-        if (histo.values()[i] > 0)
+        if (values[i] > 0)
         {
           res.emplace(name + "::" + histo.names()[i],
-                      std::to_string(histo.values()[i]));
+                      std::to_string(values[i]));
+        }
+      }
+    }
+  }
+  return res;
+}
+
+StatisticsSnapshot
+Statistics::snapshot() const
+{
+  std::lock_guard<std::mutex> lock(d_mutex);
+  StatisticsSnapshot res;
+  for (auto& [name, val] : d_stats)
+  {
+    if (std::holds_alternative<CounterStatistic>(val))
+    {
+      res.counters.emplace(name, std::get<CounterStatistic>(val));
+    }
+    else if (std::holds_alternative<TimerStatistic>(val))
+    {
+      res.timers.emplace(name, std::get<TimerStatistic>(val).elapsed());
+    }
+    else
+    {
+      assert(std::holds_alternative<HistogramStatistic>(val));
+      auto& histo  = std::get<HistogramStatistic>(val);
+      auto values  = histo.values();
+      auto& counts = res.histograms[name];
+      for (size_t i = 0, size = values.size(); i < size; ++i)
+      {
+        if (values[i] > 0)
+        {
+          counts.emplace(histo.names()[i], values[i]);
         }
       }
     }
@@ -11,12 +11,17 @@
 #ifndef BZLA_UTIL_STATISTICS_INCLUDED
 #define BZLA_UTIL_STATISTICS_INCLUDED
 
+#include <atomic>
 #include <cassert>
 #include <chrono>
+#include <deque>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <tuple>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 #include <variant>
@@ -24,22 +29,76 @@
 
 namespace bzla::util {
 
+/**
+ * Statistic to count events.
+ *
+ * Counters are only updated by the solving thread, but may be read
+ * concurrently via Statistics::snapshot(). Updates are thus relaxed atomic
+ * loads and stores rather than read-modify-write operations.
+ */
+class CounterStatistic
+{
+ public:
+  CounterStatistic() = default;
+  CounterStatistic(const CounterStatistic&)            = delete;
+  CounterStatistic& operator=(const CounterStatistic&) = delete;
+
+  /** @return The current value. */
+  operator uint64_t() const { return d_value.load(std::memory_order_relaxed); }
+
+  CounterStatistic& operator=(uint64_t val)
+  {
+    d_value.store(val, std::memory_order_relaxed);
+    return *this;
+  }
+  CounterStatistic& operator+=(uint64_t val)
+  {
+    d_value.store(d_value.load(std::memory_order_relaxed) + val,
+                  std::memory_order_relaxed);
+    return *this;
+  }
+  CounterStatistic& operator-=(uint64_t val)
+  {
+    d_value.store(d_value.load(std::memory_order_relaxed) - val,
+                  std::memory_order_relaxed);
+    return *this;
+  }
+  CounterStatistic& operator++() { return *this += 1; }
+  uint64_t operator++(int)
+  {
+    uint64_t res = *this;
+    *this += 1;
+    return res;
+  }
+
+ private:
+  std::atomic<uint64_t> d_value{0};
+};
+
 /** Statistic to count enum types. */
 class HistogramStatistic
 {
+  friend class Statistics;
+
  public:
   /** Increment counter for val. */
   template <typename T>
   void operator<<(const T& val)
   {
     size_t index = static_cast<size_t>(val);
-    if (index >= d_values.size())
-    {
-      d_values.resize(index + 1);
-      d_names.resize(index + 1);
-    }
-    if (d_names[index].empty())
+    if (index >= d_values.size() || d_names[index].empty())
     {
+      // Guard growth against concurrent Statistics::snapshot() calls.
+      std::unique_lock<std::mutex> lock;
+      if (d_mutex)
+      {
+        lock = std::unique_lock<std::mutex>(*d_mutex);
+      }
+      while (index >= d_values.size())
+      {
+        d_values.emplace_back();
+        d_names.emplace_back();
+      }
       std::stringstream ss;
       ss << val;
       d_names[index] = ss.str();
@@ -57,26 +116,39 @@ class HistogramStatistic
     }
   }
 
-  /** @return Stored counters for values. */
-  const std::vector<uint64_t>& values() const { return d_values; }
+  /** @return Copy of stored counters for values. */
+  std::vector<uint64_t> values() const;
 
   /** @return: Stored names for values. */
-  const std::vector<std::string>& names() const { return d_names; }
+  const std::deque<std::string>& names() const { return d_names; }
 
  private:
-  /** Stores counters for values added via operator<<. */
-  std::vector<uint64_t> d_values;
+  /**
+   * Stores counters for values added via operator<<. Elements of a deque
+   * are not relocated on growth, counters can thus be updated without
+   * holding the lock.
+   */
+  std::deque<CounterStatistic> d_values;
   /** Stores names for values added via operator<<. */
-  std::vector<std::string> d_names;
+  std::deque<std::string> d_names;
+  /** The mutex of the owning Statistics instance, if any. */
+  std::mutex* d_mutex = nullptr;
 };
 
-/** Statistic to compute elapsed time in code. */
+/**
+ * Statistic to compute elapsed time in code.
+ *
+ * Timers are only started and stopped by the solving thread. Start and stop
+ * are published via a sequence lock, elapsed() may thus be called
+ * concurrently via Statistics::snapshot().
+ */
 class TimerStatistic
 {
  public:
+  friend class Statistics;
   friend class Timer;
 
-  TimerStatistic();
+  TimerStatistic() = default;
 
   /** @return Cumulative elapsed milliseconds. */
   uint64_t elapsed() const;
@@ -91,9 +163,20 @@ class TimerStatistic
   bool running() const;
 
  private:
-  std::chrono::steady_clock::duration d_elapsed;
-  std::chrono::steady_clock::time_point d_start;
-  bool d_running;
+  using clock = std::chrono::steady_clock;
+
+  /** @return The time point the timer was started at. */
+  clock::time_point start_time() const;
+
+  /** Sequence number, odd while start() or stop() update the timer. */
+  std::atomic<uint64_t> d_seq{0};
+  /** Cumulative elapsed ticks of stopped intervals. */
+  std::atomic<clock::rep> d_elapsed{0};
+  /** Ticks since epoch at the start of the current interval. */
+  std::atomic<clock::rep> d_start{0};
+  std::atomic<bool> d_running{false};
+  /** The name of the statistic if registered, used as trace span name. */
+  const std::string* d_name = nullptr;
 };
 
 /**
@@ -110,6 +193,27 @@ class Timer
   TimerStatistic& d_stat;
 };
 
+/** Typed copy of all statistics, created via Statistics::snapshot(). */
+struct StatisticsSnapshot
+{
+  /** Maps names of counter statistics to their value. */
+  std::map<std::string, uint64_t> counters;
+  /** Maps names of timer statistics to their elapsed milliseconds. */
+  std::map<std::string, uint64_t> timers;
+  /** Maps names of histogram statistics to their non-zero counters. */
+  std::map<std::string, std::map<std::string, uint64_t>> histograms;
+
+  /** Print snapshot in JSON format. */
+  void print_json(std::ostream& out) const;
+  /**
+   * Print snapshot in Prometheus text exposition format.
+   * @param out    The output stream.
+   * @param prefix The prefix of all metric names.
+   */
+  void print_prometheus(std::ostream& out,
+                        const std::string& prefix = "bitwuzla") const;
+};
+
 class Statistics
 {
  public:
@@ -117,21 +221,49 @@ class Statistics
   template <typename T>
   T& new_stat(const std::string& name)
   {
+    std::lock_guard<std::mutex> lock(d_mutex);
     assert(d_stats.find(name) == d_stats.end());
-    auto [it, inserted] = d_stats.emplace(name, T());
+    auto [it, inserted] =
+        d_stats.emplace(std::piecewise_construct,
+                        std::forward_as_tuple(name),
+                        std::forward_as_tuple(std::in_place_type<T>));
     assert(inserted);
-    return std::get<T>(it->second);
+    T& res = std::get<T>(it->second);
+    if constexpr (std::is_same_v<T, HistogramStatistic>)
+    {
+      res.d_mutex = &d_mutex;
+    }
+    else if constexpr (std::is_same_v<T, TimerStatistic>)
+    {
+      res.d_name = &it->first;
+    }
+    return res;
   }
 
   /** Print statistics to std::cout. */
   void print() const;
   /** @return Map of strings of statistics entries. */
   std::map<std::string, std::string> get() const;
+  /**
+   * Get a typed copy of all statistics.
+   *
+   * @note This may be called from a different thread while solving.
+   *       Counters are read via relaxed atomic loads, timers are read
+   *       consistently via their sequence lock, and histograms are read
+   *       while holding the lock that guards their growth. Values may thus
+   *       lag slightly behind, but each value is consistent on its own.
+   *
+   * @return The snapshot.
+   */
+  StatisticsSnapshot snapshot() const;
 
  private:
-  using stat_value = std::variant<uint64_t, TimerStatistic, HistogramStatistic>;
+  using stat_value =
+      std::variant<CounterStatistic, TimerStatistic, HistogramStatistic>;
   /** Registered statistic values. */
   std::map<std::string, stat_value> d_stats;
+  /** Guards d_stats and the growth of histograms in d_stats. */
+  mutable std::mutex d_mutex;
 };
 
 }  // namespace bzla::util
@@ -0,0 +1,134 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "util/trace.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+namespace bzla::util {
+
+namespace {
+
+/** @return A small integer id for the current thread. */
+uint64_t
+thread_id()
+{
+  static std::atomic<uint64_t> next_id{0};
+  thread_local uint64_t id = next_id++;
+  return id;
+}
+
+}  // namespace
+
+/* --- Tracer public -------------------------------------------------------- */
+
+Tracer&
+Tracer::get()
+{
+  static Tracer tracer;
+  return tracer;
+}
+
+Tracer::Tracer() : d_start(Clock::now())
+{
+  const char* filename = std::getenv("BZLA_TRACE");
+  if (filename != nullptr && filename[0] != '\0')
+  {
+    d_enabled  = true;
+    d_filename = filename;
+  }
+  const char* min_dur = std::getenv("BZLA_TRACE_MIN_US");
+  if (min_dur != nullptr)
+  {
+    d_min_dur = std::strtoll(min_dur, nullptr, 10);
+  }
+}
+
+Tracer::~Tracer()
+{
+  if (d_enabled)
+  {
+    write();
+  }
+}
+
+void
+Tracer::add(const std::string& name,
+            Clock::time_point start,
+            Clock::time_point end)
+{
+  using namespace std::chrono;
+  if (!d_enabled)
+  {
+    return;
+  }
+  int64_t dur = duration_cast<microseconds>(end - start).count();
+  if (dur < d_min_dur)
+  {
+    return;
+  }
+  int64_t ts = duration_cast<microseconds>(start - d_start).count();
+  std::lock_guard<std::mutex> lock(d_mutex);
+  d_events.push_back({name, ts, dur, thread_id()});
+}
+
+void
+Tracer::write() const
+{
+  std::ofstream out(d_filename);
+  if (!out)
+  {
+    std::cerr << "[bitwuzla] unable to write trace to '" << d_filename << "'"
+              << std::endl;
+    return;
+  }
+  std::lock_guard<std::mutex> lock(d_mutex);
+  out << "{\"traceEvents\":[";
+  for (size_t i = 0, size = d_events.size(); i < size; ++i)
+  {
+    const Event& e = d_events[i];
+    out << (i > 0 ? ",\n" : "\n") << "{\"name\":\"";
+    for (char c : e.d_name)
+    {
+      if (c == '"' || c == '\\')
+      {
+        out << '\\';
+      }
+      out << c;
+    }
+    out << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << e.d_tid
+        << ",\"ts\":" << e.d_ts << ",\"dur\":" << e.d_dur << "}";
+  }
+  out << "\n],\"displayTimeUnit\":\"ms\"}" << std::endl;
+}
+
+/* --- TraceSpan public ----------------------------------------------------- */
+
+TraceSpan::TraceSpan(const char* name) : d_name(name)
+{
+  if (Tracer::get().enabled())
+  {
+    d_start = Tracer::Clock::now();
+  }
+}
+
+TraceSpan::~TraceSpan()
+{
+  Tracer& tracer = Tracer::get();
+  if (tracer.enabled())
+  {
+    tracer.add(d_name, d_start, Tracer::Clock::now());
+  }
+}
+
+}  // namespace bzla::util
@@ -0,0 +1,112 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_UTIL_TRACE_H_INCLUDED
+#define BZLA_UTIL_TRACE_H_INCLUDED
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * Record a trace span named `name` for the remainder of the current scope.
+ *
+ * Tracing is compiled out unless Bitwuzla is configured with `--trace`
+ * (defines BZLA_USE_TRACE). Additionally, all timed statistics
+ * (util::Timer on a registered util::TimerStatistic) are recorded as spans.
+ */
+#ifdef BZLA_USE_TRACE
+#define BZLA_TRACE_CONCAT_(a, b) a##b
+#define BZLA_TRACE_CONCAT(a, b) BZLA_TRACE_CONCAT_(a, b)
+#define TraceScope(name) \
+  bzla::util::TraceSpan BZLA_TRACE_CONCAT(bzla_trace_span_, __LINE__)(name)
+#else
+#define TraceScope(name) (void) 0
+#endif
+
+namespace bzla::util {
+
+/**
+ * Collects trace spans and writes them in the Chrome trace-event JSON format
+ * (readable by chrome://tracing and Perfetto) on exit.
+ *
+ * Tracing is enabled at runtime by setting environment variable `BZLA_TRACE`
+ * to the name of the output file. Spans shorter than `BZLA_TRACE_MIN_US`
+ * microseconds (default: 1) are dropped to keep traces of hot code paths
+ * small.
+ */
+class Tracer
+{
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  /** @return The global tracer instance. */
+  static Tracer& get();
+
+  ~Tracer();
+
+  /** @return True if tracing is enabled. */
+  bool enabled() const { return d_enabled; }
+
+  /**
+   * Record a span.
+   * @param name  The name of the span.
+   * @param start The start time of the span.
+   * @param end   The end time of the span.
+   */
+  void add(const std::string& name,
+           Clock::time_point start,
+           Clock::time_point end);
+
+  /** Write recorded spans to the output file. */
+  void write() const;
+
+ private:
+  struct Event
+  {
+    std::string d_name;
+    int64_t d_ts;
+    int64_t d_dur;
+    uint64_t d_tid;
+  };
+
+  Tracer();
+
+  /** True if tracing is enabled. */
+  bool d_enabled = false;
+  /** The output file name. */
+  std::string d_filename;
+  /** The minimum duration of recorded spans in microseconds. */
+  int64_t d_min_dur = 1;
+  /** The time the tracer was created, timestamps are relative to it. */
+  Clock::time_point d_start;
+  /** The recorded spans. */
+  std::vector<Event> d_events;
+  /** Guards d_events. */
+  mutable std::mutex d_mutex;
+};
+
+/** Records a span from its construction to its destruction. */
+class TraceSpan
+{
+ public:
+  TraceSpan(const char* name);
+  ~TraceSpan();
+
+ private:
+  const char* d_name;
+  Tracer::Clock::time_point d_start;
+};
+
+}  // namespace bzla::util
+
+#endif
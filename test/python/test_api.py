@@ -9,6 +9,7 @@
 ##
 
 import pytest
+import json
 import os
 import time
 
@@ -487,6 +488,28 @@ def test_mk_const_array(tm):
     assert a[0].value() == True
 
 
+
+def test_mk_terms(tm):
+    x = tm.mk_const(tm.mk_bv_sort(8), "x")
+    zero = tm.mk_bv_zero(tm.mk_bv_sort(8))
+    instrs = [
+        Kind.BV_ADD, 2, 0, 1, 0,         # t0 = x + 0
+        Kind.BV_EXTRACT, 1, 2, 2, 3, 0,  # t1 = t0[3:0]
+        Kind.EQUAL.value, 2, 2, 0, 0,    # t2 = (t0 = x)
+    ]
+    terms = tm.mk_terms([x, zero], instrs)
+    t0 = tm.mk_term(Kind.BV_ADD, [x, zero])
+    assert terms == [t0,
+                     tm.mk_term(Kind.BV_EXTRACT, [t0], [3, 0]),
+                     tm.mk_term(Kind.EQUAL, [t0, x])]
+    assert tm.mk_terms([x, zero], []) == []
+    with pytest.raises(BitwuzlaException):
+        tm.mk_terms([x, zero], [Kind.BV_ADD, 2, 0, 2, 0])
+    with pytest.raises(BitwuzlaException):
+        tm.mk_terms([x, zero], instrs[:-1])
+    with pytest.raises(BitwuzlaException):
+        tm.mk_terms([x, tm.mk_true()], instrs)
+
 def test_mk_var(tm):
     x = tm.mk_var(tm.mk_bv_sort(8), "x")
     assert x.symbol() == "x"
@@ -639,6 +662,27 @@ def test_get_value(tm):
     assert bitwuzla.get_value(b).value() == False
 
 
+def test_get_values(tm):
+    bv100 = tm.mk_bv_sort(100)
+    x = tm.mk_const(bv100)
+    b = tm.mk_const(tm.mk_bool_sort())
+    val = tm.mk_bv_value(bv100, 1234567890123456789012345678)
+    bitwuzla = Bitwuzla(tm)
+    with pytest.raises(BitwuzlaException):
+        bitwuzla.get_values([x])
+
+    options = Options()
+    options.set(Option.PRODUCE_MODELS, True)
+    bitwuzla = Bitwuzla(tm, options)
+    bitwuzla.assert_formula(tm.mk_term(Kind.EQUAL, [x, val]))
+    bitwuzla.assert_formula(b)
+    with pytest.raises(BitwuzlaException):
+        bitwuzla.get_values([x, b])
+    assert bitwuzla.check_sat() == Result.SAT
+    assert bitwuzla.get_values([]) == []
+    assert bitwuzla.get_values([x, b, x]) == [val, tm.mk_true(), val]
+
+
 def test_get_bool_value(tm):
     assert tm.mk_true().value() == True
     assert tm.mk_false().value() == False
@@ -943,6 +987,16 @@ def test_statistics(tm):
     for name, val in stats.items():
         print(f'{name}: {val}')
 
+def test_print_statistics(tm):
+    bitwuzla = Bitwuzla(tm)
+    with pytest.raises(BitwuzlaException):
+        bitwuzla.print_statistics('asdf')
+    bitwuzla.assert_formula(tm.mk_const(tm.mk_bool_sort()))
+    bitwuzla.check_sat()
+    stats = json.loads(bitwuzla.print_statistics())
+    assert 'solving_context::time_solve' in stats['timers_ms']
+    assert bitwuzla.print_statistics('prometheus').startswith('# TYPE')
+
 def test_term_mgr(tm):
     bitwuzla = Bitwuzla(tm)
     assert tm == bitwuzla.term_mgr()
@@ -0,0 +1,15 @@
+(set-logic QF_ABV)
+(set-option :produce-models true)
+(declare-const a (Array (_ BitVec 2) (_ BitVec 8)))
+(declare-const b (Array (_ BitVec 2) (_ BitVec 8)))
+(declare-const i (_ BitVec 2))
+(assert (= (select a #b00) #x01))
+(assert (= (select a #b01) #x02))
+(assert (= b (store a i #x03)))
+(assert (= (select b #b00) #x01))
+(assert (= (select b #b01) #x03))
+(set-info :status sat)
+(check-sat)
+(get-value (i))
+(get-value ((select b #b01)))
+(get-value ((select b #b00)))
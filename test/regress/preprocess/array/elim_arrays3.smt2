@@ -0,0 +1,12 @@
+(set-logic QF_ABV)
+(set-option :produce-models true)
+(declare-const a (Array (_ BitVec 32) (_ BitVec 8)))
+(declare-const x (_ BitVec 32))
+(declare-const y (_ BitVec 32))
+(assert (= (select a x) #x01))
+(assert (= (select a y) #x02))
+(assert (bvult x y))
+(set-info :status sat)
+(check-sat)
+(get-value ((select a x)))
+(get-value ((select a y)))
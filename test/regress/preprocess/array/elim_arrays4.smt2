@@ -0,0 +1,9 @@
+(set-logic QF_ABV)
+(declare-const a (Array (_ BitVec 32) (_ BitVec 8)))
+(declare-const x (_ BitVec 32))
+(declare-const y (_ BitVec 32))
+(assert (bvule x y))
+(assert (bvuge x y))
+(assert (distinct (select a x) (select a y)))
+(set-info :status unsat)
+(check-sat)
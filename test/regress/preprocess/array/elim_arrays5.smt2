@@ -0,0 +1,22 @@
+(set-logic QF_ABV)
+(declare-const a (Array (_ BitVec 32) (_ BitVec 8)))
+(declare-const x (_ BitVec 32))
+(declare-const y (_ BitVec 32))
+(assert (= (select a x) #x01))
+(assert (= (select a y) #x02))
+(set-info :status sat)
+(check-sat)
+(push 1)
+(assert (= x y))
+(set-info :status unsat)
+(check-sat)
+(pop 1)
+(push 1)
+(assert (= (select a (bvadd x #x00000001)) #x03))
+(assert (= (bvadd x #x00000001) y))
+(set-info :status unsat)
+(check-sat)
+(pop 1)
+(assert (= (select a (bvadd x #x00000001)) #x02))
+(set-info :status sat)
+(check-sat)
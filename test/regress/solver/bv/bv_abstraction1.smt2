@@ -0,0 +1,18 @@
+(set-logic QF_BV)
+(set-option :produce-models true)
+(declare-const x (_ BitVec 16))
+(declare-const y (_ BitVec 16))
+(declare-const z (_ BitVec 16))
+(assert (bvugt x #x0001))
+(assert (bvugt y #x0001))
+(assert (bvult x #x0100))
+(assert (bvult y #x0100))
+(assert (bvult x y))
+(assert (= (bvmul x y) #x008f))
+(assert (= (bvudiv y z) #x0004))
+(assert (= (bvurem y z) #x0001))
+(set-info :status sat)
+(check-sat)
+(get-value (x))
+(get-value (y))
+(get-value (z))
@@ -0,0 +1,24 @@
+(set-logic QF_BV)
+(declare-const x (_ BitVec 8))
+(declare-const y (_ BitVec 8))
+(push 1)
+(assert (= ((_ extract 0 0) x) #b0))
+(assert (= (bvmul x y) #x01))
+(set-info :status unsat)
+(check-sat)
+(pop 1)
+(push 1)
+(assert (distinct y #x00))
+(assert (bvuge (bvurem x y) y))
+(set-info :status unsat)
+(check-sat)
+(pop 1)
+(push 1)
+(assert (distinct y #x00))
+(assert (bvugt (bvmul (bvudiv x y) y) x))
+(set-info :status unsat)
+(check-sat)
+(pop 1)
+(assert (= (bvmul x y) #x01))
+(set-info :status sat)
+(check-sat)
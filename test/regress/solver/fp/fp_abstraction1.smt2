@@ -0,0 +1,15 @@
+(set-logic QF_FP)
+(set-option :produce-models true)
+(declare-const x (_ FloatingPoint 5 11))
+(declare-const y (_ FloatingPoint 5 11))
+(declare-const z (_ FloatingPoint 5 11))
+(define-fun one () (_ FloatingPoint 5 11) (fp #b0 #b01111 #b0000000000))
+(define-fun two () (_ FloatingPoint 5 11) (fp #b0 #b10000 #b0000000000))
+(define-fun six () (_ FloatingPoint 5 11) (fp #b0 #b10001 #b1000000000))
+(assert (fp.leq x two))
+(assert (fp.geq x two))
+(assert (fp.eq (fp.mul RNE x y) six))
+(assert (fp.eq (fp.div RNE x z) one))
+(set-info :status sat)
+(check-sat)
+(get-value (y))
@@ -0,0 +1,36 @@
+(set-logic QF_FP)
+(declare-const x (_ FloatingPoint 5 11))
+(declare-const y (_ FloatingPoint 5 11))
+(define-fun one () (_ FloatingPoint 5 11) (fp #b0 #b01111 #b0000000000))
+(define-fun two () (_ FloatingPoint 5 11) (fp #b0 #b10000 #b0000000000))
+(define-fun three () (_ FloatingPoint 5 11) (fp #b0 #b10000 #b1000000000))
+(define-fun six () (_ FloatingPoint 5 11) (fp #b0 #b10001 #b1000000000))
+(define-fun seven () (_ FloatingPoint 5 11) (fp #b0 #b10001 #b1100000000))
+(define-fun minus_one () (_ FloatingPoint 5 11) (fp #b1 #b01111 #b0000000000))
+(assert (fp.leq x two))
+(assert (fp.geq x two))
+(assert (fp.leq y three))
+(assert (fp.geq y three))
+(push 1)
+(assert (not (fp.eq (fp.mul RNE x y) six)))
+(set-info :status unsat)
+(check-sat)
+(pop 1)
+(push 1)
+(assert (not (fp.eq (fp.fma RNE x y one) seven)))
+(set-info :status unsat)
+(check-sat)
+(pop 1)
+(push 1)
+(assert (not (fp.eq (fp.rem y x) minus_one)))
+(set-info :status unsat)
+(check-sat)
+(pop 1)
+(push 1)
+(assert (not (fp.eq (fp.sqrt RNE (fp.mul RNE y y)) y)))
+(set-info :status unsat)
+(check-sat)
+(pop 1)
+(assert (fp.eq (fp.div RNE (fp.mul RNE x y) y) x))
+(set-info :status sat)
+(check-sat)
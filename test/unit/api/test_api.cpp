@@ -12,8 +12,10 @@
 #include <bitwuzla/cpp/parser.h>
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <fstream>
+#include <thread>
 
 #include "test/unit/test.h"
 
@@ -368,6 +370,19 @@ TEST_F(TestApi, options_set)
     ASSERT_THROW(opts.set("sat--solver", "kissat"), bitwuzla::Exception);
     ASSERT_THROW(opts.set(bitwuzla::Option::BV_SOLVER, "asdf"),
                  bitwuzla::Exception);
+
+    ASSERT_TRUE(opts.is_string(bitwuzla::Option::SAT_PROOF_FILE));
+    ASSERT_EQ(opts.get_str(bitwuzla::Option::SAT_PROOF_FILE), "");
+    opts.set(bitwuzla::Option::SAT_PROOF_FILE, "proof.drat");
+    ASSERT_EQ(opts.get_str(bitwuzla::Option::SAT_PROOF_FILE), "proof.drat");
+    opts.set("sat-proof-file", "proof.lrat");
+    ASSERT_EQ(opts.get_str(bitwuzla::Option::SAT_PROOF_FILE), "proof.lrat");
+    ASSERT_THROW(opts.get_mode(bitwuzla::Option::SAT_PROOF_FILE),
+                 bitwuzla::Exception);
+    ASSERT_THROW(opts.get_str(bitwuzla::Option::SAT_SOLVER),
+                 bitwuzla::Exception);
+    opts.set(bitwuzla::Option::SAT_PROOF_FORMAT, "lrat");
+    ASSERT_EQ(opts.get_mode(bitwuzla::Option::SAT_PROOF_FORMAT), "lrat");
   }
 }
 
@@ -385,6 +400,8 @@ TEST_F(TestApi, option_set_args)
   ASSERT_THROW(options.set({"-v=100"}), bitwuzla::Exception);
   options.set({"-S=cadical"});
   ASSERT_EQ(options.get_mode(bitwuzla::Option::SAT_SOLVER), "cadical");
+  options.set({"--sat-proof-file=proof.drat"});
+  ASSERT_EQ(options.get_str(bitwuzla::Option::SAT_PROOF_FILE), "proof.drat");
   ASSERT_THROW(options.set({"--no-verbosity"}), bitwuzla::Exception);
 }
 
@@ -407,6 +424,12 @@ TEST_F(TestApi, option_info)
       ASSERT_GE(cur, std::get<bitwuzla::OptionInfo::Numeric>(info.values).min);
       ASSERT_LE(cur, std::get<bitwuzla::OptionInfo::Numeric>(info.values).max);
     }
+    else if (info.kind == bitwuzla::OptionInfo::Kind::STRING)
+    {
+      const auto& values = std::get<bitwuzla::OptionInfo::String>(info.values);
+      ASSERT_EQ(options.get_str(opt), values.cur);
+      ASSERT_EQ(values.cur, values.dflt);
+    }
     else
     {
       const auto& values = std::get<bitwuzla::OptionInfo::Mode>(info.values);
@@ -429,6 +452,56 @@ TEST_F(TestApi, option_info)
   }
 }
 
+TEST_F(TestApi, sat_proof_and_decision_limit)
+{
+  // x * y = 4093 with x, y > 1 is unsat since 4093 is prime.
+  bitwuzla::Sort bv16 = d_tm.mk_bv_sort(16);
+  bitwuzla::Term x    = d_tm.mk_const(bv16, "x");
+  bitwuzla::Term y    = d_tm.mk_const(bv16, "y");
+  bitwuzla::Term one  = d_tm.mk_bv_one(bv16);
+  bitwuzla::Term mul  = d_tm.mk_term(
+      bitwuzla::Kind::BV_MUL,
+      {d_tm.mk_term(bitwuzla::Kind::BV_ZERO_EXTEND, {x}, {16}),
+       d_tm.mk_term(bitwuzla::Kind::BV_ZERO_EXTEND, {y}, {16})});
+  std::vector<bitwuzla::Term> assertions = {
+      d_tm.mk_term(bitwuzla::Kind::EQUAL,
+                   {mul, d_tm.mk_bv_value_uint64(d_bv_sort32, 4093)}),
+      d_tm.mk_term(bitwuzla::Kind::BV_UGT, {x, one}),
+      d_tm.mk_term(bitwuzla::Kind::BV_UGT, {y, one})};
+
+  for (const char* format : {"drat", "lrat"})
+  {
+    std::string filename = "sat_proof.out";
+    {
+      bitwuzla::Options options;
+      options.set(bitwuzla::Option::SAT_PROOF_FILE, filename);
+      options.set(bitwuzla::Option::SAT_PROOF_FORMAT, format);
+      bitwuzla::Bitwuzla bitwuzla(d_tm, options);
+      for (const auto& a : assertions)
+      {
+        bitwuzla.assert_formula(a);
+      }
+      ASSERT_EQ(bitwuzla.check_sat(), bitwuzla::Result::UNSAT);
+    }
+    std::ifstream ifs(filename, std::ios::binary | std::ios::ate);
+    ASSERT_TRUE(ifs.is_open());
+    ASSERT_GT(ifs.tellg(), 0);
+    ifs.close();
+    unlink(filename.c_str());
+  }
+
+  {
+    bitwuzla::Options options;
+    options.set(bitwuzla::Option::SAT_DECISION_LIMIT, 1);
+    bitwuzla::Bitwuzla bitwuzla(d_tm, options);
+    for (const auto& a : assertions)
+    {
+      bitwuzla.assert_formula(a);
+    }
+    ASSERT_EQ(bitwuzla.check_sat(), bitwuzla::Result::UNKNOWN);
+  }
+}
+
 TEST_F(TestApi, option_is_valid)
 {
   bitwuzla::Options options;
@@ -1395,6 +1468,56 @@ TEST_F(TestApi, mk_term_check_args)
       bitwuzla::Exception);
 }
 
+TEST_F(TestApi, mk_terms)
+{
+  uint64_t add     = static_cast<uint64_t>(bitwuzla::Kind::BV_ADD);
+  uint64_t extract = static_cast<uint64_t>(bitwuzla::Kind::BV_EXTRACT);
+  uint64_t equal   = static_cast<uint64_t>(bitwuzla::Kind::EQUAL);
+  std::vector<bitwuzla::Term> leaves = {d_bv_const8, d_bv_zero8};
+
+  std::vector<uint64_t> instrs = {
+      add,     2, 0, 1, 0,     // t0 = bv8 + 0
+      extract, 1, 2, 2, 3, 0,  // t1 = t0[3:0]
+      equal,   2, 2, 0, 0,     // t2 = (t0 = bv8)
+  };
+  std::vector<bitwuzla::Term> terms = d_tm.mk_terms(leaves, instrs);
+  bitwuzla::Term t0 =
+      d_tm.mk_term(bitwuzla::Kind::BV_ADD, {d_bv_const8, d_bv_zero8});
+  ASSERT_EQ(terms.size(), 3);
+  ASSERT_EQ(terms[0], t0);
+  ASSERT_EQ(terms[1], d_tm.mk_term(bitwuzla::Kind::BV_EXTRACT, {t0}, {3, 0}));
+  ASSERT_EQ(terms[2], d_tm.mk_term(bitwuzla::Kind::EQUAL, {t0, d_bv_const8}));
+  ASSERT_TRUE(d_tm.mk_terms(leaves, {}).empty());
+
+  // invalid kind
+  ASSERT_THROW(d_tm.mk_terms(
+                   leaves,
+                   {static_cast<uint64_t>(bitwuzla::Kind::NUM_KINDS), 0, 0}),
+               bitwuzla::Exception);
+  // incomplete records
+  ASSERT_THROW(d_tm.mk_terms(leaves, {add}), bitwuzla::Exception);
+  ASSERT_THROW(d_tm.mk_terms(leaves, {add, 2, 0, 1}), bitwuzla::Exception);
+  ASSERT_THROW(d_tm.mk_terms(leaves, {extract, 1, 0, 2, 3}),
+               bitwuzla::Exception);
+  // reference to itself or a succeeding record
+  ASSERT_THROW(d_tm.mk_terms(leaves, {add, 2, 0, 2, 0}), bitwuzla::Exception);
+  ASSERT_THROW(d_tm.mk_terms(leaves, {add, 2, 0, 1, 0, add, 2, 0, 3, 0}),
+               bitwuzla::Exception);
+  // invalid leaves
+  ASSERT_THROW(d_tm.mk_terms({d_bv_const8, bitwuzla::Term()}, instrs),
+               bitwuzla::Exception);
+  {
+    bitwuzla::TermManager tm;
+    ASSERT_THROW(
+        d_tm.mk_terms({d_bv_const8, tm.mk_bv_zero(tm.mk_bv_sort(8))}, instrs),
+        bitwuzla::Exception);
+  }
+  // sort checks of mk_term
+  ASSERT_THROW(d_tm.mk_terms({d_bv_const8, d_bv_one1}, instrs),
+               bitwuzla::Exception);
+  ASSERT_THROW(d_tm.mk_terms(leaves, {add, 1, 0, 0}), bitwuzla::Exception);
+}
+
 TEST_F(TestApi, mk_const)
 {
   ASSERT_NO_THROW(d_tm.mk_const(d_bv_sort8));
@@ -1646,6 +1769,165 @@ TEST_F(TestApi, get_value)
   }
 }
 
+TEST_F(TestApi, get_values)
+{
+  {
+    bitwuzla::Bitwuzla bitwuzla(d_tm);
+    ASSERT_THROW(bitwuzla.get_values({d_bv_const8}), bitwuzla::Exception);
+  }
+  {
+    bitwuzla::Options options;
+    options.set(bitwuzla::Option::PRODUCE_MODELS, true);
+    bitwuzla::Bitwuzla bitwuzla(d_tm, options);
+    bitwuzla::Sort bv100 = d_tm.mk_bv_sort(100);
+    bitwuzla::Term x     = d_tm.mk_const(bv100);
+    bitwuzla::Term val =
+        d_tm.mk_bv_value(bv100, "1234567890123456789012345678", 10);
+    bitwuzla.assert_formula(d_tm.mk_term(bitwuzla::Kind::EQUAL, {x, val}));
+    bitwuzla.assert_formula(d_bv_const1_true);
+    ASSERT_THROW(bitwuzla.get_values({x}), bitwuzla::Exception);
+    ASSERT_EQ(bitwuzla.check_sat(), bitwuzla::Result::SAT);
+    ASSERT_THROW(bitwuzla.get_values({x, bitwuzla::Term()}),
+                 bitwuzla::Exception);
+    ASSERT_TRUE(bitwuzla.get_values({}).empty());
+    auto values = bitwuzla.get_values({x, d_bv_const1, x, d_bv_const8});
+    ASSERT_EQ(values.size(), 4);
+    ASSERT_EQ(values[0], val);
+    ASSERT_EQ(values[1], d_bv_one1);
+    ASSERT_EQ(values[2], val);
+    ASSERT_EQ(values[3], bitwuzla.get_value(d_bv_const8));
+  }
+  {
+    bitwuzla::TermManager tm;
+    bitwuzla::Options options;
+    options.set(bitwuzla::Option::PRODUCE_MODELS, true);
+    bitwuzla::Bitwuzla bitwuzla(tm, options);
+    bitwuzla.assert_formula(tm.mk_true());
+    ASSERT_EQ(bitwuzla.check_sat(), bitwuzla::Result::SAT);
+    ASSERT_THROW(bitwuzla.get_values({d_bv_const8}), bitwuzla::Exception);
+  }
+}
+
+TEST_F(TestApi, model_reuse)
+{
+  bitwuzla::Options options;
+  options.set(bitwuzla::Option::PRODUCE_MODELS, true);
+  options.set(bitwuzla::Option::MODEL_REUSE, true);
+  bitwuzla::Bitwuzla bitwuzla(d_tm, options);
+  bitwuzla::Term five  = d_tm.mk_bv_value_uint64(d_bv_sort8, 5);
+  bitwuzla::Term three = d_tm.mk_bv_value_uint64(d_bv_sort8, 3);
+  bitwuzla::Term two   = d_tm.mk_bv_value_uint64(d_bv_sort8, 2);
+  auto num_reuses      = [&bitwuzla]() {
+    return bitwuzla.statistics().at("solving_context::num_model_reuses");
+  };
+
+  bitwuzla.assert_formula(
+      d_tm.mk_term(bitwuzla::Kind::BV_UGT, {d_bv_const8, five}));
+  ASSERT_EQ(bitwuzla.check_sat(), bitwuzla::Result::SAT);
+  bitwuzla::Term val = bitwuzla.get_value(d_bv_const8);
+  ASSERT_EQ(num_reuses(), "0");
+
+  // satisfied by the current model
+  bitwuzla.assert_formula(
+      d_tm.mk_term(bitwuzla::Kind::BV_UGT, {d_bv_const8, three}));
+  ASSERT_EQ(bitwuzla.check_sat(), bitwuzla::Result::SAT);
+  ASSERT_EQ(num_reuses(), "1");
+  ASSERT_EQ(bitwuzla.get_value(d_bv_const8), val);
+
+  // still reused after pop
+  bitwuzla.push(1);
+  bitwuzla.pop(1);
+  ASSERT_EQ(bitwuzla.check_sat(), bitwuzla::Result::SAT);
+  ASSERT_EQ(num_reuses(), "2");
+  ASSERT_EQ(bitwuzla.get_value(d_bv_const8), val);
+
+  // not satisfied by the current model
+  bitwuzla.assert_formula(
+      d_tm.mk_term(bitwuzla::Kind::DISTINCT, {d_bv_const8, val}));
+  ASSERT_EQ(bitwuzla.check_sat(), bitwuzla::Result::SAT);
+  ASSERT_EQ(num_reuses(), "2");
+  ASSERT_NE(bitwuzla.get_value(d_bv_const8), val);
+  bitwuzla.assert_formula(
+      d_tm.mk_term(bitwuzla::Kind::BV_ULT, {d_bv_const8, two}));
+  ASSERT_EQ(bitwuzla.check_sat(), bitwuzla::Result::UNSAT);
+  ASSERT_EQ(num_reuses(), "2");
+}
+
+TEST_F(TestApi, model_reuse_assumptions)
+{
+  bitwuzla::Options options;
+  options.set(bitwuzla::Option::PRODUCE_MODELS, true);
+  options.set(bitwuzla::Option::MODEL_REUSE, true);
+  bitwuzla::Bitwuzla bitwuzla(d_tm, options);
+  bitwuzla::Term five  = d_tm.mk_bv_value_uint64(d_bv_sort8, 5);
+  bitwuzla::Term three = d_tm.mk_bv_value_uint64(d_bv_sort8, 3);
+  bitwuzla::Term two   = d_tm.mk_bv_value_uint64(d_bv_sort8, 2);
+  bitwuzla::Term y     = d_tm.mk_const(d_bv_sort8, "y");
+  auto num_reuses      = [&bitwuzla]() {
+    return bitwuzla.statistics().at("solving_context::num_model_reuses");
+  };
+
+  bitwuzla.assert_formula(
+      d_tm.mk_term(bitwuzla::Kind::BV_UGT, {d_bv_const8, five}));
+  ASSERT_EQ(bitwuzla.check_sat(), bitwuzla::Result::SAT);
+  bitwuzla::Term val = bitwuzla.get_value(d_bv_const8);
+
+  // assumptions satisfied by the current model
+  bitwuzla::Term gt3 =
+      d_tm.mk_term(bitwuzla::Kind::BV_UGT, {d_bv_const8, three});
+  ASSERT_EQ(bitwuzla.check_sat({gt3}), bitwuzla::Result::SAT);
+  ASSERT_EQ(num_reuses(), "1");
+  ASSERT_EQ(bitwuzla.get_value(d_bv_const8), val);
+  ASSERT_EQ(bitwuzla.check_sat({gt3, gt3}), bitwuzla::Result::SAT);
+  ASSERT_EQ(num_reuses(), "2");
+
+  // constants that do not occur in the assertions get consistent values
+  bitwuzla::Term vy = bitwuzla.get_value(y);
+  bitwuzla::Term vadd = bitwuzla.get_value(
+      d_tm.mk_term(bitwuzla::Kind::BV_ADD, {d_bv_const8, y}));
+  ASSERT_EQ(vadd.value<std::string>(10),
+            std::to_string((std::stoul(val.value<std::string>(10))
+                            + std::stoul(vy.value<std::string>(10)))
+                           % 256));
+
+  // assumption not satisfied by the current model
+  ASSERT_EQ(bitwuzla.check_sat(
+                {d_tm.mk_term(bitwuzla::Kind::DISTINCT, {d_bv_const8, val})}),
+            bitwuzla::Result::SAT);
+  ASSERT_EQ(num_reuses(), "2");
+  val = bitwuzla.get_value(d_bv_const8);
+
+  // the model of the last sat check is reused after popping the assumptions
+  ASSERT_EQ(bitwuzla.check_sat({gt3}), bitwuzla::Result::SAT);
+  ASSERT_EQ(num_reuses(), "3");
+  ASSERT_EQ(bitwuzla.get_value(d_bv_const8), val);
+
+  // unsat assumptions do not invalidate the model
+  bitwuzla::Term lt2 =
+      d_tm.mk_term(bitwuzla::Kind::BV_ULT, {d_bv_const8, two});
+  ASSERT_EQ(bitwuzla.check_sat({lt2}), bitwuzla::Result::UNSAT);
+  ASSERT_EQ(bitwuzla.get_unsat_assumptions(), std::vector<bitwuzla::Term>{lt2});
+  ASSERT_EQ(num_reuses(), "3");
+  ASSERT_EQ(bitwuzla.check_sat(), bitwuzla::Result::SAT);
+  ASSERT_EQ(num_reuses(), "4");
+  ASSERT_EQ(bitwuzla.get_value(d_bv_const8), val);
+}
+
+TEST_F(TestApi, model_reuse_disabled)
+{
+  bitwuzla::Options options;
+  ASSERT_FALSE(options.get(bitwuzla::Option::MODEL_REUSE));
+  options.set(bitwuzla::Option::PRODUCE_MODELS, true);
+  bitwuzla::Bitwuzla bitwuzla(d_tm, options);
+  bitwuzla.assert_formula(d_tm.mk_term(
+      bitwuzla::Kind::BV_UGT,
+      {d_bv_const8, d_tm.mk_bv_value_uint64(d_bv_sort8, 5)}));
+  ASSERT_EQ(bitwuzla.check_sat(), bitwuzla::Result::SAT);
+  ASSERT_EQ(bitwuzla.check_sat(), bitwuzla::Result::SAT);
+  ASSERT_EQ(bitwuzla.statistics().at("solving_context::num_model_reuses"),
+            "0");
+}
+
 TEST_F(TestApi, get_bool_value)
 {
   ASSERT_EQ(true, d_true.value<bool>());
@@ -2080,6 +2362,75 @@ TEST_F(TestApi, statistics)
   }
 }
 
+TEST_F(TestApi, print_statistics)
+{
+  bitwuzla::Options options;
+  bitwuzla::Bitwuzla bitwuzla(d_tm, options);
+  ASSERT_THROW(bitwuzla.print_statistics(std::cout, ""), bitwuzla::Exception);
+  ASSERT_THROW(bitwuzla.print_statistics(std::cout, "asdf"),
+               bitwuzla::Exception);
+  bitwuzla.assert_formula(d_bool_const);
+  bitwuzla.check_sat();
+  {
+    std::stringstream ss;
+    bitwuzla.print_statistics(ss, "json");
+    ASSERT_EQ(ss.str().rfind("{\"counters\":{", 0), 0);
+    ASSERT_NE(ss.str().find("\"solving_context::time_solve\":"),
+              std::string::npos);
+  }
+  {
+    std::stringstream ss;
+    bitwuzla.print_statistics(ss, "prometheus");
+    ASSERT_NE(ss.str().find("# TYPE bitwuzla_solving_context_time_solve_seconds"
+                            " counter\n"),
+              std::string::npos);
+  }
+}
+
+TEST_F(TestApi, print_statistics_concurrent)
+{
+  bitwuzla::Options options;
+  bitwuzla::Bitwuzla bitwuzla(d_tm, options);
+  // Factorize 4093 * 4091, both are prime.
+  bitwuzla::Sort bv24 = d_tm.mk_bv_sort(24);
+  bitwuzla::Term x    = d_tm.mk_const(bv24, "x");
+  bitwuzla::Term y    = d_tm.mk_const(bv24, "y");
+  bitwuzla::Term one  = d_tm.mk_bv_one(bv24);
+  bitwuzla.assert_formula(d_tm.mk_term(
+      bitwuzla::Kind::EQUAL,
+      {d_tm.mk_term(bitwuzla::Kind::BV_MUL, {x, y}),
+       d_tm.mk_bv_value_uint64(bv24, 4093 * 4091)}));
+  bitwuzla.assert_formula(
+      d_tm.mk_term(bitwuzla::Kind::NOT,
+                   {d_tm.mk_term(bitwuzla::Kind::BV_UMUL_OVERFLOW, {x, y})}));
+  bitwuzla.assert_formula(d_tm.mk_term(bitwuzla::Kind::BV_UGT, {x, one}));
+  bitwuzla.assert_formula(d_tm.mk_term(bitwuzla::Kind::BV_UGT, {y, one}));
+
+  // Take snapshots from a second thread while solving.
+  std::atomic<bool> done(false);
+  std::vector<std::string> snapshots;
+  std::thread monitor([&]() {
+    do
+    {
+      std::stringstream ss;
+      bitwuzla.print_statistics(ss, "json");
+      snapshots.push_back(ss.str());
+    } while (!done.load());
+  });
+  bitwuzla::Result res = bitwuzla.check_sat();
+  done                 = true;
+  monitor.join();
+
+  ASSERT_EQ(res, bitwuzla::Result::SAT);
+  ASSERT_FALSE(snapshots.empty());
+  for (const auto& snapshot : snapshots)
+  {
+    ASSERT_EQ(snapshot.rfind("{\"counters\":{", 0), 0);
+    ASSERT_NE(snapshot.find("\"solving_context::time_solve\":"),
+              std::string::npos);
+  }
+}
+
 /* -------------------------------------------------------------------------- */
 /* Sort                                                                       */
 /* -------------------------------------------------------------------------- */
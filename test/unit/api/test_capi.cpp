@@ -571,6 +571,19 @@ TEST_F(TestCApi, set_option)
     ASSERT_DEATH(
         bitwuzla_set_option_mode(options, BITWUZLA_OPT_BV_SOLVER, "asdf"),
         "invalid mode for option");
+    ASSERT_EQ(std::string(bitwuzla_get_option_str(options,
+                                                  BITWUZLA_OPT_SAT_PROOF_FILE)),
+              "");
+    bitwuzla_set_option_str(options, BITWUZLA_OPT_SAT_PROOF_FILE, "out.drat");
+    ASSERT_EQ(std::string(bitwuzla_get_option_str(options,
+                                                  BITWUZLA_OPT_SAT_PROOF_FILE)),
+              "out.drat");
+    ASSERT_DEATH(
+        bitwuzla_set_option_str(options, BITWUZLA_OPT_BV_SOLVER, "prop"),
+        "expected string option");
+    ASSERT_DEATH(
+        bitwuzla_set_option_mode(options, BITWUZLA_OPT_SAT_PROOF_FILE, "a"),
+        "expected option with option modes");
     bitwuzla_options_delete(options);
   }
 }
@@ -590,6 +603,12 @@ TEST_F(TestCApi, option_info)
       ASSERT_GE(info.numeric.cur, info.numeric.min);
       ASSERT_LE(info.numeric.cur, info.numeric.max);
     }
+    else if (bitwuzla_option_is_string(options, opt))
+    {
+      ASSERT_EQ(std::string(bitwuzla_get_option_str(options, opt)),
+                std::string(info.mode.cur));
+      ASSERT_EQ(info.mode.num_modes, 0u);
+    }
     else
     {
       ASSERT_EQ(std::string(bitwuzla_get_option_mode(options, opt)),
@@ -2414,6 +2433,81 @@ TEST_F(TestCApi, mk_term_check_args)
                error_invalid_sort);
 }
 
+TEST_F(TestCApi, mk_terms)
+{
+  std::vector<BitwuzlaTerm> leaves{d_bv_const8, d_bv_zero8};
+  std::vector<uint64_t> instrs{
+      BITWUZLA_KIND_BV_ADD,     2, 0, 1, 0,     // t0 = bv8 + 0
+      BITWUZLA_KIND_BV_EXTRACT, 1, 2, 2, 3, 0,  // t1 = t0[3:0]
+      BITWUZLA_KIND_EQUAL,      2, 2, 0, 0,     // t2 = (t0 = bv8)
+  };
+  std::vector<uint64_t> inv_instrs{BITWUZLA_KIND_BV_ADD, 2, 0, 2, 0};
+  size_t size;
+
+  ASSERT_DEATH(bitwuzla_mk_terms(nullptr,
+                                 leaves.size(),
+                                 leaves.data(),
+                                 instrs.size(),
+                                 instrs.data(),
+                                 &size),
+               d_error_not_null);
+  ASSERT_DEATH(bitwuzla_mk_terms(d_tm,
+                                 leaves.size(),
+                                 leaves.data(),
+                                 instrs.size(),
+                                 instrs.data(),
+                                 nullptr),
+               d_error_not_null);
+  ASSERT_DEATH(bitwuzla_mk_terms(
+                   d_tm, leaves.size(), nullptr, instrs.size(), instrs.data(),
+                   &size),
+               d_error_not_null);
+  ASSERT_DEATH(bitwuzla_mk_terms(
+                   d_tm, leaves.size(), leaves.data(), instrs.size(), nullptr,
+                   &size),
+               d_error_not_null);
+  std::vector<BitwuzlaTerm> inv_leaves{d_bv_const8, 0};
+  ASSERT_DEATH(bitwuzla_mk_terms(d_tm,
+                                 inv_leaves.size(),
+                                 inv_leaves.data(),
+                                 instrs.size(),
+                                 instrs.data(),
+                                 &size),
+               d_error_inv_term);
+  ASSERT_DEATH(bitwuzla_mk_terms(d_tm,
+                                 leaves.size(),
+                                 leaves.data(),
+                                 inv_instrs.size(),
+                                 inv_instrs.data(),
+                                 &size),
+               "invalid argument reference");
+  ASSERT_DEATH(bitwuzla_mk_terms(d_tm,
+                                 leaves.size(),
+                                 leaves.data(),
+                                 instrs.size() - 1,
+                                 instrs.data(),
+                                 &size),
+               "incomplete record");
+
+  ASSERT_EQ(bitwuzla_mk_terms(d_tm, 0, nullptr, 0, nullptr, &size), nullptr);
+  ASSERT_EQ(size, 0);
+  BitwuzlaTerm *terms = bitwuzla_mk_terms(d_tm,
+                                          leaves.size(),
+                                          leaves.data(),
+                                          instrs.size(),
+                                          instrs.data(),
+                                          &size);
+  ASSERT_EQ(size, 3);
+  BitwuzlaTerm t0 =
+      bitwuzla_mk_term2(d_tm, BITWUZLA_KIND_BV_ADD, d_bv_const8, d_bv_zero8);
+  ASSERT_EQ(terms[0], t0);
+  ASSERT_EQ(
+      terms[1],
+      bitwuzla_mk_term1_indexed2(d_tm, BITWUZLA_KIND_BV_EXTRACT, t0, 3, 0));
+  ASSERT_EQ(terms[2],
+            bitwuzla_mk_term2(d_tm, BITWUZLA_KIND_EQUAL, t0, d_bv_const8));
+}
+
 TEST_F(TestCApi, mk_const)
 {
   ASSERT_DEATH(bitwuzla_mk_const(d_tm, 0, "asdf"), d_error_inv_sort);
@@ -2722,6 +2816,42 @@ TEST_F(TestCApi, get_value)
   }
 }
 
+TEST_F(TestCApi, get_values)
+{
+  std::vector<BitwuzlaTerm> terms{d_bv_const1, d_bv_const1_false, d_bv_const1};
+  {
+    Bitwuzla *bitwuzla = bitwuzla_new(d_tm, nullptr);
+    ASSERT_DEATH(bitwuzla_get_values(bitwuzla, terms.size(), terms.data()),
+                 d_error_produce_models);
+    bitwuzla_delete(bitwuzla);
+  }
+  {
+    BitwuzlaOptions *options = bitwuzla_options_new();
+    bitwuzla_set_option(options, BITWUZLA_OPT_PRODUCE_MODELS, 1);
+    Bitwuzla *bitwuzla = bitwuzla_new(d_tm, options);
+    ASSERT_DEATH(bitwuzla_get_values(nullptr, terms.size(), terms.data()),
+                 d_error_not_null);
+    ASSERT_DEATH(bitwuzla_get_values(bitwuzla, terms.size(), nullptr),
+                 d_error_not_null);
+    bitwuzla_assert(bitwuzla, d_bv_const1_true);
+    ASSERT_DEATH(bitwuzla_get_values(bitwuzla, terms.size(), terms.data()),
+                 d_error_sat);
+    bitwuzla_check_sat(bitwuzla);
+    std::vector<BitwuzlaTerm> inv_terms{d_bv_const1, 0};
+    ASSERT_DEATH(
+        bitwuzla_get_values(bitwuzla, inv_terms.size(), inv_terms.data()),
+        d_error_inv_term);
+    ASSERT_EQ(bitwuzla_get_values(bitwuzla, 0, nullptr), nullptr);
+    BitwuzlaTerm *values =
+        bitwuzla_get_values(bitwuzla, terms.size(), terms.data());
+    ASSERT_EQ(values[0], d_bv_one1);
+    ASSERT_EQ(values[1], bitwuzla_mk_false(d_tm));
+    ASSERT_EQ(values[2], d_bv_one1);
+    bitwuzla_delete(bitwuzla);
+    bitwuzla_options_delete(options);
+  }
+}
+
 TEST_F(TestCApi, value_get_bool)
 {
   ASSERT_EQ(true, bitwuzla_term_value_get_bool(d_true));
@@ -3221,6 +3351,25 @@ TEST_F(TestCApi, statistics)
   bitwuzla_options_delete(options);
 }
 
+TEST_F(TestCApi, print_statistics)
+{
+  BitwuzlaOptions *options = bitwuzla_options_new();
+  Bitwuzla *bitwuzla       = bitwuzla_new(d_tm, options);
+  ASSERT_DEATH(bitwuzla_print_statistics(nullptr, "json", stdout),
+               d_error_not_null);
+  ASSERT_DEATH(bitwuzla_print_statistics(bitwuzla, nullptr, stdout),
+               d_error_not_null);
+  ASSERT_DEATH(bitwuzla_print_statistics(bitwuzla, "json", nullptr),
+               d_error_not_null);
+  ASSERT_DEATH(bitwuzla_print_statistics(bitwuzla, "asdf", stdout),
+               "invalid format");
+  bitwuzla_assert(bitwuzla, d_bool_const);
+  bitwuzla_print_statistics(bitwuzla, "json", stdout);
+  bitwuzla_print_statistics(bitwuzla, "prometheus", stdout);
+  bitwuzla_delete(bitwuzla);
+  bitwuzla_options_delete(options);
+}
+
 /* -------------------------------------------------------------------------- */
 /* Parsing                                                                    */
 /* -------------------------------------------------------------------------- */
@@ -5151,35 +5300,109 @@ TEST_F(TestCApi, term_copy_release)
 {
   BitwuzlaTermManager *tm = bitwuzla_term_manager_new();
 
-  ASSERT_TRUE(tm->d_alloc_terms.empty());
+  ASSERT_EQ(tm->d_num_alloc_terms, 0);
 
   auto t1 = bitwuzla_mk_true(tm);
   ASSERT_EQ(t1->d_refs, 1);
-  ASSERT_EQ(tm->d_alloc_terms.size(), 1);
+  ASSERT_EQ(tm->d_num_alloc_terms, 1);
 
   auto t1c = bitwuzla_term_copy(t1);
   ASSERT_EQ(t1->d_refs, 2);
-  ASSERT_EQ(tm->d_alloc_terms.size(), 1);
+  ASSERT_EQ(tm->d_num_alloc_terms, 1);
   ASSERT_EQ(t1, t1c);
 
   auto t2 = bitwuzla_mk_true(tm);
-  ASSERT_EQ(tm->d_alloc_terms.size(), 1);
+  ASSERT_EQ(tm->d_num_alloc_terms, 1);
   ASSERT_EQ(t1, t2);
   ASSERT_EQ(t1->d_refs, 3);
 
   auto t3 = bitwuzla_mk_false(tm);
-  ASSERT_EQ(tm->d_alloc_terms.size(), 2);
+  ASSERT_EQ(tm->d_num_alloc_terms, 2);
   ASSERT_EQ(t3->d_refs, 1);
 
   bitwuzla_term_release(t3);
-  ASSERT_EQ(tm->d_alloc_terms.size(), 1);
+  ASSERT_EQ(tm->d_num_alloc_terms, 1);
+
+  // re-export after release
+  auto t4 = bitwuzla_mk_false(tm);
+  ASSERT_EQ(tm->d_num_alloc_terms, 2);
+  ASSERT_EQ(t4->d_refs, 1);
+  ASSERT_TRUE(bitwuzla_term_is_false(t4));
+  bitwuzla_term_release(t4);
+  ASSERT_EQ(tm->d_num_alloc_terms, 1);
 
   bitwuzla_term_release(t2);
   ASSERT_EQ(t1->d_refs, 2);
   bitwuzla_term_release(t1c);
   ASSERT_EQ(t1->d_refs, 1);
   bitwuzla_term_release(t1);
-  ASSERT_TRUE(tm->d_alloc_terms.empty());
+  ASSERT_EQ(tm->d_num_alloc_terms, 0);
+
+  bitwuzla_term_manager_delete(tm);
+}
+
+TEST_F(TestCApi, term_handle_table)
+{
+  BitwuzlaTermManager *tm = bitwuzla_term_manager_new();
+  BitwuzlaSort bv32       = bitwuzla_mk_bv_sort(tm, 32);
+
+  std::vector<BitwuzlaTerm> terms;
+  for (uint64_t i = 0; i < 1000; ++i)
+  {
+    terms.push_back(bitwuzla_mk_bv_value_uint64(tm, bv32, i));
+  }
+  ASSERT_EQ(tm->d_term_handles.size(), 1000);
+  for (uint64_t i = 0; i < 1000; ++i)
+  {
+    ASSERT_EQ(bitwuzla_mk_bv_value_uint64(tm, bv32, i), terms[i]);
+    ASSERT_EQ(terms[i]->d_refs, 2);
+  }
+  size_t capacity = tm->d_term_handles.d_slots.size();
+  for (size_t i = 0; i < terms.size(); i += 2)
+  {
+    bitwuzla_term_release(terms[i]);
+    bitwuzla_term_release(terms[i]);
+  }
+  ASSERT_EQ(tm->d_term_handles.size(), 500);
+  for (size_t i = 1; i < terms.size(); i += 2)
+  {
+    ASSERT_EQ(tm->d_term_handles.find(terms[i]->d_term.id()),
+              terms[i]);
+    bitwuzla_term_release(terms[i]);
+    bitwuzla_term_release(terms[i]);
+  }
+  // The table shrinks with the number of exported terms.
+  ASSERT_EQ(tm->d_term_handles.size(), 0);
+  ASSERT_LT(tm->d_term_handles.d_slots.size(), capacity);
+  ASSERT_EQ(tm->d_term_handles.d_slots.size(),
+            TermHandleTable::s_min_capacity);
+
+  // Term ids are not bounded by the number of exported terms.
+  TermHandleTable table;
+  std::unordered_map<uint64_t, bitwuzla_term_t *> expected;
+  std::vector<uint64_t> ids;
+  for (uint64_t i = 0; i < 10000; ++i)
+  {
+    uint64_t id = (i * 7919) << 20;
+    auto *term  = reinterpret_cast<bitwuzla_term_t *>(i + 1);
+    table.insert(id, term);
+    expected.emplace(id, term);
+    ids.push_back(id);
+    if (i % 3 == 0)
+    {
+      uint64_t erase = ids[i / 2];
+      if (expected.erase(erase))
+      {
+        table.erase(erase);
+      }
+    }
+  }
+  ASSERT_EQ(table.size(), expected.size());
+  for (uint64_t id : ids)
+  {
+    auto it = expected.find(id);
+    ASSERT_EQ(table.find(id), it == expected.end() ? nullptr : it->second);
+  }
 
   bitwuzla_term_manager_delete(tm);
 }
@@ -5227,7 +5450,7 @@ TEST_F(TestCApi, term_mgr_release)
 
   auto t1 = bitwuzla_mk_true(tm);
   ASSERT_EQ(t1->d_refs, 1);
-  ASSERT_EQ(tm->d_alloc_terms.size(), 1);
+  ASSERT_EQ(tm->d_num_alloc_terms, 1);
   ASSERT_TRUE(tm->d_alloc_sorts.empty());
 
   auto s1 = bitwuzla_mk_bool_sort(tm);
@@ -5237,7 +5460,7 @@ TEST_F(TestCApi, term_mgr_release)
   ASSERT_EQ(s2->d_refs, 2);
 
   bitwuzla_term_manager_release(tm);
-  ASSERT_TRUE(tm->d_alloc_terms.empty());
+  ASSERT_EQ(tm->d_num_alloc_terms, 0);
   ASSERT_TRUE(tm->d_alloc_sorts.empty());
 
   bitwuzla_term_manager_delete(tm);
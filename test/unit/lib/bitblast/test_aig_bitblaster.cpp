@@ -87,6 +87,10 @@ class TestAigBitblaster : public TestCommon
   {
     for (size_t i = 0; i < bits.size(); ++i)
     {
+      if (bits[i].is_true() || bits[i].is_false())
+      {
+        continue;
+      }
       ss << "(declare-const ";
       bitblast::aig::Smt2Printer::print(ss, bits[i]);
       ss << " (_ BitVec 1))\n";
@@ -118,6 +122,16 @@ class TestAigBitblaster : public TestCommon
     test_binary(op, res, a, b);      \
   }
 
+#define TEST_MUL(size, encoding)                          \
+  {                                                       \
+    bitblast::AigBitblaster bb;                           \
+    bb.set_mul_encoding(bitblast::MulEncoding::encoding); \
+    auto a   = bb.bv_constant(size);                      \
+    auto b   = bb.bv_constant(size);                      \
+    auto res = bb.bv_mul(a, b);                           \
+    test_binary("bvmul", res, a, b);                      \
+  }
+
 TEST_F(TestAigBitblaster, ctor_dtor) { bitblast::AigBitblaster bb; }
 
 TEST_F(TestAigBitblaster, bv_value)
@@ -324,6 +338,38 @@ TEST_F(TestAigBitblaster, bv_mul4) { TEST_BIN_OP(4, "bvmul", bv_mul); }
 
 TEST_F(TestAigBitblaster, bv_mul8) { TEST_BIN_OP(8, "bvmul", bv_mul); }
 
+TEST_F(TestAigBitblaster, bv_mul_dadda1) { TEST_MUL(1, DADDA); }
+
+TEST_F(TestAigBitblaster, bv_mul_dadda2) { TEST_MUL(2, DADDA); }
+
+TEST_F(TestAigBitblaster, bv_mul_dadda3) { TEST_MUL(3, DADDA); }
+
+TEST_F(TestAigBitblaster, bv_mul_dadda8) { TEST_MUL(8, DADDA); }
+
+TEST_F(TestAigBitblaster, bv_mul_dadda_value)
+{
+  for (uint64_t value : {0u, 1u, 6u, 7u, 85u, 255u})
+  {
+    bitblast::AigBitblaster bb;
+    bb.set_mul_encoding(bitblast::MulEncoding::DADDA);
+    auto a   = bb.bv_constant(8);
+    auto b   = bb.bv_value(BitVector::from_ui(8, value));
+    auto res = bb.bv_mul(a, b);
+    test_binary("bvmul", res, a, b);
+  }
+}
+
+TEST_F(TestAigBitblaster, bv_mul_karatsuba)
+{
+  bitblast::AigBitblaster bb;
+  bb.set_mul_encoding(bitblast::MulEncoding::KARATSUBA);
+  auto zero = bb.bv_value(BitVector::mk_zero(16));
+  auto a    = bb.bv_concat(zero, bb.bv_constant(16));
+  auto b    = bb.bv_concat(zero, bb.bv_constant(16));
+  auto res  = bb.bv_mul(a, b);
+  test_binary("bvmul", res, a, b);
+}
+
 TEST_F(TestAigBitblaster, bv_udiv)
 {
   bitblast::AigBitblaster bb;
@@ -56,6 +56,12 @@ class DummySatSolver : public bitblast::SatInterface
     return false;
   }
 
+  int32_t fixed(int64_t lit) override
+  {
+    (void) lit;
+    return 0;
+  }
+
   std::string to_dimacs() const
   {
     std::stringstream ss;
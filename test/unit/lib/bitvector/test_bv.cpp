@@ -3253,6 +3253,32 @@ TEST_F(TestBitVector, ctor_dtor)
   ASSERT_DEATH_DEBUG(BitVector::from_ui(16, 65536), "fits_in_size");
 }
 
+TEST_F(TestBitVector, from_limbs)
+{
+  ASSERT_EQ(BitVector::from_limbs(11, {1234}).str(), "10011010010");
+  ASSERT_EQ(BitVector::from_limbs(6, {141}).str(), "001101");
+  ASSERT_EQ(BitVector::from_limbs(64, {UINT64_MAX}), BitVector::mk_ones(64));
+  ASSERT_EQ(BitVector::from_limbs(68, {3, 0}), BitVector::from_ui(68, 3));
+  ASSERT_EQ(BitVector::from_limbs(68, {UINT64_MAX, UINT64_MAX}),
+            BitVector::mk_ones(68));
+  ASSERT_EQ(BitVector::from_limbs(130, {0, 0, 2}).str(16),
+            "200000000000000000000000000000000");
+  for (uint64_t size = 1; size <= 200; ++size)
+  {
+    BitVector bv(size, *d_rng);
+    std::vector<uint64_t> limbs((size + 63) / 64);
+    for (size_t i = 0; i < size; ++i)
+    {
+      if (bv.bit(i))
+      {
+        limbs[i / 64] |= uint64_t{1} << (i % 64);
+      }
+    }
+    ASSERT_EQ(BitVector::from_limbs(size, limbs), bv);
+  }
+  ASSERT_DEATH_DEBUG(BitVector::from_limbs(68, {3}), "limbs.size()");
+}
+
 TEST_F(TestBitVector, ctor_rand)
 {
   for (uint64_t size = 1; size <= 127; ++size)
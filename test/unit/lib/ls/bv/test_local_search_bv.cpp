@@ -10,6 +10,7 @@
 
 #include <map>
 
+#include "ls/internal.h"
 #include "ls/ls_bv.h"
 #include "test_bvnode.h"
 
@@ -824,6 +825,233 @@ TEST_F(TestLsBv, update_cone)
   }
 }
 
+TEST_F(TestLsBv, updated_inputs)
+{
+  ASSERT_TRUE(d_ls->get_updated_inputs().empty());
+  update_cone(d_v1, d_one4);
+  update_cone(d_v3, d_fiv4);
+  update_cone(d_v1, d_zero4);
+  // Setting the current assignment is not an update.
+  update_cone(d_v2, d_ones4);
+  ASSERT_EQ(d_ls->get_updated_inputs(),
+            std::unordered_set<uint64_t>({d_v1, d_v3}));
+  d_ls->clear_updated_inputs();
+  ASSERT_TRUE(d_ls->get_updated_inputs().empty());
+  update_cone(d_v2, d_zero4);
+  ASSERT_EQ(d_ls->get_updated_inputs(), std::unordered_set<uint64_t>({d_v2}));
+}
+
+TEST_F(TestLsBv, fix_bits)
+{
+  // v1 = 0000, fixing 0xx1 must update v1 and its cone
+  BitVectorDomain d1(4);
+  d1.fix_bit(3, false);
+  d1.fix_bit(0, true);
+  ASSERT_EQ(d_ls->fix_bits(d_v1, d1), 2);
+  ASSERT_TRUE(d_ls->get_domain(d_v1).is_fixed_bit_false(3));
+  ASSERT_TRUE(d_ls->get_domain(d_v1).is_fixed_bit_true(0));
+  ASSERT_EQ(d_ls->get_assignment(d_v1).compare(d_one4), 0);
+  ASSERT_EQ(d_ls->get_assignment(d_v1pc1).compare(d_ele4), 0);
+  ASSERT_EQ(d_ls->get_assignment(d_v1e).compare(d_one1), 0);
+  ASSERT_EQ(d_ls->get_assignment(d_v3sc1pv3pv1).compare(d_sev4), 0);
+
+  // already fixed bits are not counted
+  ASSERT_EQ(d_ls->fix_bits(d_v1, d1), 0);
+
+  // v2 = 1111 matches 1xxx, assignment is not updated
+  BitVectorDomain d2(4);
+  d2.fix_bit(3, true);
+  ASSERT_EQ(d_ls->fix_bits(d_v2, d2), 1);
+  ASSERT_EQ(d_ls->get_assignment(d_v2).compare(d_ones4), 0);
+  ASSERT_EQ(d_ls->get_assignment(d_v1pv2).compare(d_zero4), 0);
+}
+
+TEST_F(TestLsBv, propagate_fixpoint)
+{
+  BitVector c5    = BitVector::from_ui(4, 5);
+  BitVector c4    = BitVector::from_ui(8, 4);
+  BitVector c15   = BitVector::from_ui(8, 15);
+  BitVector ones8 = BitVector::mk_ones(8);
+  LocalSearchBV ls(100, 100);
+  uint64_t v1 = ls.mk_node(NodeKind::CONST, 8);
+  uint64_t v2 = ls.mk_node(NodeKind::CONST, 8);
+  uint64_t v3 = ls.mk_node(NodeKind::CONST, 8);
+  // v1[7:4] = 0101
+  ls.register_root(
+      ls.mk_node(NodeKind::EQ,
+                 1,
+                 {ls.mk_node(NodeKind::BV_EXTRACT, 4, {v1}, {7, 4}),
+                  ls.mk_node(c5, BitVectorDomain(c5))}));
+  // v1 ^ v2 = 11111111
+  ls.register_root(
+      ls.mk_node(NodeKind::EQ,
+                 1,
+                 {ls.mk_node(NodeKind::BV_XOR, 8, {v1, v2}),
+                  ls.mk_node(ones8, BitVectorDomain(ones8))}));
+  // v3 < 4
+  ls.register_root(ls.mk_node(
+      NodeKind::BV_ULT, 1, {v3, ls.mk_node(c4, BitVectorDomain(c4))}));
+
+  // roots above level 0 are not considered
+  ls.push();
+  ls.register_root(ls.mk_node(
+      NodeKind::BV_ULT, 1, {v2, ls.mk_node(c15, BitVectorDomain(c15))}));
+
+  ASSERT_EQ(ls.propagate_fixpoint(), 14);
+  ASSERT_EQ(ls.get_domain(v1), BitVectorDomain("0101xxxx"));
+  ASSERT_EQ(ls.get_domain(v2), BitVectorDomain("1010xxxx"));
+  ASSERT_EQ(ls.get_domain(v3), BitVectorDomain("000000xx"));
+  ASSERT_TRUE(ls.get_domain(v1).match_fixed_bits(ls.get_assignment(v1)));
+  ASSERT_TRUE(ls.get_domain(v2).match_fixed_bits(ls.get_assignment(v2)));
+  ASSERT_EQ(ls.propagate_fixpoint(), 0);
+
+  // conflict: v < 0, no bits are fixed
+  LocalSearchBV ls2(100, 100);
+  BitVector zero8 = BitVector::mk_zero(8);
+  uint64_t v      = ls2.mk_node(NodeKind::CONST, 8);
+  ls2.register_root(ls2.mk_node(
+      NodeKind::BV_ULT, 1, {v, ls2.mk_node(zero8, BitVectorDomain(zero8))}));
+  ASSERT_EQ(ls2.propagate_fixpoint(), 0);
+  ASSERT_FALSE(ls2.get_domain(v).has_fixed_bits());
+}
+
+TEST_F(TestLsBv, compute_score)
+{
+  BitVector fiv8 = BitVector::from_ui(8, 5);
+  LocalSearchBV ls(100, 100);
+  uint64_t c  = ls.mk_node(fiv8, BitVectorDomain(fiv8));
+  uint64_t v  = ls.mk_node(NodeKind::CONST, 8);
+  uint64_t eq = ls.mk_node(NodeKind::EQ, 1, {v, c});
+  uint64_t lt = ls.mk_node(NodeKind::BV_ULT, 1, {c, v});
+  ls.register_root(eq);
+  ls.register_root(lt);
+
+  // v = 0: 2 bits differ from 5, 5 - 0 has 3 significant bits
+  double score_eq = ls.compute_score(ls.get_node(eq));
+  double score_lt = ls.compute_score(ls.get_node(lt));
+  ASSERT_DOUBLE_EQ(score_eq, 1.0 - 2.0 / 9);
+  ASSERT_DOUBLE_EQ(score_lt, 1.0 - 4.0 / 9);
+
+  // v = 4: 1 bit differs from 5, 5 - 4 has 1 significant bit
+  ls.set_assignment(v, BitVector::from_ui(8, 4));
+  ls.get_node(eq)->evaluate();
+  ls.get_node(lt)->evaluate();
+  ASSERT_GT(ls.compute_score(ls.get_node(eq)), score_eq);
+  ASSERT_GT(ls.compute_score(ls.get_node(lt)), score_lt);
+}
+
+TEST_F(TestLsBv, move_score)
+{
+  LocalSearchBV ls(0, 0);
+  ls.d_options.num_cand_moves = 4;
+  uint64_t c   = ls.mk_node(d_ten4, BitVectorDomain(d_ten4));
+  uint64_t v1  = ls.mk_node(NodeKind::CONST, TEST_BW);
+  uint64_t v2  = ls.mk_node(NodeKind::CONST, TEST_BW);
+  uint64_t add = ls.mk_node(NodeKind::BV_ADD, TEST_BW, {v1, v2});
+  ls.register_root(ls.mk_node(NodeKind::EQ, 1, {add, c}));
+  ls.register_root(ls.mk_node(NodeKind::BV_ULT, 1, {v1, v2}));
+  ls.register_root(ls.mk_node(NodeKind::BV_ULT, 1, {v2, c}));
+
+  Result res = Result::UNKNOWN;
+  for (uint32_t i = 0; i < 1000 && res == Result::UNKNOWN; ++i)
+  {
+    res = ls.move();
+  }
+  ASSERT_EQ(res, Result::SAT);
+  const BitVector& a1 = ls.get_assignment(v1);
+  const BitVector& a2 = ls.get_assignment(v2);
+  ASSERT_EQ(a1.bvadd(a2).compare(d_ten4), 0);
+  ASSERT_LT(a1.compare(a2), 0);
+  ASSERT_LT(a2.compare(d_ten4), 0);
+}
+
+TEST_F(TestLsBv, move_score_updates)
+{
+  LocalSearchBV ls(0, 0);
+  ls.d_options.num_cand_moves = 4;
+  ls.d_options.restart_base   = 1;
+  uint64_t c   = ls.mk_node(d_ten4, BitVectorDomain(d_ten4));
+  uint64_t v1  = ls.mk_node(NodeKind::CONST, TEST_BW);
+  uint64_t v2  = ls.mk_node(NodeKind::CONST, TEST_BW);
+  uint64_t mul = ls.mk_node(NodeKind::BV_MUL, TEST_BW, {v1, v2});
+  ls.register_root(ls.mk_node(NodeKind::EQ, 1, {mul, c}));
+  ls.register_root(ls.mk_node(NodeKind::BV_ULT, 1, {v1, v2}));
+  ls.register_root(ls.mk_node(NodeKind::BV_ULT, 1, {v2, c}));
+
+  auto& stats = ls.d_internal->d_stats;
+  Result res  = Result::UNKNOWN;
+  for (uint32_t i = 0; i < 1000 && res == Result::UNKNOWN; ++i)
+  {
+    uint64_t num_updates = stats.num_updates;
+    uint64_t num_cand    = stats.num_cand_moves;
+    res                  = ls.move();
+    // Scoring candidates is not counted as updates.
+    if (stats.num_cand_moves > num_cand)
+    {
+      ASSERT_GT(stats.num_cand_updates, 0);
+    }
+    ASSERT_GE(stats.num_updates, num_updates);
+    // The committed cone is consistent with the assignment of the inputs.
+    ASSERT_EQ(ls.get_assignment(mul).compare(
+                  ls.get_assignment(v1).bvmul(ls.get_assignment(v2))),
+              0);
+    // The cached sum of scores is consistent with the unsatisfied roots.
+    double score = 0;
+    for (uint64_t id : ls.d_roots_unsat)
+    {
+      score += ls.compute_score(ls.get_node(id));
+    }
+    ASSERT_NEAR(ls.d_score, score, 1e-9);
+  }
+  ASSERT_EQ(res, Result::SAT);
+  ASSERT_GT(stats.num_restarts, 0);
+}
+
+TEST_F(TestLsBv, move_restart_tabu)
+{
+  LocalSearchBV ls(0, 0);
+  ls.d_options.restart_base = 2;
+  ls.d_options.prob_perturb = 500;
+  ls.d_options.tabu_tenure  = 1;
+  uint64_t c   = ls.mk_node(d_ten4, BitVectorDomain(d_ten4));
+  uint64_t v1  = ls.mk_node(NodeKind::CONST, TEST_BW);
+  uint64_t v2  = ls.mk_node(NodeKind::CONST, TEST_BW);
+  uint64_t mul = ls.mk_node(NodeKind::BV_MUL, TEST_BW, {v1, v2});
+  ls.register_root(ls.mk_node(NodeKind::EQ, 1, {mul, c}));
+  ls.register_root(ls.mk_node(NodeKind::BV_ULT, 1, {v1, v2}));
+
+  Result res = Result::UNKNOWN;
+  for (uint32_t i = 0; i < 1000 && res == Result::UNKNOWN; ++i)
+  {
+    res = ls.move();
+  }
+  ASSERT_EQ(res, Result::SAT);
+  const BitVector& a1 = ls.get_assignment(v1);
+  const BitVector& a2 = ls.get_assignment(v2);
+  ASSERT_EQ(a1.bvmul(a2).compare(d_ten4), 0);
+  ASSERT_LT(a1.compare(a2), 0);
+}
+
+TEST_F(TestLsBv, restart_luby)
+{
+  LocalSearchBV ls(0, 0);
+  ls.d_options.restart_base = 1;
+  uint64_t v1 = ls.mk_node(NodeKind::CONST, TEST_BW);
+  uint64_t v2 = ls.mk_node(NodeKind::CONST, TEST_BW);
+  ls.register_root(ls.mk_node(NodeKind::BV_ULT, 1, {v1, v2}));
+  ls.register_root(ls.mk_node(NodeKind::BV_ULT, 1, {v2, v1}));
+
+  // Luby intervals 1, 1, 2, 1, 1, 2, 4: the first restart is scheduled on
+  // the first move, restarts are performed after 1, 2, 4, 5, 6 and 8 moves
+  // and the next one is due after 12 moves.
+  for (uint32_t i = 0; i < 12; ++i)
+  {
+    ASSERT_EQ(ls.move(), Result::UNKNOWN);
+  }
+  ASSERT_EQ(ls.d_num_restarts, 7);
+  ASSERT_EQ(ls.d_next_restart, 12);
+}
+
 TEST_F(TestLsBv, move_add)
 {
   test_move_binary(NodeKind::BV_ADD, 0);
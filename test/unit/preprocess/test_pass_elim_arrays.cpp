@@ -0,0 +1,162 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "backtrack/backtrackable.h"
+#include "gtest/gtest.h"
+#include "node/node_ref_vector.h"
+#include "preprocess/pass/elim_arrays.h"
+#include "test/unit/preprocess/test_preprocess_pass.h"
+
+namespace bzla::test {
+
+using namespace backtrack;
+using namespace node;
+
+class TestPassElimArrays : public TestPreprocessingPass
+{
+ public:
+  TestPassElimArrays() : d_env(d_nm), d_pass(d_env, &d_bm){};
+
+ protected:
+  /** @return True if node contains array terms. */
+  static bool has_arrays(const Node& node)
+  {
+    std::unordered_set<Node> cache;
+    node_ref_vector visit{node};
+    do
+    {
+      const Node& cur = visit.back();
+      visit.pop_back();
+      if (cache.insert(cur).second)
+      {
+        if (cur.type().is_array())
+        {
+          return true;
+        }
+        visit.insert(visit.end(), cur.begin(), cur.end());
+      }
+    } while (!visit.empty());
+    return false;
+  }
+
+  Env d_env;
+  preprocess::pass::PassElimArrays d_pass;
+};
+
+TEST_F(TestPassElimArrays, small_select)
+{
+  Type bv2  = d_nm.mk_bv_type(2);
+  Type bv8  = d_nm.mk_bv_type(8);
+  Node a    = d_nm.mk_const(d_nm.mk_array_type(bv2, bv8), "a");
+  Node i    = d_nm.mk_const(bv2, "i");
+  Node j    = d_nm.mk_const(bv2, "j");
+  Node sel1 = d_nm.mk_node(Kind::SELECT, {a, i});
+  Node sel2 = d_nm.mk_node(Kind::SELECT, {a, j});
+
+  d_as.push_back(d_nm.mk_node(Kind::DISTINCT, {sel1, sel2}));
+  preprocess::AssertionVector assertions(d_as.view());
+  d_pass.apply(assertions);
+
+  ASSERT_EQ(d_as.size(), 1);
+  ASSERT_FALSE(has_arrays(d_as[0]));
+  ASSERT_EQ(d_pass.process(a).kind(), Kind::STORE);
+}
+
+TEST_F(TestPassElimArrays, small_store_equal)
+{
+  Type bv4  = d_nm.mk_bv_type(4);
+  Type type = d_nm.mk_array_type(d_nm.mk_bool_type(), bv4);
+  Node a    = d_nm.mk_const(type, "a");
+  Node b    = d_nm.mk_const(type, "b");
+  Node p    = d_nm.mk_const(d_nm.mk_bool_type(), "p");
+  Node e    = d_nm.mk_const(bv4, "e");
+
+  d_as.push_back(
+      d_nm.mk_node(Kind::EQUAL, {d_nm.mk_node(Kind::STORE, {a, p, e}), b}));
+  preprocess::AssertionVector assertions(d_as.view());
+  d_pass.apply(assertions);
+
+  ASSERT_EQ(d_as.size(), 1);
+  ASSERT_FALSE(has_arrays(d_as[0]));
+}
+
+TEST_F(TestPassElimArrays, ackermannize)
+{
+  Type bv32 = d_nm.mk_bv_type(32);
+  Node a    = d_nm.mk_const(d_nm.mk_array_type(bv32, bv32), "a");
+  Node i    = d_nm.mk_const(bv32, "i");
+  Node j    = d_nm.mk_const(bv32, "j");
+  Node k    = d_nm.mk_const(bv32, "k");
+  Node sel1 = d_nm.mk_node(Kind::SELECT, {a, i});
+  Node sel2 = d_nm.mk_node(Kind::SELECT, {a, j});
+  Node sel3 = d_nm.mk_node(Kind::SELECT, {a, k});
+
+  d_as.push_back(d_nm.mk_node(Kind::DISTINCT, {sel1, sel2}));
+  d_as.push_back(d_nm.mk_node(Kind::EQUAL, {sel3, i}));
+  preprocess::AssertionVector assertions(d_as.view());
+  d_pass.apply(assertions);
+
+  // One lemma for each pair of reads.
+  ASSERT_EQ(d_as.size(), 5);
+  for (size_t i = 0; i < d_as.size(); ++i)
+  {
+    ASSERT_FALSE(has_arrays(d_as[i]));
+  }
+  ASSERT_EQ(d_pass.process(a).kind(), Kind::STORE);
+}
+
+TEST_F(TestPassElimArrays, ackermannize_blocked)
+{
+  Type bv32 = d_nm.mk_bv_type(32);
+  Type type = d_nm.mk_array_type(bv32, bv32);
+  Node a    = d_nm.mk_const(type, "a");
+  Node b    = d_nm.mk_const(type, "b");
+  Node i    = d_nm.mk_const(bv32, "i");
+  Node j    = d_nm.mk_const(bv32, "j");
+
+  Node as1 = d_nm.mk_node(Kind::DISTINCT,
+                          {d_nm.mk_node(Kind::SELECT, {a, i}),
+                           d_nm.mk_node(Kind::SELECT, {a, j})});
+  Node as2 = d_nm.mk_node(Kind::EQUAL, {a, b});
+  d_as.push_back(as1);
+  d_as.push_back(as2);
+  preprocess::AssertionVector assertions(d_as.view());
+  d_pass.apply(assertions);
+
+  ASSERT_EQ(d_as.size(), 2);
+  ASSERT_EQ(d_as[0], as1);
+  ASSERT_EQ(d_as[1], as2);
+  ASSERT_EQ(d_pass.process(a), a);
+}
+
+TEST_F(TestPassElimArrays, ackermannize_thresh)
+{
+  Type bv32 = d_nm.mk_bv_type(32);
+  Node a    = d_nm.mk_const(d_nm.mk_array_type(bv32, bv32), "a");
+
+  d_options.pp_elim_arrays_thresh.set(2);
+  Env env(d_nm, d_options);
+  preprocess::pass::PassElimArrays pass(env, &d_bm);
+
+  std::vector<Node> reads;
+  for (size_t i = 0; i < 3; ++i)
+  {
+    reads.push_back(d_nm.mk_node(Kind::SELECT, {a, d_nm.mk_const(bv32)}));
+  }
+  Node as = d_nm.mk_node(Kind::DISTINCT, reads);
+  d_as.push_back(as);
+  preprocess::AssertionVector assertions(d_as.view());
+  pass.apply(assertions);
+
+  ASSERT_EQ(d_as.size(), 1);
+  ASSERT_EQ(d_as[0], as);
+}
+
+}  // namespace bzla::test
@@ -0,0 +1,152 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "backtrack/backtrackable.h"
+#include "bv/bitvector.h"
+#include "gtest/gtest.h"
+#include "preprocess/pass/known_bits.h"
+#include "test/unit/preprocess/test_preprocess_pass.h"
+
+namespace bzla::test {
+
+using namespace backtrack;
+using namespace node;
+
+class TestPassKnownBits : public TestPreprocessingPass
+{
+ public:
+  TestPassKnownBits() : d_env(d_nm), d_pass(d_env, &d_bm){};
+
+ protected:
+  /** @return The term `c` is substituted with, null if there is none. */
+  Node substitution(const Node& c)
+  {
+    for (size_t i = 0; i < d_as.size(); ++i)
+    {
+      if (d_as[i].kind() == Kind::EQUAL && d_as[i][0] == c)
+      {
+        return d_as[i][1];
+      }
+    }
+    return Node();
+  }
+
+  Env d_env;
+  preprocess::pass::PassKnownBits d_pass;
+};
+
+TEST_F(TestPassKnownBits, narrow)
+{
+  Type bv4 = d_nm.mk_bv_type(4);
+  Type bv8 = d_nm.mk_bv_type(8);
+  Node x   = d_nm.mk_const(bv8, "x");
+  Node y   = d_nm.mk_const(bv8, "y");
+
+  // x[7:4] = 0101, x ^ y = 11111111
+  d_as.push_back(d_nm.mk_node(
+      Kind::EQUAL,
+      {d_nm.mk_node(Kind::BV_EXTRACT, {x}, {7, 4}),
+       d_nm.mk_value(BitVector::from_ui(4, 5))}));
+  d_as.push_back(d_nm.mk_node(
+      Kind::EQUAL,
+      {d_nm.mk_node(Kind::BV_XOR, {x, y}),
+       d_nm.mk_value(BitVector::mk_ones(8))}));
+  preprocess::AssertionVector assertions(d_as.view());
+  d_pass.apply(assertions);
+
+  ASSERT_EQ(d_as.size(), 4);
+  Node sx = substitution(x);
+  Node sy = substitution(y);
+  ASSERT_FALSE(sx.is_null());
+  ASSERT_FALSE(sy.is_null());
+  ASSERT_EQ(sx.kind(), Kind::BV_CONCAT);
+  ASSERT_EQ(sx[0], d_nm.mk_value(BitVector::from_ui(4, 5)));
+  ASSERT_TRUE(sx[1].is_const());
+  ASSERT_EQ(sx[1].type(), bv4);
+  ASSERT_EQ(sy.kind(), Kind::BV_CONCAT);
+  ASSERT_EQ(sy[0], d_nm.mk_value(BitVector::from_ui(4, 10)));
+
+  // constants are only substituted once
+  preprocess::AssertionVector assertions2(d_as.view());
+  d_pass.apply(assertions2);
+  ASSERT_EQ(d_as.size(), 4);
+}
+
+TEST_F(TestPassKnownBits, ineq_bounds)
+{
+  Type bv8 = d_nm.mk_bv_type(8);
+  Node x   = d_nm.mk_const(bv8, "x");
+
+  // x < 4 implies x[7:2] = 000000, the assertion itself must be kept
+  Node as = d_nm.mk_node(Kind::BV_ULT,
+                         {x, d_nm.mk_value(BitVector::from_ui(8, 4))});
+  d_as.push_back(as);
+  preprocess::AssertionVector assertions(d_as.view());
+  d_pass.apply(assertions);
+
+  ASSERT_EQ(d_as.size(), 2);
+  ASSERT_EQ(d_as[0], as);
+  Node sx = substitution(x);
+  ASSERT_FALSE(sx.is_null());
+  ASSERT_EQ(sx.kind(), Kind::BV_CONCAT);
+  ASSERT_EQ(sx[0], d_nm.mk_value(BitVector::mk_zero(6)));
+}
+
+TEST_F(TestPassKnownBits, simplify)
+{
+  Type bv8 = d_nm.mk_bv_type(8);
+  Node x   = d_nm.mk_const(bv8, "x");
+  Node y   = d_nm.mk_const(bv8, "y");
+  Node p   = d_nm.mk_const(d_nm.mk_bool_type(), "p");
+
+  // (x & 00001111) < 00010000 is decided by ranges
+  Node bvand = d_nm.mk_node(Kind::BV_AND,
+                            {x, d_nm.mk_value(BitVector::from_ui(8, 15))});
+  d_as.push_back(d_nm.mk_node(
+      Kind::OR,
+      {p,
+       d_nm.mk_node(Kind::BV_ULT,
+                    {bvand, d_nm.mk_value(BitVector::from_ui(8, 16))})}));
+  // (y << 1)[0:0] = 1 is false
+  Node shl = d_nm.mk_node(Kind::BV_SHL,
+                          {y, d_nm.mk_value(BitVector::from_ui(8, 1))});
+  Node ext = d_nm.mk_node(Kind::BV_EXTRACT, {shl}, {0, 0});
+  Node as  = d_nm.mk_node(
+      Kind::OR,
+      {p,
+       d_nm.mk_node(Kind::EQUAL,
+                    {ext, d_nm.mk_value(BitVector::mk_one(1))})});
+  d_as.push_back(as);
+  preprocess::AssertionVector assertions(d_as.view());
+  d_pass.apply(assertions);
+
+  ASSERT_EQ(d_as.size(), 2);
+  ASSERT_EQ(d_as[0], d_nm.mk_value(true));
+  ASSERT_EQ(d_as[1], d_env.rewriter().rewrite(p));
+}
+
+TEST_F(TestPassKnownBits, conflict)
+{
+  Type bv8 = d_nm.mk_bv_type(8);
+  Node x   = d_nm.mk_const(bv8, "x");
+
+  d_as.push_back(d_nm.mk_node(
+      Kind::EQUAL,
+      {d_nm.mk_node(Kind::BV_EXTRACT, {x}, {7, 4}),
+       d_nm.mk_value(BitVector::from_ui(4, 5))}));
+  d_as.push_back(d_nm.mk_node(
+      Kind::BV_ULT, {x, d_nm.mk_value(BitVector::from_ui(8, 16))}));
+  preprocess::AssertionVector assertions(d_as.view());
+  d_pass.apply(assertions);
+
+  ASSERT_TRUE(assertions.is_inconsistent());
+}
+
+}  // namespace bzla::test
@@ -0,0 +1,224 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+
+#include "sat/sat_solver.h"
+#include "sat/sat_solver_factory.h"
+#include "test/unit/test.h"
+
+namespace bzla::test {
+
+class TestSatSolver : public TestCommon
+{
+ protected:
+  void add_clause(sat::SatSolver& solver,
+                  const std::initializer_list<int32_t>& literals)
+  {
+    for (int32_t lit : literals)
+    {
+      solver.add(lit);
+    }
+    solver.add(0);
+  }
+
+  /**
+   * Add pigeon hole formula with given number of holes and one more pigeon,
+   * which is unsatisfiable but requires many conflicts.
+   */
+  void add_php(sat::SatSolver& solver, int32_t holes)
+  {
+    auto var = [holes](int32_t p, int32_t h) { return p * holes + h + 1; };
+    for (int32_t p = 0; p <= holes; ++p)
+    {
+      for (int32_t h = 0; h < holes; ++h)
+      {
+        solver.add(var(p, h));
+      }
+      solver.add(0);
+    }
+    for (int32_t h = 0; h < holes; ++h)
+    {
+      for (int32_t p = 0; p <= holes; ++p)
+      {
+        for (int32_t q = p + 1; q <= holes; ++q)
+        {
+          add_clause(solver, {-var(p, h), -var(q, h)});
+        }
+      }
+    }
+  }
+
+  /** Test phases of incremental solver. */
+  void test_phase(option::SatSolver kind)
+  {
+    std::unique_ptr<sat::SatSolver> solver(sat::new_sat_solver(kind));
+    // Exactly one of 1 and 2 is true.
+    add_clause(*solver, {1, 2});
+    add_clause(*solver, {-1, -2});
+    add_clause(*solver, {1, 2, 3});
+
+    // Assumptions disable lucky phases, which would ignore the preferred
+    // phases.
+    solver->phase(1);
+    solver->phase(-2);
+    solver->assume(3);
+    ASSERT_EQ(solver->solve(), Result::SAT);
+    ASSERT_EQ(solver->value(1), 1);
+    ASSERT_EQ(solver->value(2), -1);
+
+    solver->unphase(1);
+    solver->unphase(2);
+    solver->phase(-1);
+    solver->phase(2);
+    solver->assume(3);
+    ASSERT_EQ(solver->solve(), Result::SAT);
+    ASSERT_EQ(solver->value(1), -1);
+    ASSERT_EQ(solver->value(2), 1);
+  }
+
+  /** Test freezing of incremental solver. */
+  void test_freeze_melt(option::SatSolver kind)
+  {
+    std::unique_ptr<sat::SatSolver> solver(sat::new_sat_solver(kind));
+    // 1 <-> 2 <-> 3
+    add_clause(*solver, {-1, 2});
+    add_clause(*solver, {1, -2});
+    add_clause(*solver, {-2, 3});
+    add_clause(*solver, {2, -3});
+
+    // Freezing is reference counted.
+    solver->freeze(1);
+    solver->freeze(1);
+    solver->freeze(3);
+    solver->assume(1);
+    ASSERT_EQ(solver->solve(), Result::SAT);
+    ASSERT_EQ(solver->value(3), 1);
+    solver->melt(1);
+    solver->assume(-1);
+    solver->assume(3);
+    ASSERT_EQ(solver->solve(), Result::UNSAT);
+    ASSERT_TRUE(solver->failed(-1) || solver->failed(3));
+    solver->melt(1);
+    solver->melt(3);
+    // Melted variables can still be used.
+    add_clause(*solver, {-3});
+    ASSERT_EQ(solver->solve(), Result::SAT);
+    ASSERT_EQ(solver->value(1), -1);
+  }
+
+  /** Test conflict limit of incremental solver. */
+  void test_conflict_limit(option::SatSolver kind)
+  {
+    std::unique_ptr<sat::SatSolver> solver(sat::new_sat_solver(kind));
+    add_php(*solver, 5);
+    solver->set_conflict_limit(1);
+    ASSERT_EQ(solver->solve(), Result::UNKNOWN);
+    // The limit only applies to the next call.
+    ASSERT_EQ(solver->solve(), Result::UNSAT);
+    solver->set_conflict_limit(-1);
+    ASSERT_EQ(solver->solve(), Result::UNSAT);
+  }
+};
+
+TEST_F(TestSatSolver, cadical_phase) { test_phase(option::SatSolver::CADICAL); }
+
+TEST_F(TestSatSolver, cadical_freeze_melt)
+{
+  test_freeze_melt(option::SatSolver::CADICAL);
+}
+
+TEST_F(TestSatSolver, cadical_conflict_limit)
+{
+  test_conflict_limit(option::SatSolver::CADICAL);
+}
+
+TEST_F(TestSatSolver, cadical_decision_limit)
+{
+  std::unique_ptr<sat::SatSolver> solver(
+      sat::new_sat_solver(option::SatSolver::CADICAL));
+  add_php(*solver, 5);
+  solver->set_decision_limit(1);
+  ASSERT_EQ(solver->solve(), Result::UNKNOWN);
+  // The limit only applies to the next call.
+  ASSERT_EQ(solver->solve(), Result::UNSAT);
+}
+
+TEST_F(TestSatSolver, cadical_trace_proof)
+{
+  for (auto format : {sat::ProofFormat::DRAT, sat::ProofFormat::LRAT})
+  {
+    std::string filename = "sat_trace_proof.out";
+    {
+      std::unique_ptr<sat::SatSolver> solver(
+          sat::new_sat_solver(option::SatSolver::CADICAL));
+      ASSERT_TRUE(solver->trace_proof(filename, format));
+      add_php(*solver, 4);
+      ASSERT_EQ(solver->solve(), Result::UNSAT);
+    }
+    std::ifstream ifs(filename, std::ios::binary | std::ios::ate);
+    ASSERT_TRUE(ifs.is_open());
+    ASSERT_GT(ifs.tellg(), 0);
+    ifs.close();
+    std::remove(filename.c_str());
+  }
+}
+
+#ifdef BZLA_USE_KISSAT
+// Kissat is not incremental and does not support phases and freezing, which
+// must be ignored.
+
+TEST_F(TestSatSolver, kissat_phase_freeze)
+{
+  std::unique_ptr<sat::SatSolver> solver(
+      sat::new_sat_solver(option::SatSolver::KISSAT));
+  ASSERT_STREQ(solver->get_name(), "Kissat");
+  add_clause(*solver, {1, 2});
+  add_clause(*solver, {-1, -2});
+  solver->phase(1);
+  solver->phase(-2);
+  solver->unphase(2);
+  solver->freeze(1);
+  solver->melt(1);
+  ASSERT_EQ(solver->solve(), Result::SAT);
+  ASSERT_EQ(solver->value(1), -solver->value(2));
+}
+
+TEST_F(TestSatSolver, kissat_conflict_limit)
+{
+  std::unique_ptr<sat::SatSolver> solver(
+      sat::new_sat_solver(option::SatSolver::KISSAT));
+  ASSERT_STREQ(solver->get_name(), "Kissat");
+  add_php(*solver, 5);
+  solver->set_conflict_limit(1);
+  ASSERT_EQ(solver->solve(), Result::UNKNOWN);
+}
+
+TEST_F(TestSatSolver, kissat_decision_limit)
+{
+  std::unique_ptr<sat::SatSolver> solver(
+      sat::new_sat_solver(option::SatSolver::KISSAT));
+  add_php(*solver, 5);
+  solver->set_decision_limit(1);
+  ASSERT_EQ(solver->solve(), Result::UNKNOWN);
+}
+
+TEST_F(TestSatSolver, kissat_trace_proof)
+{
+  std::unique_ptr<sat::SatSolver> solver(
+      sat::new_sat_solver(option::SatSolver::KISSAT));
+  ASSERT_FALSE(
+      solver->trace_proof("sat_trace_proof.out", sat::ProofFormat::DRAT));
+}
+#endif
+
+}  // namespace bzla::test
@@ -19,6 +19,62 @@ using namespace node;
 class TestBvSolver : public TestCommon
 {
  protected:
+  /**
+   * Test lazy bit-blasting of x <kind> y = res with x fixed to given value.
+   * First check x <kind> y = res under an assertion y = wrong, which is
+   * satisfiable for the abstraction, but not for the concrete operator, i.e.,
+   * the abstraction must be refined. Then check x <kind> y = res without
+   * this assertion and check the model.
+   */
+  void test_abstraction(Kind kind,
+                        uint64_t x_val,
+                        uint64_t res_val,
+                        uint64_t wrong)
+  {
+    // Preprocessing would substitute x with its value.
+    d_options.preprocess.set(false);
+    d_options.bv_abstraction.set(true);
+    d_options.finalize();
+
+    NodeManager nm;
+    SolvingContext ctx = SolvingContext(nm, d_options);
+    auto& bb_solver = ctx.d_solver_engine.d_bv_solver.d_bitblast_solver;
+
+    Type bv8   = nm.mk_bv_type(8);
+    Node x     = nm.mk_const(bv8, "x");
+    Node y     = nm.mk_const(bv8, "y");
+    Node op    = nm.mk_node(kind, {x, y});
+    Node res   = nm.mk_value(BitVector::from_ui(8, res_val));
+    Node val_x = nm.mk_value(BitVector::from_ui(8, x_val));
+    Node val_y = nm.mk_value(BitVector::from_ui(8, wrong));
+
+    ctx.assert_formula(nm.mk_node(Kind::EQUAL, {x, val_x}));
+    ctx.assert_formula(nm.mk_node(Kind::EQUAL, {op, res}));
+
+    ctx.push();
+    ctx.assert_formula(nm.mk_node(Kind::EQUAL, {y, val_y}));
+    ASSERT_EQ(ctx.solve(), Result::UNSAT);
+    ASSERT_EQ(bb_solver.d_stats.num_abstractions, 1);
+    ASSERT_EQ(bb_solver.d_stats.num_refinements, 1);
+    ctx.pop();
+
+    // The refinement is permanent.
+    ASSERT_EQ(ctx.solve(), Result::SAT);
+    ASSERT_EQ(bb_solver.d_stats.num_abstractions, 1);
+    ASSERT_EQ(bb_solver.d_stats.num_refinements, 1);
+    BitVector a = ctx.get_value(x).value<BitVector>();
+    BitVector b = ctx.get_value(y).value<BitVector>();
+    ASSERT_EQ(a.to_uint64(), x_val);
+    BitVector val;
+    switch (kind)
+    {
+      case Kind::BV_MUL: val = a.bvmul(b); break;
+      case Kind::BV_UDIV: val = a.bvudiv(b); break;
+      default: val = a.bvurem(b);
+    }
+    ASSERT_EQ(val.to_uint64(), res_val);
+  }
+
   option::Options d_options;
 };
 
@@ -211,4 +267,49 @@ TEST_F(TestBvSolver, solve1)
   ASSERT_EQ(ctx.solve(), Result::UNSAT);
 }
 
+TEST_F(TestBvSolver, preprop_sat_slice)
+{
+  d_options.set(option::Option::BV_SOLVER, std::string("preprop"));
+  d_options.prop_nprops.set(10);
+  d_options.prop_sat_slice.set(1);
+
+  NodeManager nm;
+  SolvingContext ctx = SolvingContext(nm, d_options);
+
+  Type bv16 = nm.mk_bv_type(16);
+  Node x    = nm.mk_const(bv16);
+  Node y    = nm.mk_const(bv16);
+  Node one  = nm.mk_value(BitVector::from_ui(16, 1));
+  Node val  = nm.mk_value(BitVector::from_ui(16, 143));
+
+  ctx.assert_formula(
+      nm.mk_node(Kind::EQUAL, {nm.mk_node(Kind::BV_MUL, {x, y}), val}));
+  ctx.assert_formula(nm.mk_node(Kind::BV_UGT, {x, one}));
+  ctx.assert_formula(nm.mk_node(Kind::BV_UGT, {y, one}));
+  ASSERT_EQ(ctx.solve(), Result::SAT);
+  ASSERT_EQ(ctx.get_value(nm.mk_node(Kind::BV_MUL, {x, y})), val);
+
+  // x * x = 2 has no solution, squares of even numbers are divisible by 4.
+  ctx.assert_formula(nm.mk_node(
+      Kind::EQUAL,
+      {nm.mk_node(Kind::BV_MUL, {x, x}),
+       nm.mk_value(BitVector::from_ui(16, 2))}));
+  ASSERT_EQ(ctx.solve(), Result::UNSAT);
+}
+
+TEST_F(TestBvSolver, abstraction_mul)
+{
+  test_abstraction(Kind::BV_MUL, 3, 15, 4);
+}
+
+TEST_F(TestBvSolver, abstraction_udiv)
+{
+  test_abstraction(Kind::BV_UDIV, 15, 3, 3);
+}
+
+TEST_F(TestBvSolver, abstraction_urem)
+{
+  test_abstraction(Kind::BV_UREM, 15, 3, 5);
+}
+
 }  // namespace bzla::test
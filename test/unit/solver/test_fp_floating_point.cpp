@@ -8,11 +8,24 @@
  * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
  */
 
+#include <symfpu/core/add.h>
+#include <symfpu/core/divide.h>
+#include <symfpu/core/fma.h>
+#include <symfpu/core/multiply.h>
+#include <symfpu/core/remainder.h>
+#include <symfpu/core/sqrt.h>
+
 #include <bitset>
+#include <cfenv>
+#if defined(__SSE2__)
+#include <xmmintrin.h>
+#endif
 
 #include "node/node_manager.h"
+#include "rng/rng.h"
 #include "solver/fp/floating_point.h"
 #include "solver/fp/symfpu_nm.h"
+#include "solver/fp/symfpu_wrapper.h"
 #include "test/unit/test.h"
 
 namespace bzla::test {
@@ -80,6 +93,104 @@ class TestFp : public TestCommon
     }
   }
 
+  /**
+   * Differential test of concrete floating-point operations (which use host
+   * arithmetic for binary32 and binary64) against symFPU.
+   */
+  void test_native(const Type &type)
+  {
+    uint64_t bw_exp = type.fp_exp_size();
+    uint64_t bw_sig = type.fp_sig_size() - 1;
+    BitVector zero  = BitVector::mk_zero(1);
+    BitVector one   = BitVector::mk_one(1);
+
+    std::vector<FloatingPoint> values = {
+        FloatingPoint::fpzero(type, false),
+        FloatingPoint::fpzero(type, true),
+        FloatingPoint::fpinf(type, false),
+        FloatingPoint::fpinf(type, true),
+        FloatingPoint::fpnan(type),
+        // smallest and largest subnormal
+        FloatingPoint::fpfp(d_nm,
+                            zero,
+                            BitVector::mk_zero(bw_exp),
+                            BitVector::mk_one(bw_sig)),
+        FloatingPoint::fpfp(d_nm,
+                            one,
+                            BitVector::mk_zero(bw_exp),
+                            BitVector::mk_ones(bw_sig)),
+        // smallest normal
+        FloatingPoint::fpfp(d_nm,
+                            zero,
+                            BitVector::mk_one(bw_exp),
+                            BitVector::mk_zero(bw_sig)),
+        // largest normal
+        FloatingPoint::fpfp(d_nm,
+                            one,
+                            BitVector::mk_ones(bw_exp).ibvdec(),
+                            BitVector::mk_ones(bw_sig)),
+        FloatingPoint::from_real(d_nm, type, RoundingMode::RNE, "1.5"),
+        FloatingPoint::from_real(d_nm, type, RoundingMode::RNE, "-2.5"),
+        FloatingPoint::from_real(d_nm, type, RoundingMode::RNE, "0.1"),
+    };
+    RNG rng(1234);
+    for (size_t i = 0; i < 20; ++i)
+    {
+      values.emplace_back(type, BitVector(bw_exp + bw_sig + 1, rng));
+    }
+
+    for (const FloatingPoint &a : values)
+    {
+      for (uint32_t r = 0; r < static_cast<uint32_t>(RoundingMode::NUM_RM);
+           ++r)
+      {
+        RoundingMode rm = static_cast<RoundingMode>(r);
+        ASSERT_EQ(a.fpsqrt(rm).as_bv(),
+                  FloatingPoint(type,
+                                symfpu::sqrt<fp::SymFpuTraits>(
+                                    *a.size(), rm, *a.unpacked()))
+                      .as_bv());
+        ASSERT_EQ(a.fprti(rm).as_bv(),
+                  FloatingPoint(type,
+                                symfpu::roundToIntegral<fp::SymFpuTraits>(
+                                    *a.size(), rm, *a.unpacked()))
+                      .as_bv());
+
+        for (const FloatingPoint &b : values)
+        {
+          const UnpackedFloat &ua = *a.unpacked();
+          const UnpackedFloat &ub = *b.unpacked();
+          ASSERT_EQ(a.fpadd(rm, b).as_bv(),
+                    FloatingPoint(type,
+                                  symfpu::add<fp::SymFpuTraits>(
+                                      *a.size(), rm, ua, ub, true))
+                        .as_bv());
+          ASSERT_EQ(
+              a.fpmul(rm, b).as_bv(),
+              FloatingPoint(type,
+                            symfpu::multiply<fp::SymFpuTraits>(
+                                *a.size(), rm, ua, ub))
+                  .as_bv());
+          ASSERT_EQ(a.fpdiv(rm, b).as_bv(),
+                    FloatingPoint(type,
+                                  symfpu::divide<fp::SymFpuTraits>(
+                                      *a.size(), rm, ua, ub))
+                        .as_bv());
+          ASSERT_EQ(a.fprem(b).as_bv(),
+                    FloatingPoint(type,
+                                  symfpu::remainder<fp::SymFpuTraits>(
+                                      *a.size(), ua, ub))
+                        .as_bv());
+          ASSERT_EQ(a.fpfma(rm, b, a).as_bv(),
+                    FloatingPoint(type,
+                                  symfpu::fma<fp::SymFpuTraits>(
+                                      *a.size(), rm, ua, ub, ua))
+                        .as_bv());
+        }
+      }
+    }
+  }
+
   void test_to_fp_from_real(RoundingMode rm,
                             std::vector<std::vector<const char *>> &expected)
   {
@@ -1436,6 +1547,49 @@ TEST_F(TestFp, fp_is_value)
   }
 }
 
+TEST_F(TestFp, fp_native_fp32) { test_native(d_fp32); }
+
+TEST_F(TestFp, fp_native_fp64) { test_native(d_fp64); }
+
+TEST_F(TestFp, fp_native_fenv)
+{
+  // Host arithmetic must neither depend on nor modify the host environment.
+  FloatingPoint one =
+      FloatingPoint::from_real(d_nm, d_fp32, RoundingMode::RNE, "1");
+  FloatingPoint three =
+      FloatingPoint::from_real(d_nm, d_fp32, RoundingMode::RNE, "3");
+  FloatingPoint expected(d_fp32,
+                         symfpu::divide<fp::SymFpuTraits>(*one.size(),
+                                                          RoundingMode::RNE,
+                                                          *one.unpacked(),
+                                                          *three.unpacked()));
+  int prev = std::fegetround();
+  std::feclearexcept(FE_ALL_EXCEPT);
+  ASSERT_EQ(std::fesetround(FE_UPWARD), 0);
+  FloatingPoint res = one.fpdiv(RoundingMode::RNE, three);
+  int round = std::fegetround();
+  int flags = std::fetestexcept(FE_ALL_EXCEPT);
+  std::fesetround(prev);
+  ASSERT_EQ(res.as_bv(), expected.as_bv());
+  ASSERT_EQ(round, FE_UPWARD);
+  ASSERT_EQ(flags, 0);
+}
+
+#if defined(__SSE2__)
+TEST_F(TestFp, fp_native_ftz_daz)
+{
+  // Flush-to-zero and denormals-are-zero modes of the host must not affect
+  // results on subnormal operands and results.
+  uint32_t csr = _mm_getcsr();
+  _mm_setcsr(csr | 0x8040);
+  test_native(d_fp32);
+  test_native(d_fp64);
+  uint32_t csr_after = _mm_getcsr();
+  _mm_setcsr(csr);
+  ASSERT_EQ(csr_after & 0x8040, 0x8040u);
+}
+#endif
+
 TEST_F(TestFp, fp_from_real_dec_str_rna)
 {
   std::vector<std::vector<const char *>> expected = {
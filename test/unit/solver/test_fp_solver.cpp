@@ -144,4 +144,100 @@ TEST_F(TestFpSolver, fp_fma)
                    d_nm.mk_node(Kind::FP_FMA, {d_rm, d_fp_a, d_fp_b, d_fp_b}))
             << std::endl;
 }
+
+TEST_F(TestFpSolver, fp_abstraction)
+{
+  d_options.fp_abstraction.set(true);
+  SolvingContext ctx = SolvingContext(d_nm, d_options);
+  auto& stats        = ctx.d_solver_engine.d_fp_solver.d_word_blaster.d_stats;
+
+  auto mk_fp = [this](const std::string& real) {
+    return d_nm.mk_value(
+        FloatingPoint::from_real(d_nm, d_fp16, RoundingMode::RNE, real));
+  };
+  Node rne   = d_nm.mk_value(RoundingMode::RNE);
+  Node two   = mk_fp("2");
+  Node three = mk_fp("3");
+  Node mul   = d_nm.mk_node(Kind::FP_MUL, {rne, d_fp_a, d_fp_b});
+
+  // a = 2 and a * b = 6, the abstraction of a * b allows any b, refinement
+  // is required to conclude unsat for b != 3.
+  ctx.assert_formula(d_nm.mk_node(Kind::FP_LEQ, {d_fp_a, two}));
+  ctx.assert_formula(d_nm.mk_node(Kind::FP_GEQ, {d_fp_a, two}));
+  ctx.assert_formula(d_nm.mk_node(Kind::FP_EQUAL, {mul, mk_fp("6")}));
+  ctx.push();
+  ctx.assert_formula(d_nm.mk_node(Kind::DISTINCT, {d_fp_b, three}));
+  ASSERT_EQ(ctx.solve(), Result::UNSAT);
+  ASSERT_EQ(stats.num_abstractions, 1);
+  ASSERT_EQ(stats.num_refinements, 1);
+  ctx.pop();
+
+  ASSERT_EQ(ctx.solve(), Result::SAT);
+  ASSERT_EQ(ctx.get_value(d_fp_a), two);
+  ASSERT_EQ(ctx.get_value(d_fp_b), three);
+  ASSERT_EQ(ctx.get_value(mul), mk_fp("6"));
+
+  // a / b = 2 / 3
+  Node div        = d_nm.mk_node(Kind::FP_DIV, {rne, d_fp_a, d_fp_b});
+  Node two_thirds = d_nm.mk_value(FloatingPoint::from_rational(
+      d_nm, d_fp16, RoundingMode::RNE, "2", "3"));
+  ctx.assert_formula(d_nm.mk_node(Kind::FP_EQUAL, {div, two_thirds}));
+  ASSERT_EQ(ctx.solve(), Result::SAT);
+  ASSERT_EQ(stats.num_abstractions, 2);
+  ASSERT_EQ(ctx.get_value(div), two_thirds);
+  ctx.assert_formula(d_nm.mk_node(Kind::DISTINCT, {d_fp_b, three}));
+  ASSERT_EQ(ctx.solve(), Result::UNSAT);
+}
+
+TEST_F(TestFpSolver, fp_abstraction_scopes)
+{
+  d_options.fp_abstraction.set(true);
+  SolvingContext ctx = SolvingContext(d_nm, d_options);
+  auto& wb           = ctx.d_solver_engine.d_fp_solver.d_word_blaster;
+
+  Node rne = d_nm.mk_value(RoundingMode::RNE);
+  Node six = d_nm.mk_value(
+      FloatingPoint::from_real(d_nm, d_fp16, RoundingMode::RNE, "6"));
+  Node mul = d_nm.mk_node(Kind::FP_MUL, {rne, d_fp_a, d_fp_b});
+  Node eq  = d_nm.mk_node(Kind::FP_EQUAL, {mul, six});
+
+  ctx.push();
+  ctx.assert_formula(eq);
+  ASSERT_EQ(ctx.solve(), Result::SAT);
+  ASSERT_EQ(wb.abstractions().size(), 1);
+  ctx.pop();
+
+  // Abstractions of popped terms are not checked anymore.
+  ASSERT_EQ(ctx.solve(), Result::SAT);
+  ASSERT_TRUE(wb.abstractions().empty());
+
+  // Word-blasting is cached, the abstraction is re-activated.
+  ctx.push();
+  ctx.assert_formula(eq);
+  ASSERT_EQ(ctx.solve(), Result::SAT);
+  ASSERT_EQ(wb.abstractions().size(), 1);
+  ASSERT_EQ(ctx.get_value(mul), six);
+  ctx.pop();
+  ASSERT_EQ(wb.d_stats.num_abstractions, 1);
+}
+
+TEST_F(TestFpSolver, fp_abstraction_values)
+{
+  d_options.fp_abstraction.set(true);
+  SolvingContext ctx = SolvingContext(d_nm, d_options);
+
+  auto mk_fp = [this](const std::string& real) {
+    return d_nm.mk_value(
+        FloatingPoint::from_real(d_nm, d_fp16, RoundingMode::RNE, real));
+  };
+  // Special value lemmas over value operands simplify to true and are not
+  // sent.
+  Node sqrt = d_nm.mk_node(Kind::FP_SQRT, {d_rm, mk_fp("4")});
+  Node mul  = d_nm.mk_node(Kind::FP_MUL, {d_rm, mk_fp("2"), mk_fp("3")});
+  ctx.assert_formula(d_nm.mk_node(Kind::FP_EQUAL, {sqrt, mk_fp("2")}));
+  ctx.assert_formula(d_nm.mk_node(Kind::FP_EQUAL, {mul, mk_fp("6")}));
+  ASSERT_EQ(ctx.solve(), Result::SAT);
+  ctx.assert_formula(d_nm.mk_node(Kind::FP_IS_ZERO, {sqrt}));
+  ASSERT_EQ(ctx.solve(), Result::UNSAT);
+}
 }  // namespace bzla::test
@@ -0,0 +1,213 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "node/node_manager.h"
+#include "option/option.h"
+#include "rewrite/evaluator.h"
+#include "solver/fp/floating_point.h"
+#include "solving_context.h"
+#include "test/unit/test.h"
+
+namespace bzla::test {
+
+using namespace node;
+
+class TestFpWordBlaster : public TestCommon
+{
+ protected:
+  void SetUp() override
+  {
+    TestCommon::SetUp();
+    // Variable substitution would replace operands with their values.
+    d_options.preprocess.set(false);
+    d_options.finalize();
+    // Values are checked against the evaluator, model checking would
+    // word-blast all operations again for each query.
+    d_options.dbg_check_model.set(false);
+    d_fp = d_nm.mk_fp_type(3, 5);
+    d_a  = d_nm.mk_const(d_fp, "a");
+    d_b  = d_nm.mk_const(d_fp, "b");
+    d_c  = d_nm.mk_const(d_fp, "c");
+    d_rm = d_nm.mk_const(d_nm.mk_rm_type(), "rm");
+    for (auto rm : {RoundingMode::RNA,
+                    RoundingMode::RNE,
+                    RoundingMode::RTN,
+                    RoundingMode::RTP,
+                    RoundingMode::RTZ})
+    {
+      d_rms.push_back(d_nm.mk_value(rm));
+    }
+    // Zeros, subnormals, normals, infinities and nan of format (3, 5).
+    for (uint64_t bits : {0x00, 0x80, 0x01, 0x8f, 0x10, 0x3c, 0xb5, 0x47,
+                          0x70, 0xf0, 0x7f})
+    {
+      d_values.push_back(
+          d_nm.mk_value(FloatingPoint(d_fp, BitVector::from_ui(8, bits))));
+    }
+  }
+
+  /** Create operation of given kind with rounding mode (if any) and args. */
+  Node mk_op(Kind kind, const Node& rm, const std::vector<Node>& args)
+  {
+    std::vector<Node> children;
+    if (kind != Kind::FP_REM)
+    {
+      children.push_back(rm);
+    }
+    children.insert(children.end(), args.begin(), args.end());
+    return d_nm.mk_node(kind, children);
+  }
+
+  fp::WordBlaster::Statistics& stats(SolvingContext& ctx)
+  {
+    return ctx.d_solver_engine.d_fp_solver.d_word_blaster.d_stats;
+  }
+
+  NodeManager d_nm;
+  option::Options d_options;
+
+  Type d_fp;
+  Node d_a;
+  Node d_b;
+  Node d_c;
+  Node d_rm;
+  std::vector<Node> d_rms;
+  std::vector<Node> d_values;
+
+  std::vector<std::pair<Kind, size_t>> d_kinds = {{Kind::FP_ADD, 2},
+                                                  {Kind::FP_MUL, 2},
+                                                  {Kind::FP_DIV, 2},
+                                                  {Kind::FP_REM, 2},
+                                                  {Kind::FP_FMA, 3},
+                                                  {Kind::FP_SQRT, 1},
+                                                  {Kind::FP_RTI, 1}};
+};
+
+TEST_F(TestFpWordBlaster, template_values)
+{
+  // Instances of the template over placeholders for all operands must agree
+  // with the word-level evaluation of the operator on values.
+  for (const auto& [kind, arity] : d_kinds)
+  {
+    SolvingContext ctx(d_nm, d_options);
+    std::vector<Node> args{d_a, d_b, d_c};
+    args.resize(arity);
+    Node op = mk_op(kind, d_rm, args);
+    for (const Node& rm : d_rms)
+    {
+      for (const Node& va : d_values)
+      {
+        for (const Node& vb : d_values)
+        {
+          std::vector<Node> values{va, vb, d_values[3]};
+          values.resize(arity);
+          ctx.push();
+          ctx.assert_formula(d_nm.mk_node(Kind::EQUAL, {d_rm, rm}));
+          for (size_t i = 0; i < arity; ++i)
+          {
+            ctx.assert_formula(d_nm.mk_node(Kind::EQUAL, {args[i], values[i]}));
+          }
+          ASSERT_EQ(ctx.solve(), Result::SAT);
+          std::vector<Node> eval_args = values;
+          if (kind != Kind::FP_REM)
+          {
+            eval_args.insert(eval_args.begin(), rm);
+          }
+          ASSERT_EQ(ctx.get_value(op),
+                    Evaluator::evaluate(d_nm, kind, eval_args, {}))
+              << kind << " " << rm << " " << va << " " << vb;
+          ctx.pop();
+          if (arity == 1)
+          {
+            break;
+          }
+        }
+      }
+    }
+    ASSERT_EQ(stats(ctx).num_templates, 1);
+  }
+}
+
+TEST_F(TestFpWordBlaster, template_specialized)
+{
+  // Templates with value operands word-blasted into the circuit must be
+  // equivalent to the template over placeholders for all operands.
+  for (const auto& [kind, arity] : d_kinds)
+  {
+    for (size_t i : {2, 3, 6})
+    {
+      SolvingContext ctx(d_nm, d_options);
+      std::vector<Node> args{d_a, d_b, d_c};
+      std::vector<Node> spec_args{d_a, d_values[i], d_c};
+      args.resize(arity);
+      spec_args.resize(arity);
+      if (arity == 1)
+      {
+        spec_args[0] = d_values[i];
+      }
+      Node op      = mk_op(kind, d_rm, args);
+      Node spec_op = mk_op(kind, d_rms[1], spec_args);
+      ctx.assert_formula(d_nm.mk_node(Kind::EQUAL, {d_rm, d_rms[1]}));
+      ctx.assert_formula(
+          d_nm.mk_node(Kind::EQUAL, {arity == 1 ? d_a : d_b, d_values[i]}));
+      ctx.assert_formula(d_nm.mk_node(Kind::DISTINCT, {op, spec_op}));
+      ASSERT_EQ(ctx.solve(), Result::UNSAT) << kind << " " << d_values[i];
+      // Unary operations on values are folded.
+      ASSERT_EQ(stats(ctx).num_templates, arity == 1 ? 1 : 2);
+    }
+  }
+}
+
+TEST_F(TestFpWordBlaster, template_no_collision)
+{
+  SolvingContext ctx(d_nm, d_options);
+  Type fp46 = d_nm.mk_fp_type(4, 6);
+  Node x    = d_nm.mk_const(fp46, "x");
+  Node y    = d_nm.mk_const(fp46, "y");
+
+  Node rne_ab = mk_op(Kind::FP_ADD, d_rms[1], {d_a, d_b});
+  Node rne_cb = mk_op(Kind::FP_ADD, d_rms[1], {d_c, d_b});
+  Node rtz_ab = mk_op(Kind::FP_ADD, d_rms[4], {d_a, d_b});
+  Node rne_xy = mk_op(Kind::FP_ADD, d_rms[1], {x, y});
+  Node rtz_xy = mk_op(Kind::FP_ADD, d_rms[4], {x, y});
+
+  // Same operator, rounding mode and format share a template.
+  ctx.assert_formula(d_nm.mk_node(Kind::EQUAL, {rne_ab, rne_cb}));
+  ASSERT_EQ(ctx.solve(), Result::SAT);
+  ASSERT_EQ(stats(ctx).num_templates, 1);
+  ASSERT_EQ(stats(ctx).num_template_instances, 2);
+
+  // Different rounding modes must not share a template, the results differ
+  // for some operands.
+  ctx.assert_formula(d_nm.mk_node(Kind::DISTINCT, {rne_ab, rtz_ab}));
+  ASSERT_EQ(ctx.solve(), Result::SAT);
+  ASSERT_EQ(stats(ctx).num_templates, 2);
+  ASSERT_EQ(stats(ctx).num_template_instances, 3);
+  Node va = ctx.get_value(d_a);
+  Node vb = ctx.get_value(d_b);
+  ASSERT_EQ(ctx.get_value(rtz_ab),
+            Evaluator::evaluate(d_nm, Kind::FP_ADD, {d_rms[4], va, vb}, {}));
+  ASSERT_EQ(ctx.get_value(rne_ab),
+            Evaluator::evaluate(d_nm, Kind::FP_ADD, {d_rms[1], va, vb}, {}));
+
+  // Different formats must not share a template.
+  ctx.assert_formula(d_nm.mk_node(Kind::DISTINCT, {rne_xy, rtz_xy}));
+  ASSERT_EQ(ctx.solve(), Result::SAT);
+  ASSERT_EQ(stats(ctx).num_templates, 4);
+  ASSERT_EQ(stats(ctx).num_template_instances, 5);
+  Node vx = ctx.get_value(x);
+  Node vy = ctx.get_value(y);
+  ASSERT_EQ(ctx.get_value(rne_xy),
+            Evaluator::evaluate(d_nm, Kind::FP_ADD, {d_rms[1], vx, vy}, {}));
+  ASSERT_EQ(ctx.get_value(rtz_xy),
+            Evaluator::evaluate(d_nm, Kind::FP_ADD, {d_rms[4], vx, vy}, {}));
+}
+
+}  // namespace bzla::test
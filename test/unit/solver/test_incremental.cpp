@@ -224,4 +224,62 @@ TEST_F(TestIncremental, lemmas_on_demand1)
   ctx.pop();
   ASSERT_EQ(ctx.solve(), Result::SAT);
 }
+
+TEST_F(TestIncremental, activation_literals)
+{
+  NodeManager nm;
+  option::Options options;
+  // Preprocessing would substitute x with y.
+  options.preprocess.set(false);
+  options.finalize();
+  SolvingContext ctx = SolvingContext(nm, options);
+  const auto& stats =
+      ctx.d_solver_engine.d_bv_solver.d_bitblast_solver.d_stats;
+
+  Type bv8  = nm.mk_bv_type(8);
+  Node x    = nm.mk_const(bv8, "x");
+  Node y    = nm.mk_const(bv8, "y");
+  Node add  = nm.mk_node(Kind::BV_ADD, {x, y});
+  Node five = nm.mk_value(BitVector::from_ui(8, 5));
+  Node six  = nm.mk_value(BitVector::from_ui(8, 6));
+  // x + x = 5 has no solution, x + x is even.
+  Node eq5 = nm.mk_node(Kind::EQUAL, {add, five});
+  Node eq6 = nm.mk_node(Kind::EQUAL, {add, six});
+
+  ctx.assert_formula(nm.mk_node(Kind::EQUAL, {x, y}));
+
+  ctx.push();
+  ctx.assert_formula(eq5);
+  ASSERT_EQ(ctx.solve(), Result::UNSAT);
+  ASSERT_EQ(stats.num_activation_lits, 1);
+  ASSERT_EQ(stats.num_activation_lits_retired, 0);
+  uint64_t num_vars    = stats.num_cnf_vars;
+  uint64_t num_clauses = stats.num_cnf_clauses;
+  ctx.pop();
+
+  // The activation literal of the popped level is retired.
+  ASSERT_EQ(ctx.solve(), Result::SAT);
+  ASSERT_EQ(stats.num_activation_lits, 1);
+  ASSERT_EQ(stats.num_activation_lits_retired, 1);
+
+  // Re-asserting reuses the encoding, it only requires a new activation
+  // literal and its guard clause (which are not added via the encoder).
+  ctx.push();
+  ctx.assert_formula(eq5);
+  ASSERT_EQ(ctx.solve(), Result::UNSAT);
+  ASSERT_EQ(stats.num_activation_lits, 2);
+  ASSERT_EQ(stats.num_activation_lits_retired, 1);
+  ASSERT_EQ(stats.num_cnf_vars, num_vars);
+  ASSERT_EQ(stats.num_cnf_clauses, num_clauses);
+  ctx.pop();
+
+  ctx.push();
+  ctx.assert_formula(eq6);
+  ASSERT_EQ(ctx.solve(), Result::SAT);
+  ASSERT_EQ(stats.num_activation_lits, 3);
+  ASSERT_EQ(stats.num_activation_lits_retired, 2);
+  ASSERT_EQ(ctx.get_value(add), six);
+  ASSERT_EQ(ctx.get_value(x), ctx.get_value(y));
+  ctx.pop();
+}
 }  // namespace bzla::test
@@ -0,0 +1,125 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "node/node_manager.h"
+#include "solving_context.h"
+#include "test/unit/test.h"
+
+namespace bzla::test {
+
+using namespace node;
+
+class TestSolverEngine : public TestCommon
+{
+ protected:
+  void SetUp() override
+  {
+    // Preprocessing would substitute top-level constant p.
+    d_options.preprocess.set(false);
+    d_options.finalize();
+    d_p = d_nm.mk_const(d_nm.mk_bool_type(), "p");
+    d_r = d_nm.mk_const(d_nm.mk_bool_type(), "r");
+    d_s = d_nm.mk_const(d_nm.mk_bool_type(), "s");
+  }
+
+  NodeManager d_nm;
+  option::Options d_options;
+  Node d_p;
+  Node d_r;
+  Node d_s;
+};
+
+TEST_F(TestSolverEngine, minimize_lemma)
+{
+  SolvingContext ctx(d_nm, d_options);
+  SolverEngine& engine = ctx.d_solver_engine;
+  ctx.assert_formula(d_p);
+  ASSERT_EQ(ctx.solve(), Result::SAT);
+
+  // p is fixed at the top level
+  Node lemma = d_nm.mk_node(
+      Kind::IMPLIES, {d_nm.mk_node(Kind::AND, {d_p, d_r}), d_s});
+  ASSERT_EQ(engine.minimize_lemma(lemma),
+            d_nm.mk_node(Kind::IMPLIES, {d_r, d_s}));
+  ASSERT_EQ(engine.d_stats.num_lemmas_premises_dropped, 1);
+
+  // r is not fixed, duplicate premises are dropped
+  Node dup = d_nm.mk_node(
+      Kind::IMPLIES, {d_nm.mk_node(Kind::AND, {d_r, d_r}), d_s});
+  ASSERT_EQ(engine.minimize_lemma(dup),
+            d_nm.mk_node(Kind::IMPLIES, {d_r, d_s}));
+  ASSERT_EQ(engine.d_stats.num_lemmas_premises_dropped, 1);
+
+  Node min = d_nm.mk_node(Kind::IMPLIES, {d_p, d_s});
+  ASSERT_EQ(engine.minimize_lemma(min), d_s);
+  ASSERT_EQ(engine.d_stats.num_lemmas_premises_dropped, 2);
+}
+
+TEST_F(TestSolverEngine, process_lemmas)
+{
+  SolvingContext ctx(d_nm, d_options);
+  SolverEngine& engine = ctx.d_solver_engine;
+  ctx.assert_formula(d_p);
+  ASSERT_EQ(ctx.solve(), Result::SAT);
+
+  // Both lemmas minimize to r => s.
+  Node lemma1 = d_nm.mk_node(
+      Kind::IMPLIES, {d_nm.mk_node(Kind::AND, {d_p, d_r}), d_s});
+  Node lemma2 = d_nm.mk_node(Kind::IMPLIES, {d_r, d_s});
+  engine.lemma(lemma1);
+  engine.lemma(lemma2);
+  ASSERT_EQ(engine.d_lemmas.size(), 2);
+  engine.process_lemmas();
+  ASSERT_TRUE(engine.d_lemmas.empty());
+  ASSERT_EQ(engine.d_stats.num_lemmas_premises_dropped, 1);
+  ASSERT_EQ(engine.d_stats.num_lemmas_duplicates, 1);
+  ASSERT_EQ(engine.d_stats.num_lemmas, 1);
+
+  // Solvers must not send the same lemma twice.
+  ASSERT_DEATH_DEBUG(engine.lemma(lemma1), "inserted");
+
+  // The minimized lemma is registered.
+  ctx.assert_formula(d_r);
+  ctx.assert_formula(d_nm.mk_node(Kind::NOT, {d_s}));
+  ASSERT_EQ(ctx.solve(), Result::UNSAT);
+}
+
+TEST_F(TestSolverEngine, memory_pressure)
+{
+  SolvingContext ctx(d_nm, d_options);
+  auto& bb_solver = ctx.d_solver_engine.d_bv_solver.d_bitblast_solver;
+  uint32_t num_releases = 0;
+  ctx.d_env.register_memory_release([&num_releases]() { ++num_releases; });
+  ctx.assert_formula(d_nm.mk_node(Kind::AND, {d_p, d_r}));
+
+  // Nothing is released without memory pressure.
+  ASSERT_FALSE(ctx.d_env.check_memory_pressure());
+  ASSERT_EQ(ctx.solve(), Result::SAT);
+  ASSERT_EQ(num_releases, 0u);
+  ASSERT_EQ(ctx.d_stats.num_memory_releases, 0);
+
+  // Memory is released once at the next safe point, solving is not
+  // terminated.
+  ctx.d_env.raise_memory_pressure();
+  ctx.assert_formula(d_s);
+  ASSERT_EQ(ctx.solve(), Result::SAT);
+  ASSERT_FALSE(ctx.d_env.d_memory_pressure);
+  ASSERT_EQ(num_releases, 1u);
+  ASSERT_EQ(ctx.d_stats.num_memory_releases, 1);
+
+  // The bit-blasting solver releases memory before calling the SAT solver.
+  ctx.d_env.raise_memory_pressure();
+  ASSERT_EQ(bb_solver.solve(), Result::SAT);
+  ASSERT_FALSE(ctx.d_env.d_memory_pressure);
+  ASSERT_EQ(num_releases, 2u);
+  ASSERT_EQ(ctx.d_stats.num_memory_releases, 2);
+}
+
+}  // namespace bzla::test